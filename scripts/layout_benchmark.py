@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+# Compares performance of the two layouts of device arrays set by Athena_ARRAY_LAYOUT
+#
+# Builds AthenaK with LayoutRight and LayoutLeft, then runs a problem dominated by the
+# conserved-to-primitive inversion and EOS (GR hydro Bondi accretion) and a problem
+# dominated by the Z4c right-hand side (Z4c linear wave) with each build.  Outputs are
+# switched off and runs are limited by number of cycles.  Prints the
+# zone-cycles/cpu_second of each run, and the ratio of LayoutLeft to LayoutRight.
+#
+# Usage, from the root directory of the code:
+#   python3 scripts/layout_benchmark.py [--nlim=N] [--cmake=ARG] ...
+# where ARG is passed to cmake for both builds, e.g. --cmake=-DKokkos_ENABLE_CUDA=On
+
+# Modules
+import argparse
+import os
+import re
+import subprocess
+
+_layouts = ['right', 'left']
+_problems = [('C2P/EOS (gr_bondi)', 'inputs/tests/bondi.athinput'),
+             ('Z4c RHS (z4c_linear_wave)', 'inputs/tests/linear_wave_z4c.athinput')]
+
+
+# Build AthenaK with given layout in its own directory, return path of executable
+def build(layout, cmake_args):
+    build_dir = os.path.abspath('build_layout_' + layout)
+    subprocess.check_call(['cmake', '-S', '.', '-B', build_dir,
+                           '-DAthena_ARRAY_LAYOUT=' + layout] + cmake_args)
+    subprocess.check_call(['cmake', '--build', build_dir, '-j8'])
+    return os.path.join(build_dir, 'src', 'athena')
+
+
+# Run problem with given executable, return zone-cycles/cpu_second
+def run(exe, input_file, nlim):
+    arguments = ['time/nlim=' + str(nlim), 'time/tlim=1.0e10']
+    # switch off all outputs
+    with open(input_file, 'r') as f:
+        for block in re.findall(r'^<(output\d+)>', f.read(), re.MULTILINE):
+            arguments += [block + '/dt=-1.0', block + '/dcycle=0']
+    run_dir = os.path.dirname(exe)
+    output = subprocess.check_output([exe, '-i', os.path.abspath(input_file)]
+                                     + arguments, cwd=run_dir).decode('utf-8')
+    return float(re.search(r'zone-cycles/cpu_second\s+=\s+(\S+)', output).group(1))
+
+
+# Main function
+def main(**kwargs):
+    exes = {}
+    for layout in _layouts:
+        exes[layout] = build(layout, kwargs['cmake'])
+    print('{0:<28s}{1:>16s}{2:>16s}{3:>10s}'.format('problem', 'LayoutRight',
+                                                    'LayoutLeft', 'ratio'))
+    for name, input_file in _problems:
+        zcps = {}
+        for layout in _layouts:
+            zcps[layout] = run(exes[layout], input_file, kwargs['nlim'])
+        print('{0:<28s}{1:>16.4e}{2:>16.4e}{3:>10.3f}'.format(
+            name, zcps['right'], zcps['left'], zcps['left']/zcps['right']))
+
+
+# Execute main function
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--nlim',
+                        type=int,
+                        default=100,
+                        help='number of cycles in each run')
+    parser.add_argument('--cmake',
+                        default=[],
+                        action='append',
+                        help='additional argument passed to cmake for both builds')
+    args = parser.parse_args()
+    main(**vars(args))
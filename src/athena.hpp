@@ -9,6 +9,8 @@
 //  \brief contains Athena++ general purpose types, structures, enums, etc.
 
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_DualView.hpp>
@@ -50,6 +52,9 @@ using Real = double;
 // array indices for conserved: density, momemtum, total energy
 enum VariableIndex {IDN=0, IM1=1, IVX=1, IM2=2, IVY=2, IM3=3, IVZ=3, IEN=4,
                     ITM=4, IPR=4, IYF=5};
+// array indices for grey M1 radiation moments: energy density, flux.  Flux components
+// share indices with velocity, so reflecting BCs for Hydro also apply to M1 moments.
+enum M1VariableIndex {IER=0, IFX=1, IFY=2, IFZ=3, NM1VAR=4};
 // array indices for components of magnetic field
 enum BFieldIndex {IBX=0, IBY=1, IBZ=2, NMAG=3};
 // array indices for metric matrices in GR
@@ -60,6 +65,12 @@ enum ParticlesIndex {PGID=0, PTAG=1, IPX=0, IPVX=1, IPY=2, IPVY=3, IPZ=4, IPVZ=5
 
 // integer constants to specify spatial reconstruction methods
 enum ReconstructionMethod {dc, plm, ppm4, ppmx, wenoz};
+// number of cells on each side of an interface used by each reconstruction method
+inline int ReconstructionStencil(ReconstructionMethod method) {
+  if (method == ReconstructionMethod::dc) return 1;
+  if (method == ReconstructionMethod::plm) return 2;
+  return 3;
+}
 
 // constants that enumerate time evolution options
 enum TimeEvolution {tstatic, kinematic, dynamic};
@@ -91,8 +102,69 @@ using DevMemSpace = Kokkos::DefaultExecutionSpace::memory_space;
 using HostMemSpace = Kokkos::HostSpace;
 using ScratchMemSpace = DevExeSpace::scratch_memory_space;
 using LayoutWrapper = Kokkos::LayoutRight;                // increments last index fastest
+#if ARRAY_LAYOUT_LEFT
+using LayoutState = Kokkos::LayoutLeft;                  // increments first index fastest
+#else
+using LayoutState = Kokkos::LayoutRight;
+#endif
 using TeamMember_t = Kokkos::TeamPolicy<>::member_type;   // for Kokkos thread teams
 
+// LayoutState is used for 4D-6D device arrays (variables, fluxes, etc.), and is selected
+// at build time with Athena_ARRAY_LAYOUT.  With LayoutLeft the MeshBlock index, followed
+// by the variable index, increments fastest, so all variables of a cell are stored close
+// together, and the 4D/5D par_for wrappers iterate in the same order.  Arrays of lower
+// rank (including communication buffers) and all host arrays always use LayoutWrapper,
+// since MPI messages and outputs require contiguous rows.
+
+//----------------------------------------------------------------------------------------
+// pool of independent instances of the default execution space (streams, only created
+// with GPU backends) used to execute tasks concurrently.  The instance used by the task
+// currently being executed is stored in 'current' (set by TaskList), with current < 0
+// denoting the default instance.  All kernels launched within a task
+// should use TaskExeSpace() so that they are queued on the instance assigned to the task.
+
+namespace exec_instances {
+extern int current;
+std::vector<DevExeSpace> &Pool();
+inline int Size() {return static_cast<int>(Pool().size());}
+void Initialize(int n);
+void Fence(int n);
+void FenceAll();
+void Finalize();
+} // namespace exec_instances
+
+inline DevExeSpace TaskExeSpace() {
+  if (exec_instances::current >= 0) return exec_instances::Pool()[exec_instances::current];
+  return DevExeSpace();
+}
+
+//----------------------------------------------------------------------------------------
+// optional auto-tuning of the launch configuration (team size, vector length, and scratch
+// level) of kernels launched with par_for_outer.  When enabled, each distinct kernel
+// (keyed by name, league size, and scratch size) cycles through a list of candidate
+// configurations the first few times it is launched, timing each, and thereafter always
+// uses the fastest.  Winners can be saved to and loaded from a tuning file.
+
+namespace launch_tuning {
+struct LaunchConfig {
+  int team_size, vector_length;  // 0 denotes Kokkos::AUTO
+  int scr_level;
+};
+struct KernelTuning {
+  std::vector<LaunchConfig> cand;  // candidate configurations
+  std::vector<double> best_time;   // fastest time measured for each candidate
+  int ntried = 0;                  // number of launches made while tuning
+  int winner = -1;                 // index of fastest candidate once tuning is complete
+};
+extern bool enabled;
+KernelTuning &Lookup(const std::string &name, int nleague, size_t scr_size, int scr_lev);
+void Record(KernelTuning &kt, int c, double time);
+Kokkos::TeamPolicy<> MakePolicy(DevExeSpace exec_space, int nleague,
+                                const LaunchConfig &cfg);
+void Initialize(bool enable, int ntrial, const std::string &file);
+void Finalize();
+} // namespace launch_tuning
+
 //----------------------------------------------------------------------------------------
 // alias template declarations for various array types (formerly AthenaArrays)
 // mostly used to store cell-centered variables (volume averaged)
@@ -105,11 +177,11 @@ using DvceArray2D = Kokkos::View<T **, LayoutWrapper, DevMemSpace>;
 template <typename T>
 using DvceArray3D = Kokkos::View<T ***, LayoutWrapper, DevMemSpace>;
 template <typename T>
-using DvceArray4D = Kokkos::View<T ****, LayoutWrapper, DevMemSpace>;
+using DvceArray4D = Kokkos::View<T ****, LayoutState, DevMemSpace>;
 template <typename T>
-using DvceArray5D = Kokkos::View<T *****, LayoutWrapper, DevMemSpace>;
+using DvceArray5D = Kokkos::View<T *****, LayoutState, DevMemSpace>;
 template <typename T>
-using DvceArray6D = Kokkos::View<T ******, LayoutWrapper, DevMemSpace>;
+using DvceArray6D = Kokkos::View<T ******, LayoutState, DevMemSpace>;
 
 // template declarations for construction of Kokkos::View on host
 template <typename T>
@@ -282,15 +354,28 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int ni = iu - il + 1;
   const int nnkji = nn * nk * nj * ni;
+#if ARRAY_LAYOUT_LEFT
+  const int nnkj  = nn * nk * nj;
+  const int nnk   = nn * nk;
+#else
   const int nkji  = nk * nj * ni;
   const int nji   = nj * ni;
+#endif
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nnkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute n,k,j,i indices of thread and call function
+#if ARRAY_LAYOUT_LEFT
+    int i = (idx)/nnkj;
+    int j = (idx - i*nnkj)/nnk;
+    int k = (idx - i*nnkj - j*nnk)/nn;
+    int n = (idx - i*nnkj - j*nnk - k*nn);
+    i += il;
+#else
     int n = (idx)/nkji;
     int k = (idx - n*nkji)/nji;
     int j = (idx - n*nkji - k*nji)/ni;
     int i = (idx - n*nkji - k*nji - j*ni) + il;
+#endif
     n += nl;
     k += kl;
     j += jl;
@@ -313,17 +398,32 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int ni = iu - il + 1;
   const int nmnkji = nm * nn * nk * nj * ni;
+#if ARRAY_LAYOUT_LEFT
+  const int nmnkj  = nm * nn * nk * nj;
+  const int nmnk   = nm * nn * nk;
+  const int nmn    = nm * nn;
+#else
   const int nnkji  = nn * nk * nj * ni;
   const int nkji   = nk * nj * ni;
   const int nji    = nj * ni;
+#endif
   Kokkos::parallel_for(name, Kokkos::RangePolicy<>(exec_space, 0, nmnkji),
   KOKKOS_LAMBDA(const int &idx) {
     // compute m,n,k,j,i indices of thread and call function
+#if ARRAY_LAYOUT_LEFT
+    int i = (idx)/nmnkj;
+    int j = (idx - i*nmnkj)/nmnk;
+    int k = (idx - i*nmnkj - j*nmnk)/nmn;
+    int n = (idx - i*nmnkj - j*nmnk - k*nmn)/nm;
+    int m = (idx - i*nmnkj - j*nmnk - k*nmn - n*nm);
+    i += il;
+#else
     int m = (idx)/nnkji;
     int n = (idx - m*nnkji)/nkji;
     int k = (idx - m*nnkji - n*nkji)/nji;
     int j = (idx - m*nnkji - n*nkji - k*nji)/ni;
     int i = (idx - m*nnkji - n*nkji - k*nji - j*ni) + il;
+#endif
     m += ml;
     n += nl;
     k += kl;
@@ -332,6 +432,103 @@ inline void par_for(const std::string &name, DevExeSpace exec_space,
   });
 }
 
+//------------------------------
+// (Re)allocate 4D/5D arrays without the default initialization by Kokkos, and instead set
+// them to zero with par_for.  With OpenMP, memory pages are placed in the NUMA domain of
+// the thread that first touches them, which is then the same thread that updates them in
+// kernels using par_for (which map threads to indices in the same order for any rank).
+template <typename T>
+inline void realloc_first_touch(DvceArray4D<T> &a, const int nm, const int nk,
+                                const int nj, const int ni) {
+  Kokkos::realloc(Kokkos::WithoutInitializing, a, nm, nk, nj, ni);
+  auto a_ = a;
+  par_for("first_touch", DevExeSpace(), 0, nm-1, 0, nk-1, 0, nj-1, 0, ni-1,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    a_(m,k,j,i) = static_cast<T>(0);
+  });
+}
+
+template <typename T>
+inline void realloc_first_touch(DvceArray5D<T> &a, const int nm, const int nn,
+                                const int nk, const int nj, const int ni) {
+  Kokkos::realloc(Kokkos::WithoutInitializing, a, nm, nn, nk, nj, ni);
+  auto a_ = a;
+  par_for("first_touch", DevExeSpace(), 0, nm-1, 0, nn-1, 0, nk-1, 0, nj-1, 0, ni-1,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    a_(m,n,k,j,i) = static_cast<T>(0);
+  });
+}
+
+//------------------------------
+// deep_copy between a 4D-6D device array (or subview) and a host array of the same shape,
+// in either direction, when their layouts may differ (see LayoutState).  Data is remapped
+// in device memory through a temporary array with the layout of host arrays, since Kokkos
+// only copies arrays between memory spaces when their layouts are identical.
+template <typename DstView, typename SrcView>
+inline void deep_copy_layout(const DstView &dst, const SrcView &src) {
+  if constexpr (std::is_same<typename DstView::array_layout,
+                             typename SrcView::array_layout>::value) {
+    Kokkos::deep_copy(dst, src);
+  } else {
+    LayoutWrapper layout;
+    for (int r=0; r<static_cast<int>(DstView::rank); ++r) {
+      layout.dimension[r] = dst.extent(r);
+    }
+    Kokkos::View<typename DstView::non_const_data_type, LayoutWrapper, DevMemSpace>
+      tmp(Kokkos::view_alloc(Kokkos::WithoutInitializing, "deep_copy_tmp"), layout);
+    Kokkos::deep_copy(tmp, src);
+    Kokkos::deep_copy(dst, tmp);
+  }
+}
+
+//------------------------------------------
+// launch a team kernel over nleague teams on behalf of the par_for_outer functions, using
+// Kokkos::AUTO team size unless launch_tuning is enabled.
+template <typename Function>
+inline void launch_outer(const std::string &name, DevExeSpace exec_space,
+                         size_t scr_size, const int scr_level, const int nleague,
+                         const Function &function) {
+  if (!(launch_tuning::enabled)) {
+    Kokkos::TeamPolicy<> policy(exec_space, nleague, Kokkos::AUTO);
+    policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size));
+    Kokkos::parallel_for(name, policy, function);
+    return;
+  }
+  auto &kt = launch_tuning::Lookup(name, nleague, scr_size, scr_level);
+  if (kt.winner >= 0) {
+    auto &cfg = kt.cand[kt.winner];
+    auto policy = launch_tuning::MakePolicy(exec_space, nleague, cfg);
+    policy.set_scratch_size(cfg.scr_level,Kokkos::PerTeam(scr_size));
+    Kokkos::parallel_for(name, policy, function);
+    return;
+  }
+
+  // still tuning: check candidate is valid for this kernel, then time it
+  int c = kt.ntried % static_cast<int>(kt.cand.size());
+  auto &cfg = kt.cand[c];
+  auto policy = launch_tuning::MakePolicy(exec_space, nleague, cfg);
+  policy.set_scratch_size(cfg.scr_level,Kokkos::PerTeam(scr_size));
+  bool valid = (scr_size <= static_cast<size_t>(
+                            Kokkos::TeamPolicy<>::scratch_size_max(cfg.scr_level)));
+  if (cfg.vector_length > Kokkos::TeamPolicy<>::vector_length_max()) valid = false;
+  if (valid && cfg.team_size > 0 &&
+      cfg.team_size > policy.team_size_max(function, Kokkos::ParallelForTag())) {
+    valid = false;
+  }
+  if (!(valid)) {
+    launch_tuning::Record(kt, c, -1.0);
+    Kokkos::TeamPolicy<> dpolicy(exec_space, nleague, Kokkos::AUTO);
+    dpolicy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size));
+    Kokkos::parallel_for(name, dpolicy, function);
+    return;
+  }
+  exec_space.fence();
+  Kokkos::Timer timer;
+  Kokkos::parallel_for(name, policy, function);
+  exec_space.fence();
+  launch_tuning::Record(kt, c, timer.seconds());
+}
+
 //------------------------------------------
 // 1D outer parallel loop using Kokkos Teams
 template <typename Function>
@@ -339,8 +536,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
                           size_t scr_size, const int scr_level,
                           const int kl, const int ku, const Function &function) {
   const int nk = ku - kl + 1;
-  Kokkos::TeamPolicy<> policy(exec_space, nk, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
+  launch_outer(name, exec_space, scr_size, scr_level, nk,
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank() + kl;
     function(tmember, k);
@@ -357,8 +553,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nk = ku - kl + 1;
   const int nj = ju - jl + 1;
   const int nkj = nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
+  launch_outer(name, exec_space, scr_size, scr_level, nkj,
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int k = tmember.league_rank()/nj + kl;
     const int j = tmember.league_rank()%nj + jl;
@@ -378,8 +573,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nj = ju - jl + 1;
   const int nkj  = nk*nj;
   const int nnkj = nn*nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nnkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
+  launch_outer(name, exec_space, scr_size, scr_level, nnkj,
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     int n = (tmember.league_rank())/nkj;
     int k = (tmember.league_rank() - n*nkj)/nj;
@@ -405,8 +599,7 @@ inline void par_for_outer(const std::string &name, DevExeSpace exec_space,
   const int nkj   = nk*nj;
   const int nnkj  = nn*nk*nj;
   const int nmnkj = nm*nn*nk*nj;
-  Kokkos::TeamPolicy<> policy(exec_space, nmnkj, Kokkos::AUTO);
-  Kokkos::parallel_for(name, policy.set_scratch_size(scr_level,Kokkos::PerTeam(scr_size)),
+  launch_outer(name, exec_space, scr_size, scr_level, nmnkj,
   KOKKOS_LAMBDA(TeamMember_t tmember) {
     int m = (tmember.league_rank())/nnkj;
     int n = (tmember.league_rank() - m*nnkj)/nkj;
@@ -37,15 +37,15 @@ using sub_DvceArray5D_0D = decltype(Kokkos::subview(
                            Kokkos::ALL,Kokkos::ALL,Kokkos::ALL));
 
 using sub_HostArray5D_2D = decltype(Kokkos::subview(
-                           std::declval<HostArray5D<Real>>(),
+                           std::declval<DvceArray5D<Real>::HostMirror>(),
                            Kokkos::ALL,std::make_pair(0,6),
                            Kokkos::ALL,Kokkos::ALL,Kokkos::ALL));
 using sub_HostArray5D_1D = decltype(Kokkos::subview(
-                           std::declval<HostArray5D<Real>>(),
+                           std::declval<DvceArray5D<Real>::HostMirror>(),
                            Kokkos::ALL,std::make_pair(0,3),
                            Kokkos::ALL,Kokkos::ALL,Kokkos::ALL));
 using sub_HostArray5D_0D = decltype(Kokkos::subview(
-                           std::declval<HostArray5D<Real>>(),
+                           std::declval<DvceArray5D<Real>::HostMirror>(),
                            Kokkos::ALL,1,
                            Kokkos::ALL,Kokkos::ALL,Kokkos::ALL));
 
@@ -72,7 +72,7 @@ class AthenaHostTensor<T, sym, ndim, 0> {
     return data_(m,k,j,i);
   }
   //KOKKOS_INLINE_FUNCTION
-  void InitWithShallowSlice(HostArray5D<Real> src, const int indx) {
+  void InitWithShallowSlice(DvceArray5D<Real>::HostMirror src, const int indx) {
     data_ = Kokkos::subview(src,Kokkos::ALL,indx,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
   }
 
@@ -96,7 +96,8 @@ class AthenaHostTensor<T, sym, ndim, 1> {
                              int const k, int const j, int const i) const {
     return data_(m,a,k,j,i);
   }
-  void InitWithShallowSlice(HostArray5D<Real> src, const int indx1, const int indx2) {
+  void InitWithShallowSlice(DvceArray5D<Real>::HostMirror src, const int indx1,
+                            const int indx2) {
     data_ = Kokkos::subview(src, Kokkos::ALL, std::make_pair(indx1, indx2+1),
                                  Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
   }
@@ -126,7 +127,8 @@ class AthenaHostTensor<T, sym, ndim, 2> {
     return data_(m,idxmap_[a][b],k,j,i);
   }
   //KOKKOS_INLINE_FUNCTION
-  void InitWithShallowSlice(HostArray5D<Real> src, const int indx1, const int indx2) {
+  void InitWithShallowSlice(DvceArray5D<Real>::HostMirror src, const int indx1,
+                            const int indx2) {
     data_ = Kokkos::subview(src, Kokkos::ALL, std::make_pair(indx1, indx2+1),
                                  Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
   }
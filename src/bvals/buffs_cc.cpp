@@ -195,6 +195,9 @@ void MeshBoundaryValuesCC::InitRecvIndices(MeshBoundaryBuffer &buf,
     }
     buf.isame_ndat = (isame.bie - isame.bis + 1)*(isame.bje - isame.bjs + 1)*
                      (isame.bke - isame.bks + 1);
+    buf.isame_shift[0] = ox1*(mb_indcs.nx1);
+    buf.isame_shift[1] = ox2*(mb_indcs.nx2);
+    buf.isame_shift[2] = ox3*(mb_indcs.nx3);
   }
 
   // set indices for receives of COARSE data from neighbors on SAME level
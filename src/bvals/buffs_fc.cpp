@@ -454,6 +454,9 @@ void MeshBoundaryValuesFC::InitRecvIndices(MeshBoundaryBuffer &buf,
                  (isame[i].bke - isame[i].bks + 1);
       buf.isame_ndat = std::max(buf.isame_ndat, ndat);
     }
+    buf.isame_shift[0] = ox1*(mb_indcs.nx1);
+    buf.isame_shift[1] = ox2*(mb_indcs.nx2);
+    buf.isame_shift[2] = ox3*(mb_indcs.nx3);
   }
 
   // set indices for receives from neighbors on COARSER level (matches send to FINER)
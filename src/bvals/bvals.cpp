@@ -28,9 +28,18 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
   is_z4c_(z4c),
   u_in("uin",1,1),
   b_in("bin",1,1),
-  i_in("iin",1,1) {
+  i_in("iin",1,1),
+  recv_list("recv_list",1),
+  nrecv_list(-1),
+  nmb_early_unpack(0) {
   // allocate vector of status flags and MPI requests (if needed)
   int nnghbr = pmy_pack->pmb->nnghbr;
+  granular_recv = pin->GetOrAddBoolean("mesh","granular_recv",false);
+  if (granular_recv) {
+    int nmbmax = std::max((pmy_pack->nmb_thispack), (pmy_pack->pmesh->nmb_maxperrank));
+    recv_done.assign(nmbmax, 0);
+    Kokkos::realloc(recv_list, nmbmax);
+  }
 
   // sendbuf and recvbuf are fixed-length [56-element] arrays
   // Initialize some of the data in appropriate elements based on dimensionality of
@@ -69,6 +78,18 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
   // create unique communicators for variables and fluxes in this BoundaryValues object
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_vars);
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_flux);
+
+  // shared memory exchange requires buffers in device memory to be accessible from host
+  shm_comm = pin->GetOrAddBoolean("mesh","shm_comm",false);
+  if (shm_comm && !(Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                               DevMemSpace>::accessible)) {
+    shm_comm = false;
+    if (global_variable::my_rank == 0) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "<mesh>/shm_comm requires host-accessible device memory, and is "
+                << "ignored" << std::endl;
+    }
+  }
 #endif
 }
 
@@ -77,6 +98,7 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
 
 MeshBoundaryValues::~MeshBoundaryValues() {
 #if MPI_PARALLEL_ENABLED
+  if (shm_comm) {FreeShmWindow();}
   int nnghbr = pmy_pack->pmb->nnghbr;
   for (int n=0; n<nnghbr; ++n) {
     delete [] sendbuf[n].vars_req;
@@ -218,6 +240,10 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
     }
   }
 
+#if MPI_PARALLEL_ENABLED
+  // move send buffers into shared memory window
+  if (shm_comm) {InitShmWindow();}
+#endif
   return;
 }
 
@@ -20,6 +20,7 @@ enum class BoundaryFlag {undef=-1,block, reflect, inflow, outflow, diode, user,
                          shear_periodic, vacuum};
 
 #include <algorithm>
+#include <cstdint>
 #include <vector>
 
 #include "athena.hpp"
@@ -71,6 +72,9 @@ struct MeshBoundaryBuffer {
   // With Z4c higher-order prolongation/rstriction, must also send coarse data between
   // MeshBlocks at the same level, which requires an additional indices array
   MeshBufferIndcs isame_z4c;  // indices for pack/unpack with z4c when dst/src at same lvl
+  // Offsets (x1,x2,x3) from recv indices to cells in the neighboring MeshBlock at the
+  // same level, used to copy ghost zones directly when neighbor is on the same rank
+  int isame_shift[3];
 
   // Maximum number of data elements (bie-bis+1) across 3 components of above
   int isame_ndat, isame_z4c_ndat, icoar_ndat, ifine_ndat, iflxs_ndat, iflxc_ndat;
@@ -120,9 +124,28 @@ class MeshBoundaryValues {
   // constant inflow states at each face, initialized in problem generator
   DualArray2D<Real> u_in, b_in, i_in;
 
+  // With <mesh>/granular_recv=true, ghost zones of each MeshBlock are unpacked as soon as
+  // all of its messages have arrived, by kernels launched over the list of MeshBlocks
+  // that became ready since the last call (nrecv_list<0 means all MeshBlocks in pack).
+  // nmb_early_unpack counts MeshBlocks unpacked while others were still waiting.
+  bool granular_recv;
+  std::vector<int> recv_done;
+  DualArray1D<int> recv_list;
+  int nrecv_list;
+  std::int64_t nmb_early_unpack;
+
 #if MPI_PARALLEL_ENABLED
   // unique MPI communicators for each case (variables/fluxes)
   MPI_Comm comm_vars, comm_flux;
+
+  // With <mesh>/shm_comm=true, variables are exchanged with ranks on the same node
+  // through an MPI-3 shared memory window holding the send buffers (see bvals_shm.cpp)
+  bool shm_comm;
+  MPI_Comm comm_node;
+  MPI_Win shm_win;
+  std::vector<int> shm_node_rank;     // rank in comm_node of each rank, or -1 if off-node
+  std::vector<char*> shm_base;        // start of window of each rank in comm_node
+  std::vector<int> shm_recv_pending;  // Reals still to be received for each (n,m)
 #endif
 
   //functions
@@ -133,9 +156,19 @@ class MeshBoundaryValues {
   TaskStatus InitRecv(const int nvar);
   virtual TaskStatus InitFluxRecv(const int nvar)=0;
   TaskStatus ClearRecv();
+  bool TestRecv();
+  int TestRecvEachMB();
   TaskStatus ClearSend();
   TaskStatus ClearFluxRecv();
   TaskStatus ClearFluxSend();
+#if MPI_PARALLEL_ENABLED
+  void InitShmWindow();
+  void FreeShmWindow();
+  bool IsShmNeighbor(int rank);
+  void ShmPostSend(int m, int n);
+  bool ShmTestRecv(int m, int n);
+  bool ShmSendReleased();
+#endif
 
   // BCs associated with various physics modules
   static void HydroBCs(MeshBlockPack *pp, DualArray2D<Real> uin, DvceArray5D<Real> u0);
@@ -167,6 +200,18 @@ class MeshBoundaryValuesCC : public MeshBoundaryValues {
   // functions to communicate CC data
   TaskStatus PackAndSendCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
   TaskStatus RecvAndUnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  // functions to communicate a list of CC fields (e.g. from several physics modules) in
+  // the same messages
+  TaskStatus PackAndSendCC(std::vector<DvceArray5D<Real>> &a,
+                           std::vector<DvceArray5D<Real>> &ca);
+  TaskStatus RecvAndUnpackCC(std::vector<DvceArray5D<Real>> &a,
+                             std::vector<DvceArray5D<Real>> &ca);
+  // pack/send and unpack of one CC field, starting at variable voff of nvar in buffers
+  void PackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, const int voff,
+              const int nvar);
+  TaskStatus SendCC(const int nvar);
+  void UnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, const int voff,
+                const int nvar);
   // functions to communicate fluxes of CC data
   TaskStatus PackAndSendFluxCC(DvceFaceFld5D<Real> &flx);
   TaskStatus RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx);
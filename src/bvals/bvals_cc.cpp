@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -40,12 +41,54 @@ MeshBoundaryValuesCC::MeshBoundaryValuesCC(MeshBlockPack *pp, ParameterInput *pi
 
 TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
                                                DvceArray5D<Real> &ca) {
+#if MPI_PARALLEL_ENABLED
+  // send buffers in shared memory window cannot be packed until copied by neighbors
+  if (shm_comm && !(ShmSendReleased())) return TaskStatus::incomplete;
+#endif
+  int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
+  PackCC(a, ca, 0, nvar);
+  return SendCC(nvar);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::PackAndSendCC()
+//! \brief Pack a list of cell-centered fields (e.g. from different physics modules) into
+//! the same boundary buffers and send them to neighbors in a single message.
+//!
+//! Each field a[f] (with coarse array ca[f]) is packed by its own kernel, after the
+//! variables of the fields before it, so the object must be initialized with nvar equal
+//! to the sum of a[f].extent(1).  For a Z4c object, coarse data for higher-order
+//! prolongation is appended for every field.
+
+TaskStatus MeshBoundaryValuesCC::PackAndSendCC(std::vector<DvceArray5D<Real>> &a,
+                                               std::vector<DvceArray5D<Real>> &ca) {
+#if MPI_PARALLEL_ENABLED
+  // send buffers in shared memory window cannot be packed until copied by neighbors
+  if (shm_comm && !(ShmSendReleased())) return TaskStatus::incomplete;
+#endif
+  int nvar = 0;
+  for (auto &af : a) {nvar += af.extent_int(1);}
+  int voff = 0;
+  for (std::size_t f=0; f<a.size(); ++f) {
+    PackCC(a[f], ca[f], voff, nvar);
+    voff += a[f].extent_int(1);
+  }
+  return SendCC(nvar);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::PackCC()
+//! \brief Pack variables of one cell-centered field into the boundary buffers, starting
+//! at variable index voff of the nvar variables stored in each buffer.
+
+void MeshBoundaryValuesCC::PackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+                                  const int voff, const int nvar) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
-  int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
+  int nv = a.extent_int(1);
 
-  {int my_rank = global_variable::my_rank;
+  int my_rank = global_variable::my_rank;
   auto &nghbr = pmy_pack->pmb->nghbr;
   auto &mbgid = pmy_pack->pmb->mb_gid;
   auto &mblev = pmy_pack->pmb->mb_lev;
@@ -53,13 +96,16 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
   auto &rbuf = recvbuf;
   auto &is_z4c = is_z4c_;
   auto &multilevel = pmy_pack->pmesh->multilevel;
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  int nmnv = nmb*nnghbr*nvar;
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  // Outer loop over (# of MeshBlocks)*(# of buffers).  Index range of each buffer is
+  // computed once per team, and all variables are packed by the team, so the number of
+  // teams does not grow with the number of variables. Buffers store data for each
+  // variable contiguously, i.e. index = i + ni*(j + nj*(k + nk*(voff+v))), so that the
+  // middle loop over (v,k,j) and inner loop over i write contiguous runs.
+  int nmn = nmb*nnghbr;
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmn, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+    const int m = (tmember.league_rank())/nnghbr;
+    const int n = (tmember.league_rank() - m*nnghbr);
 
     // only load buffers when neighbor exists
     if (nghbr.d_view(m,n).gid >= 0) {
@@ -99,117 +145,81 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
       int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
       int dn = nghbr.d_view(m,n).dest;
 
-      // Middle loop over k,j
-      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-        int k = idx / nj;
-        int j = (idx - k * nj) + jl;
-        k += kl;
-
-        // Inner (vector) loop over i
-        // copy directly into recv buffer if MeshBlocks on same rank
-
-        if (nghbr.d_view(m,n).rank == my_rank) {
-          // if neighbor is at same or finer level, load data from u0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = a(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_u0
-          } else {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
-
-        // else copy into send buffer for MPI communication below
-
-        } else {
-          // if neighbor is at same or finer level, load data from u0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = a(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          // if neighbor is at coarser level, load data from coarse_u0
-          } else {
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) ) = ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
-        }
-      });
-    } // end if-neighbor-exists block
-  }); // end par_for_outer
+      // copy directly into recv buffer if MeshBlocks on same rank, else copy into send
+      // buffer for MPI communication below
+      Real *pbuf = (nghbr.d_view(m,n).rank == my_rank) ? &(rbuf[dn].vars(dm,0)) :
+                                                         &(sbuf[n].vars(m,0));
+      // if neighbor is at same or finer level, load data from u0, otherwise from
+      // coarse_u0
+      auto &src = (nghbr.d_view(m,n).lev >= mblev.d_view(m)) ? a : ca;
+
+      // Neighbors at the same level on this rank copy ghost zones directly from u0 in
+      // RecvAndUnpackCC(), so no data needs to be packed for them here
+      if ((nghbr.d_view(m,n).lev != mblev.d_view(m)) ||
+          (nghbr.d_view(m,n).rank != my_rank)) {
+        // Middle loop over v,k,j
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nv*nkj),
+        [&](const int idx) {
+          int v = idx / nkj;
+          int k = (idx - v*nkj) / nj;
+          int j = (idx - v*nkj - k*nj) + jl;
+          k += kl;
+          Real *pdat = pbuf + ni*(j-jl + nj*(k-kl + nk*(voff+v)));
 
-  Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+          // Inner (vector) loop over i
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+          [&](const int i) {
+            pdat[i-il] = src(m,v,k,j,i);
+          });
+        });
+      }
 
-    // only load buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      int il, iu, jl, ju, kl, ku;
       // If neighbor is at same level and data is for Z4c module, append data from coarse
       // array for higher-order prolongation
       if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c) && (multilevel)) {
+        tmember.team_barrier();
         il = sbuf[n].isame_z4c.bis;
         iu = sbuf[n].isame_z4c.bie;
         jl = sbuf[n].isame_z4c.bjs;
         ju = sbuf[n].isame_z4c.bje;
         kl = sbuf[n].isame_z4c.bks;
         ku = sbuf[n].isame_z4c.bke;
-        int ni = iu - il + 1;
-        int nj = ju - jl + 1;
-        int nk = ku - kl + 1;
-        int nkj  = nk*nj;
+        ni = iu - il + 1;
+        nj = ju - jl + 1;
+        nk = ku - kl + 1;
+        nkj  = nk*nj;
         int ndat = nvar*sbuf[n].isame_ndat; // size of same level data already in buff
 
-        // indices of recv'ing (destination) MB and buffer: MB IDs are stored sequentially
-        // in MeshBlockPacks, so array index equals (target_id - first_id)
-        int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
-        int dn = nghbr.d_view(m,n).dest;
-
-        // Middle loop over k,j
-        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-          int k = idx / nj;
-          int j = (idx - k * nj) + jl;
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nv*nkj),
+        [&](const int idx) {
+          int v = idx / nkj;
+          int k = (idx - v*nkj) / nj;
+          int j = (idx - v*nkj - k*nj) + jl;
           k += kl;
+          Real *pdat = pbuf + ndat + ni*(j-jl + nj*(k-kl + nk*(voff+v)));
 
-          // Inner (vector) loop over i
-          // copy directly into recv buffer if MeshBlocks on same rank
-          if (nghbr.d_view(m,n).rank == my_rank) {
-            // load data from coarse_u0
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              rbuf[dn].vars(dm,ndat+ (i-il + ni*(j-jl + nj*(k-kl + nk*v))))=ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-
-          // else copy into send buffer for MPI communication below
-          } else {
-            // load data from coarse_u0
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
-            [&](const int i) {
-              sbuf[n].vars(m,ndat+ (i-il + ni*(j-jl + nj*(k-kl + nk*v))) )=ca(m,v,k,j,i);
-            });
-            tmember.team_barrier();
-          }
+          Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
+          [&](const int i) {
+            pdat[i-il] = ca(m,v,k,j,i);
+          });
         });
       }
     } // end if-neighbor-exists block
   }); // end par_for_outer
-  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValuesCC::SendCC()
+//! \brief Send boundary buffers packed with nvar variables by PackCC() to neighbors on
+//! other ranks.
 
+TaskStatus MeshBoundaryValuesCC::SendCC(const int nvar) {
 #if MPI_PARALLEL_ENABLED
   // Send boundary buffer to neighboring MeshBlocks using MPI
-  Kokkos::fence();
+  TaskExeSpace().fence();
+  int nmb = pmy_pack->nmb_thispack;
+  int nnghbr = pmy_pack->pmb->nnghbr;
   auto &is_z4c = is_z4c_;
   int my_rank = global_variable::my_rank;
   auto &nghbr = pmy_pack->pmb->nghbr;
@@ -221,6 +231,11 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
         int dn = nghbr.h_view(m,n).dest;
         int drank = nghbr.h_view(m,n).rank;
         if (drank != my_rank) {
+          // neighbor on same node copies data from shared memory window
+          if (IsShmNeighbor(drank)) {
+            ShmPostSend(m,n);
+            continue;
+          }
           // create tag using local ID and buffer index of *receiving* MeshBlock
           int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
           int tag = CreateBvals_MPI_Tag(lid, dn);
@@ -263,6 +278,56 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
 
 TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
                                                  DvceArray5D<Real> &ca) {
+  // exit if recv boundary buffer communications have not completed.  With
+  // granular_recv, unpack MeshBlocks whose buffers have all arrived
+  int nwait = 0;
+  if (granular_recv) {
+    nwait = TestRecvEachMB();
+    if (nrecv_list == 0) {return TaskStatus::incomplete;}
+  } else if (!(TestRecv())) {
+    return TaskStatus::incomplete;
+  }
+
+  int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
+  UnpackCC(a, ca, 0, nvar);
+  return (nwait > 0)? TaskStatus::incomplete : TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+// \!fn void RecvBuffers()
+// \brief Unpack boundary buffers containing a list of cell-centered fields, packed by
+// the list version of PackAndSendCC()
+
+TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(std::vector<DvceArray5D<Real>> &a,
+                                                 std::vector<DvceArray5D<Real>> &ca) {
+  // exit if recv boundary buffer communications have not completed.  With
+  // granular_recv, unpack MeshBlocks whose buffers have all arrived
+  int nwait = 0;
+  if (granular_recv) {
+    nwait = TestRecvEachMB();
+    if (nrecv_list == 0) {return TaskStatus::incomplete;}
+  } else if (!(TestRecv())) {
+    return TaskStatus::incomplete;
+  }
+
+  int nvar = 0;
+  for (auto &af : a) {nvar += af.extent_int(1);}
+  int voff = 0;
+  for (std::size_t f=0; f<a.size(); ++f) {
+    UnpackCC(a[f], ca[f], voff, nvar);
+    voff += a[f].extent_int(1);
+  }
+  return (nwait > 0)? TaskStatus::incomplete : TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+// \!fn void UnpackCC()
+// \brief Unpack variables of one cell-centered field from the boundary buffers, starting
+// at variable index voff of the nvar variables stored in each buffer.  Only MeshBlocks in
+// recv_list are unpacked, unless nrecv_list<0.
+
+void MeshBoundaryValuesCC::UnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+                                    const int voff, const int nvar) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -270,47 +335,21 @@ TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
   auto &rbuf = recvbuf;
   auto &is_z4c = is_z4c_;
   auto &multilevel = pmy_pack->pmesh->multilevel;
-#if MPI_PARALLEL_ENABLED
-  //----- STEP 1: check that recv boundary buffer communications have all completed
-
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) { // neighbor exists and not a physical boundary
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
-          }
-        }
-      }
-    }
-  }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
-#endif
-
-  //----- STEP 2: buffers have all completed, so unpack
-
-  int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
+  int nv = a.extent_int(1);
   auto &mblev = pmy_pack->pmb->mb_lev;
+  auto &mbgid = pmy_pack->pmb->mb_gid;
+  int my_rank = global_variable::my_rank;
+  bool use_list = (nrecv_list >= 0);
+  int nunpack = (use_list)? nrecv_list : nmb;
+  auto &rlist = recv_list;
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (nmb*nnghbr*nvar), Kokkos::AUTO);
+  // Outer loop over (# of MeshBlocks)*(# of buffers), with all variables unpacked by
+  // each team (see comments in PackCC() above)
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), (nunpack*nnghbr), Kokkos::AUTO);
   Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
+    const int l = (tmember.league_rank())/nnghbr;
+    const int n = (tmember.league_rank() - l*nnghbr);
+    const int m = (use_list)? rlist.d_view(l) : l;
 
     // only unpack buffers when neighbor exists
     if (nghbr.d_view(m,n).gid >= 0) {
@@ -345,71 +384,82 @@ TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
       int nk = ku - kl + 1;
       int nkj  = nk*nj;
 
-      // Middle loop over k,j
-      Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-        int k = idx / nj;
-        int j = (idx - k * nj) + jl;
-        k += kl;
+      const Real *pbuf = &(rbuf[n].vars(m,0));
+      // if neighbor is at same or finer level, load data directly into u0, otherwise
+      // load data into coarse_u0
+      auto &dst = (nghbr.d_view(m,n).lev >= mblev.d_view(m)) ? a : ca;
+
+      // if neighbor is at same level on this rank, copy ghost zones directly from the
+      // interior of the neighboring MeshBlock rather than through the recv buffer.  Only
+      // ghost cells are written and only active cells are read, so no race is possible.
+      if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) &&
+          (nghbr.d_view(m,n).rank == my_rank)) {
+        int sm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
+        int si = rbuf[n].isame_shift[0];
+        int sj = rbuf[n].isame_shift[1];
+        int sk = rbuf[n].isame_shift[2];
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nv*nkj),
+        [&](const int idx) {
+          int v = idx / nkj;
+          int k = (idx - v*nkj) / nj;
+          int j = (idx - v*nkj - k*nj) + jl;
+          k += kl;
 
-        // if neighbor is at same or finer level, load data directly into u0
-        if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
           Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
           [&](const int i) {
-            a(m,v,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
+            a(m,v,k,j,i) = a(sm,v,k-sk,j-sj,i-si);
           });
-          tmember.team_barrier();
+        });
+      } else {
+        // Middle loop over v,k,j
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nv*nkj),
+        [&](const int idx) {
+          int v = idx / nkj;
+          int k = (idx - v*nkj) / nj;
+          int j = (idx - v*nkj - k*nj) + jl;
+          k += kl;
+          const Real *pdat = pbuf + ni*(j-jl + nj*(k-kl + nk*(voff+v)));
 
-        // if neighbor is at coarser level, load data into coarse_u0
-        } else {
+          // Inner (vector) loop over i
           Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
           [&](const int i) {
-            ca(m,v,k,j,i) = rbuf[n].vars(m, (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
+            dst(m,v,k,j,i) = pdat[i-il];
           });
-          tmember.team_barrier();
-        }
-      });
-    }  // end if-neighbor-exists block
-  });  // end par_for_outer
+        });
+      }
 
-  // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = (tmember.league_rank())/(nnghbr*nvar);
-    const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
-    const int v = (tmember.league_rank() - m*(nnghbr*nvar) - n*nvar);
-    // only unpack buffers when neighbor exists
-    if (nghbr.d_view(m,n).gid >= 0) {
-      int il, iu, jl, ju, kl, ku;
       // If neighbor is at same level and data is for Z4c module, unpack data from coarse
       // array for higher-order prolongation
       if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) && (is_z4c) && (multilevel)) {
+        tmember.team_barrier();
         il = rbuf[n].isame_z4c.bis;
         iu = rbuf[n].isame_z4c.bie;
         jl = rbuf[n].isame_z4c.bjs;
         ju = rbuf[n].isame_z4c.bje;
         kl = rbuf[n].isame_z4c.bks;
         ku = rbuf[n].isame_z4c.bke;
-        int ni = iu - il + 1;
-        int nj = ju - jl + 1;
-        int nk = ku - kl + 1;
-        int nkj  = nk*nj;
+        ni = iu - il + 1;
+        nj = ju - jl + 1;
+        nk = ku - kl + 1;
+        nkj  = nk*nj;
         int ndat = nvar*rbuf[n].isame_ndat; // size of same level data packed in buff
 
-        // Middle loop over k,j
-        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkj), [&](const int idx) {
-          int k = idx / nj;
-          int j = (idx - k * nj) + jl;
+        Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nv*nkj),
+        [&](const int idx) {
+          int v = idx / nkj;
+          int k = (idx - v*nkj) / nj;
+          int j = (idx - v*nkj - k*nj) + jl;
           k += kl;
+          const Real *pdat = pbuf + ndat + ni*(j-jl + nj*(k-kl + nk*(voff+v)));
 
-          // load data into coarse_u0
           Kokkos::parallel_for(Kokkos::ThreadVectorRange(tmember,il,iu+1),
           [&](const int i) {
-            ca(m,v,k,j,i) = rbuf[n].vars(m,ndat + (i-il + ni*(j-jl + nj*(k-kl + nk*v))) );
+            ca(m,v,k,j,i) = pdat[i-il];
           });
-          tmember.team_barrier();
         });
       }
     }  // end if-neighbor-exists block
   });  // end par_for_outer
 
-  return TaskStatus::complete;
+  return;
 }
@@ -39,6 +39,10 @@ MeshBoundaryValuesFC::MeshBoundaryValuesFC(MeshBlockPack *pp, ParameterInput *pi
 
 TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
                                                DvceFaceFld4D<Real> &cb) {
+#if MPI_PARALLEL_ENABLED
+  // send buffers in shared memory window cannot be packed until copied by neighbors
+  if (shm_comm && !(ShmSendReleased())) return TaskStatus::incomplete;
+#endif
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -52,7 +56,7 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
 
   // Outer loop over (# of MeshBlocks)*(# of buffers)*(three field components)
   int nmnv = 3*nmb;
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("SendBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int m = tmember.league_rank()/3;
     const int v = tmember.league_rank()%3;
@@ -101,10 +105,12 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
         int dm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
         int dn = nghbr.d_view(m,n).dest;
 
-        // copy field components directly into recv buffer if MeshBlocks on same rank
+        // copy field components directly into recv buffer if MeshBlocks on same rank.
+        // Neighbors at the same level on this rank copy ghost zones directly from b0 in
+        // RecvAndUnpackFC(), so no data needs to be packed for them here
         if (nghbr.d_view(m,n).rank == my_rank) {
-          // if neighbor is at same or finer level, load data from b0
-          if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
+          // if neighbor is at finer level, load data from b0
+          if (nghbr.d_view(m,n).lev > mblev.d_view(m)) {
             Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
             [&](const int idx) {
               int k = (idx)/nji;
@@ -122,7 +128,7 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
             });
             tmember.team_barrier();
           // if neighbor is at coarser level, load data from coarse_b0
-          } else {
+          } else if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
             Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
             [&](const int idx) {
               int k = (idx)/nji;
@@ -188,7 +194,7 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
 
 #if MPI_PARALLEL_ENABLED
   // Send boundary buffer to neighboring MeshBlocks using MPI
-  Kokkos::fence();
+  TaskExeSpace().fence();
   int my_rank = global_variable::my_rank;
   auto &nghbr = pmy_pack->pmb->nghbr;
   bool no_errors=true;
@@ -199,6 +205,11 @@ TaskStatus MeshBoundaryValuesFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
         int dn = nghbr.h_view(m,n).dest;
         int drank = nghbr.h_view(m,n).rank;
         if (drank != my_rank) {
+          // neighbor on same node copies data from shared memory window
+          if (IsShmNeighbor(drank)) {
+            ShmPostSend(m,n);
+            continue;
+          }
           // create tag using local ID and buffer index of *receiving* MeshBlock
           int lid = nghbr.h_view(m,n).gid - pmy_pack->pmesh->gids_eachrank[drank];
           int tag = CreateBvals_MPI_Tag(lid, dn);
@@ -242,44 +253,31 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
   int nnghbr = pmy_pack->pmb->nnghbr;
   auto &nghbr = pmy_pack->pmb->nghbr;
   auto &rbuf = recvbuf;
-#if MPI_PARALLEL_ENABLED
   //----- STEP 1: check that recv boundary buffer communications have all completed
-
-  bool bflag = false;
-  bool no_errors=true;
-  for (int m=0; m<nmb; ++m) {
-    for (int n=0; n<nnghbr; ++n) {
-      if (nghbr.h_view(m,n).gid >= 0) { // ID != -1, so not a physical boundary
-        if (nghbr.h_view(m,n).rank != global_variable::my_rank) {
-          int test;
-          int ierr = MPI_Test(&(rbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
-          if (!(static_cast<bool>(test))) {
-            bflag = true;
-          }
-        }
-      }
-    }
+  // exit if recv boundary buffer communications have not completed.  With
+  // granular_recv, continue with MeshBlocks whose buffers have all arrived
+  int nwait = 0;
+  if (granular_recv) {
+    nwait = TestRecvEachMB();
+    if (nrecv_list == 0) {return TaskStatus::incomplete;}
+  } else if (!(TestRecv())) {
+    return TaskStatus::incomplete;
   }
-  // Quit if MPI error detected
-  if (!(no_errors)) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl << "MPI error in testing non-blocking receives"
-              << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-  // exit if recv boundary buffer communications have not completed
-  if (bflag) {return TaskStatus::incomplete;}
-#endif
 
-  //----- STEP 2: buffers have all completed, so unpack 3-components of field
+  //----- STEP 2: buffers have completed, so unpack 3-components of field
 
   auto &mblev = pmy_pack->pmb->mb_lev;
+  auto &mbgid = pmy_pack->pmb->mb_gid;
+  int my_rank = global_variable::my_rank;
+  bool use_list = (nrecv_list >= 0);
+  int nunpack = (use_list)? nrecv_list : nmb;
+  auto &rlist = recv_list;
   // Outer loop over (# of MeshBlocks)*(# of buffers)*(three field components)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), (3*nmb), Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), (3*nunpack), Kokkos::AUTO);
   Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
-    const int m = tmember.league_rank()/3;
+    const int l = tmember.league_rank()/3;
     const int v = tmember.league_rank()%3;
+    const int m = (use_list)? rlist.d_view(l) : l;
 
     // scalar loop over neighbors to prevent race condition in overlapping assignments
     for (int n=0; n<nnghbr; ++n) {
@@ -320,8 +318,33 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
         const int nkji = nk*nj*ni;
         const int nji  = nj*ni;
 
+        // if neighbor is at same level on this rank, copy ghost zones directly from the
+        // interior of the neighboring MeshBlock rather than through the recv buffer.  Only
+        // ghost faces are written and only active faces are read, so no race is possible.
+        if ((nghbr.d_view(m,n).lev == mblev.d_view(m)) &&
+            (nghbr.d_view(m,n).rank == my_rank)) {
+          int sm = nghbr.d_view(m,n).gid - mbgid.d_view(0);
+          int si = rbuf[n].isame_shift[0];
+          int sj = rbuf[n].isame_shift[1];
+          int sk = rbuf[n].isame_shift[2];
+          Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
+          [&](const int idx) {
+            int k = (idx)/nji;
+            int j = (idx - k*nji)/ni;
+            int i = (idx - k*nji - j*ni) + il;
+            k += kl;
+            j += jl;
+            if (v==0) {
+              b.x1f(m,k,j,i) = b.x1f(sm,k-sk,j-sj,i-si);
+            } else if (v==1) {
+              b.x2f(m,k,j,i) = b.x2f(sm,k-sk,j-sj,i-si);
+            } else if (v==2) {
+              b.x3f(m,k,j,i) = b.x3f(sm,k-sk,j-sj,i-si);
+            }
+          });
+          tmember.team_barrier();
         // if neighbor is at same or finer level, load data directly into b0
-        if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
+        } else if (nghbr.d_view(m,n).lev >= mblev.d_view(m)) {
           Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, nkji),
           [&](const int idx) {
             int k = (idx)/nji;
@@ -361,5 +384,5 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
     }
   });  // end par_for_outer
 
-  return TaskStatus::complete;
+  return (nwait > 0)? TaskStatus::incomplete : TaskStatus::complete;
 }
@@ -66,7 +66,7 @@ TaskStatus ParticlesBoundaryValues::SetNewPrtclGID() {
   bool &three_d = pmy_part->pmy_pack->pmesh->three_d;
 
   Kokkos::realloc(sendlist, static_cast<int>(0.1*npart));
-  par_for("part_update",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
+  par_for("part_update",TaskExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
     int m = pi(PGID,p) - gids;
     int mylevel = mblev.d_view(m);
     Real x1 = pr(IPX,p);
@@ -349,7 +349,7 @@ TaskStatus ParticlesBoundaryValues::PackAndSendPrtcls() {
     auto &pi = pmy_part->prtcl_idata;
     auto &rsendbuf = prtcl_rsendbuf;
     auto &isendbuf = prtcl_isendbuf;
-    par_for("ppack",DevExeSpace(),0,(nprtcl_send-1), KOKKOS_LAMBDA(const int n) {
+    par_for("ppack",TaskExeSpace(),0,(nprtcl_send-1), KOKKOS_LAMBDA(const int n) {
       int p = sendlist.d_view(n).prtcl_indx;
       for (int i=0; i<nidata; ++i) {
         isendbuf(nidata*n + i) = pi(i,p);
@@ -467,7 +467,7 @@ TaskStatus ParticlesBoundaryValues::RecvAndUnpackPrtcls() {
     auto &rrecvbuf = prtcl_rrecvbuf;
     auto &irecvbuf = prtcl_irecvbuf;
     int &npart = pmy_part->nprtcl_thispack;
-    par_for("punpack",DevExeSpace(),0,(nprtcl_recv-1), KOKKOS_LAMBDA(const int n) {
+    par_for("punpack",TaskExeSpace(),0,(nprtcl_recv-1), KOKKOS_LAMBDA(const int n) {
       int p;
       if (n < nprtcl_send) {
         p = sendlist.d_view(n).prtcl_indx; // place particles in holes created by sends
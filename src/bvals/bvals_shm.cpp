@@ -0,0 +1,214 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file bvals_shm.cpp
+//! \brief functions to exchange boundary buffers of Mesh variables with MeshBlocks on
+//! other ranks on the same node through an MPI-3 shared memory window, enabled with
+//! <mesh>/shm_comm=true.
+//!
+//! The send buffers of each rank are allocated inside the window.  Instead of posting a
+//! non-blocking send, the sending rank increments a counter stored next to its buffers
+//! once the buffer is packed.  The receiving rank copies the data directly from the send
+//! buffer into its receive buffer when the counter changes, and then sets a second
+//! counter to release the send buffer.  The sender only tests this counter before packing
+//! the buffer again, so ClearSend() never waits on the receiver and the order of
+//! ClearSend()/ClearRecv()/RecvAndUnpack() in task lists and initialization does not
+//! matter.  ClearRecv() waits for (and copies) data from on-node neighbors.  Each window
+//! starts with the number of MeshBlocks per buffer and the byte offset of each buffer,
+//! followed by the two counters for every buffer.
+//!
+//! Only buffers of variables are exchanged this way; flux correction and all off-node
+//! neighbors still use point-to-point messages.  Since buffers are accessed by the host,
+//! this is only possible when device memory is host-accessible (CPU builds).
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "bvals.hpp"
+
+#if MPI_PARALLEL_ENABLED
+
+namespace {
+// number of int64 values before the counters in each window
+constexpr int nhdr = 57;
+
+// counter incremented by the sender when buffer (m,n) in window at pbase is packed
+volatile std::int64_t* FilledCount(char *pbase, int m, int n) {
+  std::int64_t *phdr = reinterpret_cast<std::int64_t*>(pbase);
+  return phdr + nhdr + n*phdr[0] + m;
+}
+
+// counter set by the receiver once buffer (m,n) in window at pbase has been copied
+volatile std::int64_t* ConsumedCount(char *pbase, int m, int n) {
+  std::int64_t *phdr = reinterpret_cast<std::int64_t*>(pbase);
+  return phdr + nhdr + 56*phdr[0] + n*phdr[0] + m;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::InitShmWindow()
+//! \brief Allocates shared memory window on each node, and moves the send buffers of
+//! variables into it.  Must be called by all ranks after buffers are allocated.
+
+void MeshBoundaryValues::InitShmWindow() {
+  int nranks = global_variable::nranks;
+  int my_rank = global_variable::my_rank;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL,
+                      &comm_node);
+  int node_size;
+  MPI_Comm_size(comm_node, &node_size);
+
+  // find rank in comm_node of every rank on this node
+  MPI_Group world_group, node_group;
+  MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+  MPI_Comm_group(comm_node, &node_group);
+  std::vector<int> world_ranks(nranks);
+  for (int r=0; r<nranks; ++r) {world_ranks[r] = r;}
+  shm_node_rank.resize(nranks);
+  MPI_Group_translate_ranks(world_group, nranks, world_ranks.data(), node_group,
+                            shm_node_rank.data());
+  for (int r=0; r<nranks; ++r) {
+    if (shm_node_rank[r] == MPI_UNDEFINED) {shm_node_rank[r] = -1;}
+  }
+  MPI_Group_free(&world_group);
+  MPI_Group_free(&node_group);
+
+  // size of window: header and counters, followed by send buffers aligned to 64 bytes
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  int nmb = sendbuf[0].vars.extent_int(0);
+  std::size_t offset[56];
+  std::size_t size = (nhdr + 2*56*static_cast<std::size_t>(nmb))*sizeof(std::int64_t);
+  for (int n=0; n<nnghbr; ++n) {
+    size = 64*((size + 63)/64);
+    offset[n] = size;
+    size += sendbuf[n].vars.size()*sizeof(Real);
+  }
+  char *pbase;
+  MPI_Win_allocate_shared(static_cast<MPI_Aint>(size), 1, MPI_INFO_NULL, comm_node,
+                          &pbase, &shm_win);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, shm_win);
+
+  // initialize header and counters, and replace send buffers with views of the window
+  std::int64_t *phdr = reinterpret_cast<std::int64_t*>(pbase);
+  phdr[0] = nmb;
+  for (int n=0; n<56; ++n) {phdr[1+n] = (n < nnghbr)? offset[n] : 0;}
+  for (std::size_t i=0; i<2*56*static_cast<std::size_t>(nmb); ++i) {phdr[nhdr+i] = 0;}
+  for (int n=0; n<nnghbr; ++n) {
+    int n0 = sendbuf[n].vars.extent_int(0);
+    int n1 = sendbuf[n].vars.extent_int(1);
+    Real *pbuf = reinterpret_cast<Real*>(pbase + offset[n]);
+    sendbuf[n].vars = DvceArray2D<Real>(pbuf, n0, n1);
+  }
+  shm_recv_pending.assign(56*nmb, 0);
+
+  // get start of window on every rank in node, once all windows are initialized
+  MPI_Win_sync(shm_win);
+  MPI_Barrier(comm_node);
+  shm_base.resize(node_size);
+  for (int r=0; r<node_size; ++r) {
+    MPI_Aint wsize;
+    int disp_unit;
+    void *ptr;
+    MPI_Win_shared_query(shm_win, r, &wsize, &disp_unit, &ptr);
+    shm_base[r] = static_cast<char*>(ptr);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::FreeShmWindow()
+//! \brief Frees shared memory window.  Must be called by all ranks.
+
+void MeshBoundaryValues::FreeShmWindow() {
+  MPI_Win_unlock_all(shm_win);
+  MPI_Win_free(&shm_win);
+  MPI_Comm_free(&comm_node);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::IsShmNeighbor()
+//! \brief Returns true if data for MeshBlocks on rank is exchanged through the window
+
+bool MeshBoundaryValues::IsShmNeighbor(int rank) {
+  return (shm_comm && rank != global_variable::my_rank && shm_node_rank[rank] >= 0);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBoundaryValues::ShmPostSend()
+//! \brief Marks send buffer n of MeshBlock m as packed.  Replaces MPI_Isend for neighbors
+//! on the same node.  Packing kernels must have completed.
+
+void MeshBoundaryValues::ShmPostSend(int m, int n) {
+  char *pbase = shm_base[shm_node_rank[global_variable::my_rank]];
+  // complete writes to buffer before incrementing counter
+  MPI_Win_sync(shm_win);
+  *FilledCount(pbase, m, n) += 1;
+  MPI_Win_sync(shm_win);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::ShmTestRecv()
+//! \brief Replaces MPI_Test for receive buffer n of MeshBlock m when neighbor is on the
+//! same node.  If the sender has packed its buffer, copies the data into the receive
+//! buffer and releases the send buffer.  Returns true once data has been received.
+
+bool MeshBoundaryValues::ShmTestRecv(int m, int n) {
+  int nmb = sendbuf[0].vars.extent_int(0);
+  int &pending = shm_recv_pending[n*nmb + m];
+  if (pending == 0) return true;
+
+  // location of send buffer of neighbor, which uses the index of this MeshBlock in its
+  // list of neighbors as buffer index
+  auto &nb = pmy_pack->pmb->nghbr.h_view(m,n);
+  char *pbase = shm_base[shm_node_rank[nb.rank]];
+  int sm = nb.gid - pmy_pack->pmesh->gids_eachrank[nb.rank];
+  int sn = nb.dest;
+
+  MPI_Win_sync(shm_win);
+  std::int64_t filled = *FilledCount(pbase, sm, sn);
+  volatile std::int64_t *pconsumed = ConsumedCount(pbase, sm, sn);
+  if (filled == *pconsumed) return false;
+
+  std::int64_t *phdr = reinterpret_cast<std::int64_t*>(pbase);
+  const Real *psrc = reinterpret_cast<const Real*>(pbase + phdr[1+sn]) +
+                     static_cast<std::size_t>(sm)*sendbuf[sn].vars.extent(1);
+  std::memcpy(&(recvbuf[n].vars(m,0)), psrc, pending*sizeof(Real));
+  pending = 0;
+  // complete reads of buffer before releasing it to sender
+  MPI_Win_sync(shm_win);
+  *pconsumed = filled;
+  MPI_Win_sync(shm_win);
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool MeshBoundaryValues::ShmSendReleased()
+//! \brief Returns true when every send buffer exchanged with a neighbor on the same node
+//! has been copied by that neighbor, so the buffers can be packed again.  Replaces
+//! MPI_Wait on the previous send, but is only tested before the next pack.
+
+bool MeshBoundaryValues::ShmSendReleased() {
+  char *pbase = shm_base[shm_node_rank[global_variable::my_rank]];
+  int &nmb = pmy_pack->nmb_thispack;
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  MPI_Win_sync(shm_win);
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if (*ConsumedCount(pbase, m, n) != *FilledCount(pbase, m, n)) return false;
+    }
+  }
+  return true;
+}
+
+#endif
@@ -62,6 +62,12 @@ TaskStatus MeshBoundaryValues::InitRecv(const int nvars) {
           }
           auto recv_ptr = Kokkos::subview(recvbuf[n].vars, m, Kokkos::ALL);
 
+          // data from ranks on same node is copied from shared memory window
+          if (IsShmNeighbor(drank)) {
+            shm_recv_pending[n*(sendbuf[0].vars.extent_int(0)) + m] = data_size;
+            continue;
+          }
+
           // Post non-blocking receive for this buffer on this MeshBlock
           int ierr = MPI_Irecv(recv_ptr.data(), data_size, MPI_ATHENA_REAL, drank, tag,
                                comm_vars, &(recvbuf[n].vars_req[m]));
@@ -97,6 +103,11 @@ TaskStatus MeshBoundaryValues::ClearRecv() {
     for (int n=0; n<nnghbr; ++n) {
       if ( (nghbr.h_view(m,n).gid >= 0) &&
            (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+        // copy data from shared memory window once packed by neighbor on same node
+        if (IsShmNeighbor(nghbr.h_view(m,n).rank)) {
+          while (!(ShmTestRecv(m,n))) {}
+          continue;
+        }
         int ierr = MPI_Wait(&(recvbuf[n].vars_req[m]), MPI_STATUS_IGNORE);
         if (ierr != MPI_SUCCESS) {no_errors=false;}
       }
@@ -112,6 +123,116 @@ TaskStatus MeshBoundaryValues::ClearRecv() {
   return TaskStatus::complete;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  bool MeshBoundaryValues::TestRecv
+//! \brief Tests non-blocking receives for vars of all MeshBlocks.  Returns true once all
+//! receives have completed (always true without MPI).
+
+bool MeshBoundaryValues::TestRecv() {
+  bool bflag = true;
+#if MPI_PARALLEL_ENABLED
+  int &nmb = pmy_pack->nmb_thispack;
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  bool no_errors=true;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      if ( (nghbr.h_view(m,n).gid >= 0) &&
+           (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+        if (IsShmNeighbor(nghbr.h_view(m,n).rank)) {
+          if (!(ShmTestRecv(m,n))) {bflag = false;}
+          continue;
+        }
+        int test;
+        int ierr = MPI_Test(&(recvbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
+        if (ierr != MPI_SUCCESS) {no_errors=false;}
+        if (!(static_cast<bool>(test))) {bflag = false;}
+      }
+    }
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI error in testing non-blocking receives"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#endif
+  return bflag;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  int MeshBoundaryValues::TestRecvEachMB
+//! \brief Used with granular_recv.  Tests non-blocking receives for vars of each
+//! MeshBlock not yet unpacked in the current exchange, and stores the MeshBlocks whose
+//! receives have all completed in recv_list.  If every MeshBlock becomes ready in the
+//! same call, nrecv_list is set to -1 so the pack is unpacked as a whole without copying
+//! the list to the device.  Returns number of MeshBlocks still waiting for messages.
+
+int MeshBoundaryValues::TestRecvEachMB() {
+  int &nmb = pmy_pack->nmb_thispack;
+  int nready = 0, nwait = 0, nprev = 0;
+#if MPI_PARALLEL_ENABLED
+  int &nnghbr = pmy_pack->pmb->nnghbr;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  bool no_errors=true;
+#endif
+  for (int m=0; m<nmb; ++m) {
+    if (recv_done[m] != 0) {
+      nprev++;
+      continue;
+    }
+    bool arrived = true;
+#if MPI_PARALLEL_ENABLED
+    for (int n=0; n<nnghbr; ++n) {
+      if ( (nghbr.h_view(m,n).gid >= 0) &&
+           (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+        if (IsShmNeighbor(nghbr.h_view(m,n).rank)) {
+          if (!(ShmTestRecv(m,n))) {arrived = false;}
+          continue;
+        }
+        int test;
+        int ierr = MPI_Test(&(recvbuf[n].vars_req[m]), &test, MPI_STATUS_IGNORE);
+        if (ierr != MPI_SUCCESS) {no_errors=false;}
+        if (!(static_cast<bool>(test))) {arrived = false;}
+      }
+    }
+#endif
+    if (arrived) {
+      recv_list.h_view(nready++) = m;
+    } else {
+      nwait++;
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "MPI error in testing non-blocking receives"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#endif
+
+  if (nwait == 0) {
+    // exchange complete, so reset flags for the next one
+    for (int m=0; m<nmb; ++m) {recv_done[m] = 0;}
+    if (nprev == 0) {
+      nrecv_list = -1;
+      return 0;
+    }
+  } else {
+    for (int i=0; i<nready; ++i) {recv_done[recv_list.h_view(i)] = 1;}
+    nmb_early_unpack += nready;
+  }
+  nrecv_list = nready;
+  if (nready > 0) {
+    recv_list.template modify<HostMemSpace>();
+    recv_list.template sync<DevExeSpace>();
+  }
+  return nwait;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn  void MeshBoundaryValues::ClearSend
 //! \brief Waits for all MPI sends associated with communcation of boundary variables
@@ -129,6 +250,9 @@ TaskStatus MeshBoundaryValues::ClearSend() {
     for (int n=0; n<nnghbr; ++n) {
       if ( (nghbr.h_view(m,n).gid >= 0) &&
            (nghbr.h_view(m,n).rank != global_variable::my_rank) ) {
+        // buffers in shared memory are released by the neighbor, which is tested before
+        // they are packed again
+        if (IsShmNeighbor(nghbr.h_view(m,n).rank)) continue;
         int ierr = MPI_Wait(&(sendbuf[n].vars_req[m]), MPI_STATUS_IGNORE);
         if (ierr != MPI_SUCCESS) {no_errors=false;}
       }
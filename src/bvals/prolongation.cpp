@@ -59,7 +59,7 @@ void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
     auto &cjs = indcs.cjs;
     auto &cks = indcs.cks;
     // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-    Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+    Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmnv, Kokkos::AUTO);
     Kokkos::parallel_for("ProlCCSame", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
       const int m = (tmember.league_rank())/(nnghbr*nvar);
       const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
@@ -155,7 +155,7 @@ void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real>
   auto& prolong_4th = pmy_pack->pmesh->pmr->weights.prolong_4th;
 
   // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("ProlCC", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int m = (tmember.league_rank())/(nnghbr*nvar);
     const int n = (tmember.league_rank() - m*(nnghbr*nvar))/nvar;
@@ -238,7 +238,7 @@ void MeshBoundaryValuesFC::FillCoarseInBndryFC(DvceFaceFld4D<Real> &b,
     auto &cjs = indcs.cjs;
     auto &cks = indcs.cks;
     // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
-    Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+    Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmnv, Kokkos::AUTO);
     Kokkos::parallel_for("ProlFCSame", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
       const int m = (tmember.league_rank())/(3*nnghbr);
       const int n = (tmember.league_rank() - m*(3*nnghbr))/3;
@@ -330,7 +330,7 @@ void MeshBoundaryValuesFC::ProlongateFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
   // Outer loop over (# of MeshBlocks)*(# of buffers)*(three field components)
   {int nmnv = 3*nmb*nnghbr;
   auto &rbuf = recvbuf;
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("ProFC-2d-shared", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int m = (tmember.league_rank())/(3*nnghbr);
     const int n = (tmember.league_rank() - m*(3*nnghbr))/3;
@@ -385,7 +385,7 @@ void MeshBoundaryValuesFC::ProlongateFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
   {int nmn = nmb*nnghbr;
   bool &one_d = pmy_pack->pmesh->one_d;
   auto &rbuf = recvbuf;
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmn, Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmn, Kokkos::AUTO);
   Kokkos::parallel_for("ProFC-2d-int", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int m = (tmember.league_rank())/(nnghbr);
     const int n = (tmember.league_rank() - m*(nnghbr));
@@ -23,7 +23,8 @@
 Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
     pmy_pack(ppack),
     excision_floor("excision_floor",1,1,1,1),
-    excision_flux("excision_flux",1,1,1,1) {
+    excision_flux("excision_flux",1,1,1,1),
+    excision_mb("excision_mb",1) {
   // Check for relativistic dynamics
   // WGC: idea for handling new EOS
   is_dynamical_relativistic = (pin->DoesBlockExist("adm") || pin->DoesBlockExist("z4c"))
@@ -86,8 +87,10 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
       Kokkos::realloc(excision_floor, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(excision_flux, nmb, ncells3, ncells2, ncells1);
+      Kokkos::realloc(excision_mb, nmb);
       if (coord_data.excision_scheme == ExcisionScheme::fixed) {
         SetExcisionMasks(excision_floor, excision_flux);
+        SetExcisionMeshBlockFlags();
       }
     }
   }
@@ -111,7 +114,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
   int nmb1 = pmy_pack->nmb_thispack - 1;
-  par_for("coord_src", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  par_for("coord_src", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Extract components of metric
     Real &x1min = size.d_view(m).x1min;
@@ -234,7 +237,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
   int nmb1 = pmy_pack->nmb_thispack - 1;
-  par_for("coord_src", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  par_for("coord_src", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Extract components of metric
     Real &x1min = size.d_view(m).x1min;
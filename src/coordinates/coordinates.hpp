@@ -63,6 +63,7 @@ class Coordinates {
   // excision masks
   DvceArray4D<bool> excision_floor;  // cell-centered mask for C2P flooring about horizon
   DvceArray4D<bool> excision_flux;   // cell-centered mask for FOFC about horizon
+  DvceArray1D<bool> excision_mb;     // true if any cell of MeshBlock is masked
 
   // functions
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const EOS_Data &eos, const Real dt,
@@ -71,6 +72,7 @@ class Coordinates {
                      const EOS_Data &eos, const Real dt, DvceArray5D<Real> &u0);
   void SetExcisionMasks(DvceArray4D<bool> &floor, DvceArray4D<bool> &flux);
 
+  void SetExcisionMeshBlockFlags();
   void UpdateExcisionMasks();
 
  private:
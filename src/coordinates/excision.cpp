@@ -166,6 +166,50 @@ void Coordinates::SetExcisionMasks(DvceArray4D<bool> &excision_floor,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetExcisionMeshBlockFlags()
+//  \brief Sets excision_mb flag for each MeshBlock if any cell (including ghost zones) is
+//  masked in either excision_floor or excision_flux.  Kernels use this flag to skip reads
+//  of the cell-centered masks in MeshBlocks far from the horizon.
+
+void Coordinates::SetExcisionMeshBlockFlags() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  const int nkji = n3*n2*n1;
+  const int nji  = n2*n1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto &floor = excision_floor;
+  auto &flux = excision_flux;
+  auto &flag = excision_mb;
+
+  par_for_outer("excision_mb",DevExeSpace(), 0, 0, 0, nmb1,
+  KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
+    int team_any = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+    [=](const int idx, int &any) {
+      int k = (idx)/nji;
+      int j = (idx - k*nji)/n1;
+      int i = (idx - k*nji - j*n1);
+      if (floor(m,k,j,i) || flux(m,k,j,i)) {any = 1;}
+    },Kokkos::Max<int>(team_any));
+    Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+      flag(m) = (team_any > 0);
+    });
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::UpdateExcisionMasks()
+//  \brief Updates masks for lapse-based excision.  The minimum lapse is first computed in
+//  each MeshBlock, and masks are only rewritten in MeshBlocks that contain cells below
+//  the excision threshold, or that contained excised cells at the previous update (so
+//  their masks can be cleared).  All other MeshBlocks have no masked cells, and are left
+//  untouched.
+
 void Coordinates::UpdateExcisionMasks() {
   if (coord_data.excision_scheme == ExcisionScheme::lapse) {
     // capture variables for kernel
@@ -174,18 +218,42 @@ void Coordinates::UpdateExcisionMasks() {
     int n1 = indcs.nx1 + 2*ng;
     int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
     int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+    const int nkji = n3*n2*n1;
+    const int nji  = n2*n1;
     int nmb1 = pmy_pack->nmb_thispack - 1;
     auto &adm = pmy_pack->padm->adm;
     auto &floor = excision_floor;
     auto &flux = excision_flux;
+    auto &flag = excision_mb;
 
     Real &excise_lapse = coord_data.excise_lapse;
 
-    par_for("set_excision", DevExeSpace(), 0, nmb1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
-    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-      bool excise = (adm.alpha(m,k,j,i) < excise_lapse);
-      floor(m,k,j,i) = excise;
-      flux(m,k,j,i) = excise;
+    par_for_outer("set_excision",TaskExeSpace(), 0, 0, 0, nmb1,
+    KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
+      Real team_amin = FLT_MAX;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+      [=](const int idx, Real &amin) {
+        int k = (idx)/nji;
+        int j = (idx - k*nji)/n1;
+        int i = (idx - k*nji - j*n1);
+        amin = fmin(adm.alpha(m,k,j,i), amin);
+      },Kokkos::Min<Real>(team_amin));
+
+      bool excise_mb = (team_amin < excise_lapse);
+      if (excise_mb || flag(m)) {
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(tmember, nkji), [&](const int idx) {
+          int k = (idx)/nji;
+          int j = (idx - k*nji)/n1;
+          int i = (idx - k*nji - j*n1);
+          bool excise = (adm.alpha(m,k,j,i) < excise_lapse);
+          floor(m,k,j,i) = excise;
+          flux(m,k,j,i) = excise;
+        });
+      }
+      tmember.team_barrier();
+      Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+        flag(m) = excise_mb;
+      });
     });
   }
 }
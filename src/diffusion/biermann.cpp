@@ -132,7 +132,7 @@ void BiermannBattery::BiermannEField(const DvceArray5D<Real> &w0, const EOS_Data
   }
 
   if (pmy_pack->pmesh->two_d) {
-    par_for("biermann_e1_2d", DevExeSpace(), 0, nmb1, js, je+1, is, ie+1,
+    par_for("biermann_e1_2d", TaskExeSpace(), 0, nmb1, js, je+1, is, ie+1,
     KOKKOS_LAMBDA(const int m, const int j, const int i) {
       Real e1c0, e2c0, e3c0;
       Real e1c1, e2c1, e3c1;
@@ -145,7 +145,7 @@ void BiermannBattery::BiermannEField(const DvceArray5D<Real> &w0, const EOS_Data
       e1(m,ke+1,j,i) += e1edge;
     });
 
-    par_for("biermann_e2_2d", DevExeSpace(), 0, nmb1, js, je, is, ie+1,
+    par_for("biermann_e2_2d", TaskExeSpace(), 0, nmb1, js, je, is, ie+1,
     KOKKOS_LAMBDA(const int m, const int j, const int i) {
       Real e1c0, e2c0, e3c0;
       Real e1c1, e2c1, e3c1;
@@ -160,7 +160,7 @@ void BiermannBattery::BiermannEField(const DvceArray5D<Real> &w0, const EOS_Data
     return;
   }
 
-  par_for("biermann_e1_3d", DevExeSpace(), 0, nmb1, ks, ke+1, js, je+1, is, ie+1,
+  par_for("biermann_e1_3d", TaskExeSpace(), 0, nmb1, ks, ke+1, js, je+1, is, ie+1,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real e1c00, e2tmp, e3tmp;
     Real e1c10, e1c01, e1c11;
@@ -175,7 +175,7 @@ void BiermannBattery::BiermannEField(const DvceArray5D<Real> &w0, const EOS_Data
     e1(m,k,j,i) += 0.25*(e1c00 + e1c10 + e1c01 + e1c11);
   });
 
-  par_for("biermann_e2_3d", DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie+1,
+  par_for("biermann_e2_3d", TaskExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie+1,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real e2c00, e1tmp, e3tmp;
     Real e2c10, e2c01, e2c11;
@@ -190,7 +190,7 @@ void BiermannBattery::BiermannEField(const DvceArray5D<Real> &w0, const EOS_Data
     e2(m,k,j,i) += 0.25*(e2c00 + e2c10 + e2c01 + e2c11);
   });
 
-  par_for("biermann_e3_3d", DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie+1,
+  par_for("biermann_e3_3d", TaskExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie+1,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real e3c00, e1tmp, e2tmp;
     Real e3c10, e3c01, e3c11;
@@ -241,7 +241,7 @@ void BiermannBattery::BiermannEnergyFlux(const DvceArray5D<Real> &w0, const EOS_
 
   //------------------------------
   // energy fluxes in x1-direction
-  par_for("biermann_heat1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
+  par_for("biermann_heat1", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real e1l, e2l, e3l;
     Real e1r, e2r, e3r;
@@ -264,7 +264,7 @@ void BiermannBattery::BiermannEnergyFlux(const DvceArray5D<Real> &w0, const EOS_
 
   //------------------------------
   // energy fluxes in x2-direction
-  par_for("biermann_heat2", DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
+  par_for("biermann_heat2", TaskExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real e1l, e2l, e3l;
     Real e1r, e2r, e3r;
@@ -290,7 +290,7 @@ void BiermannBattery::BiermannEnergyFlux(const DvceArray5D<Real> &w0, const EOS_
 
   //------------------------------
   // energy fluxes in x3-direction
-  par_for("biermann_heat3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
+  par_for("biermann_heat3", TaskExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real e1l, e2l, e3l;
     Real e1r, e2r, e3r;
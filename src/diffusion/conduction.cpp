@@ -125,7 +125,7 @@ void Conduction::IsotropicHeatFlux(const DvceArray5D<Real> &w0, const EOS_Data &
 
   auto &flx1 = flx.x1f;
 
-  par_for("conduct1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
+  par_for("conduct1", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Add heat fluxes into fluxes of conserved variables: energy
     Real dtempdx = 0.0;
@@ -144,7 +144,7 @@ void Conduction::IsotropicHeatFlux(const DvceArray5D<Real> &w0, const EOS_Data &
 
   auto &flx2 = flx.x2f;
 
-  par_for("conduct2",DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
+  par_for("conduct2",TaskExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Add heat fluxes into fluxes of conserved variables: energy
     Real dtempdx = 0.0;
@@ -163,7 +163,7 @@ void Conduction::IsotropicHeatFlux(const DvceArray5D<Real> &w0, const EOS_Data &
 
   auto &flx3 = flx.x3f;
 
-  par_for("conduct3",DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
+  par_for("conduct3",TaskExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Add heat fluxes into fluxes of conserved variables: energy
     Real dtempdx = 0.0;
@@ -207,7 +207,7 @@ void Conduction::TempDependentHeatFlux(const DvceArray5D<Real> &w0, const EOS_Da
 
   auto &flx1 = flx.x1f;
 
-  par_for("conduct1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
+  par_for("conduct1", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Add heat fluxes into fluxes of conserved variables: energy
     Real temp_l = 0.0, temp_r = 0.0, pres_l = 0.0, pres_r = 0.0;
@@ -274,7 +274,7 @@ void Conduction::TempDependentHeatFlux(const DvceArray5D<Real> &w0, const EOS_Da
 
   auto &flx2 = flx.x2f;
 
-  par_for("conduct2",DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
+  par_for("conduct2",TaskExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Add heat fluxes into fluxes of conserved variables: energy
     Real temp_l = 0.0, temp_r = 0.0, pres_l = 0.0, pres_r = 0.0;
@@ -339,7 +339,7 @@ void Conduction::TempDependentHeatFlux(const DvceArray5D<Real> &w0, const EOS_Da
 
   auto &flx3 = flx.x3f;
 
-  par_for("conduct3",DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
+  par_for("conduct3",TaskExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Add heat fluxes into fluxes of conserved variables: energy
     Real temp_l = 0.0, temp_r = 0.0, pres_l = 0.0, pres_r = 0.0;
@@ -440,7 +440,7 @@ void Conduction::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
   dtnew = static_cast<Real>(std::numeric_limits<float>::max());
 
   // find smallest timestep for thermal conduction in each cell
-  Kokkos::parallel_reduce("cond_newdt", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("cond_newdt", Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
   KOKKOS_LAMBDA(const int &idx, Real &min_dt) {
     // compute m,k,j,i indices of thread and call function
     int m = (idx)/nkji;
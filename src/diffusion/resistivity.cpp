@@ -79,7 +79,7 @@ void Resistivity::OhmicEField(const DvceFaceFld4D<Real> &b0, DvceEdgeFld4D<Real>
     int scr_level = 0;
     size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1) * 3;
 
-    par_for_outer("ohm1", DevExeSpace(), scr_size, scr_level, 0, nmb1,
+    par_for_outer("ohm1", TaskExeSpace(), scr_size, scr_level, 0, nmb1,
     KOKKOS_LAMBDA(TeamMember_t member, const int m) {
       ScrArray1D<Real> j1(member.team_scratch(scr_level), ncells1);
       ScrArray1D<Real> j2(member.team_scratch(scr_level), ncells1);
@@ -110,7 +110,7 @@ void Resistivity::OhmicEField(const DvceFaceFld4D<Real> &b0, DvceEdgeFld4D<Real>
     int scr_level = 0;
     size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1) * 3;
 
-    par_for_outer("ohm2", DevExeSpace(), scr_size, scr_level, 0, nmb1, js, je+1,
+    par_for_outer("ohm2", TaskExeSpace(), scr_size, scr_level, 0, nmb1, js, je+1,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
       ScrArray1D<Real> j1(member.team_scratch(scr_level), ncells1);
       ScrArray1D<Real> j2(member.team_scratch(scr_level), ncells1);
@@ -142,7 +142,7 @@ void Resistivity::OhmicEField(const DvceFaceFld4D<Real> &b0, DvceEdgeFld4D<Real>
   int scr_level = 0;
   size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1) * 3;
 
-  par_for_outer("ohm3", DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke+1, js, je+1,
+  par_for_outer("ohm3", TaskExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke+1, js, je+1,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
     ScrArray1D<Real> j1(member.team_scratch(scr_level), ncells1);
     ScrArray1D<Real> j2(member.team_scratch(scr_level), ncells1);
@@ -183,7 +183,7 @@ void Resistivity::OhmicEnergyFlux(const DvceFaceFld4D<Real> &b,
   // energy fluxes in x1-direction
 
   auto &flx1 = flx.x1f;
-  par_for("ohm_heat1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
+  par_for("ohm_heat1", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real j2k   = -(b.x3f(m,k  ,j,i) - b.x3f(m,k  ,j,i-1))/size.d_view(m).dx1;
     Real j2kp1 = -(b.x3f(m,k+1,j,i) - b.x3f(m,k+1,j,i-1))/size.d_view(m).dx1;
@@ -212,7 +212,7 @@ void Resistivity::OhmicEnergyFlux(const DvceFaceFld4D<Real> &b,
   // energy fluxes in x2-direction
 
   auto &flx2 = flx.x2f;
-  par_for("ohm_heat2", DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
+  par_for("ohm_heat2", TaskExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real j1k   = (b.x3f(m,k  ,j,i) - b.x3f(m,k  ,j-1,i))/size.d_view(m).dx2;
     Real j1kp1 = (b.x3f(m,k+1,j,i) - b.x3f(m,k+1,j-1,i))/size.d_view(m).dx2;
@@ -239,7 +239,7 @@ void Resistivity::OhmicEnergyFlux(const DvceFaceFld4D<Real> &b,
   // energy fluxes in x3-direction
 
   auto &flx3 = flx.x3f;
-  par_for("ohm_heat3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
+  par_for("ohm_heat3", TaskExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real j1j   = (b.x3f(m,k,j  ,i) - b.x3f(m,k  ,j-1,i))/size.d_view(m).dx2
                - (b.x2f(m,k,j  ,i) - b.x2f(m,k-1,j  ,i))/size.d_view(m).dx3;
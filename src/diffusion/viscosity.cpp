@@ -79,7 +79,7 @@ void Viscosity::IsotropicViscousFlux(const DvceArray5D<Real> &w0, const Real nu_
   size_t scr_size = (ScrArray1D<Real>::shmem_size(ncells1)) * 3;
   auto flx1 = flx.x1f;
 
-  par_for_outer("visc1",DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke, js, je,
+  par_for_outer("visc1",TaskExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke, js, je,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
     ScrArray1D<Real> fvx(member.team_scratch(scr_level), ncells1);
     ScrArray1D<Real> fvy(member.team_scratch(scr_level), ncells1);
@@ -132,7 +132,7 @@ void Viscosity::IsotropicViscousFlux(const DvceArray5D<Real> &w0, const Real nu_
 
   auto flx2 = flx.x2f;
 
-  par_for_outer("visc2",DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke, js, je+1,
+  par_for_outer("visc2",TaskExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke, js, je+1,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
     ScrArray1D<Real> fvx(member.team_scratch(scr_level), ncells1);
     ScrArray1D<Real> fvy(member.team_scratch(scr_level), ncells1);
@@ -179,7 +179,7 @@ void Viscosity::IsotropicViscousFlux(const DvceArray5D<Real> &w0, const Real nu_
 
   auto flx3 = flx.x3f;
 
-  par_for_outer("visc3",DevExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke+1, js, je,
+  par_for_outer("visc3",TaskExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke+1, js, je,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
     ScrArray1D<Real> fvx(member.team_scratch(scr_level), ncells1);
     ScrArray1D<Real> fvy(member.team_scratch(scr_level), ncells1);
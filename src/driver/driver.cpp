@@ -10,12 +10,16 @@
 #include <iomanip>    // std::setprecision()
 #include <limits>
 #include <algorithm>
+#include <cstdint>
 #include <string> // string
 
 #include "athena.hpp"
 #include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
+#include "coordinates/coordinates.hpp"
+#include "srcterms/srcterms.hpp"
+#include "pgen/pgen.hpp"
 #include "outputs/outputs.hpp"
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
@@ -23,6 +27,7 @@
 #include "dyn_grmhd/dyn_grmhd.hpp"
 #include "ion-neutral/ion-neutral.hpp"
 #include "radiation/radiation.hpp"
+#include "radiation_m1/radiation_m1.hpp"
 #include "driver.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -59,8 +64,10 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
   tlim(-1.0),
   nlim(-1),
   ndiag(1),
+  deep_halo(false),
   nmb_updated_(0),
   npart_updated_(0),
+  nmb_frozen_(0),
   lb_efficiency_(0),
   pwall_clock_(ptimer),
   wall_time(wtlim),
@@ -109,6 +116,33 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
       gam0[1] = 0.5;
       gam1[1] = 0.5;
       beta[1] = 0.5;
+    } else if (integrator == "vl2") {
+      // VL2: single-stage, second-order MUSCL-Hancock scheme (Toro (2009), sec 14.4).
+      // Primitives are predicted at the half step from limited PLM slopes in
+      // Hydro/MHD::HancockPredictor(), and the increment is added to the L/R states, so
+      // one exchange, ConToPrim and flux pass are needed per step.
+      if ((pmesh->pmb_pack->phydro == nullptr && pmesh->pmb_pack->pmhd == nullptr) ||
+          pmesh->pmb_pack->padm != nullptr || pmesh->pmb_pack->prad != nullptr ||
+          pmesh->pmb_pack->prm1 != nullptr || pmesh->pmb_pack->pionn != nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "integrator=vl2 can only be used with Newtonian "
+                  << "hydro and/or MHD" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      nimp_stages = 0;
+      nexp_stages = 1;
+      // unsplit update without transverse (corner) terms is stable for CFL <= 1/ndim
+      cfl_limit = 1.0;
+      if (pmesh->multi_d) {cfl_limit = 0.5;}
+      if (pmesh->three_d) {cfl_limit = 1.0/3.0;}
+      if (pmesh->cfl_no > cfl_limit && global_variable::my_rank == 0) {
+        std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                  << "<time>/cfl_number=" << pmesh->cfl_no << " exceeds stability limit "
+                  << cfl_limit << " of vl2 integrator" << std::endl;
+      }
+      gam0[0] = 0.0;
+      gam1[0] = 1.0;
+      beta[0] = 1.0;
     } else if (integrator == "rk3") {
       // SSPRK (3,3): Gottlieb (2009) equation 3.2
       // Optimal (in error bounds) explicit three-stage, third-order SSPRK
@@ -258,7 +292,16 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
     } else {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
          << std::endl << "integrator=" << integrator << " not implemented. "
-         << "Valid choices are [rk1,rk2,rk3,imex2,imex3]." << std::endl;
+         << "Valid choices are [rk1,rk2,vl2,rk3,rk4,imex2,imex3,imex+]." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+
+    // optionally exchange ghost zones only once per step (explicit integrators only)
+    deep_halo = pin->GetOrAddBoolean("time", "deep_halo", false);
+    if (deep_halo && (nimp_stages > 0)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "<time>/deep_halo cannot be used with ImEx integrator="
+         << integrator << std::endl;
       exit(EXIT_FAILURE);
     }
   }
@@ -286,6 +329,8 @@ void Driver::ExecuteTaskList(Mesh *pm, std::string tl, int stage) {
       }
     }
   }
+  // tasks may have run on separate execution space instances, wait for all to complete
+  if (exec_instances::Size() > 0) {exec_instances::FenceAll();}
   return;
 }
 
@@ -298,10 +343,16 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
   //---- Step 1.  Set conserved variables in ghost zones for all physics
   InitBoundaryValuesAndPrimitives(pmesh);
 
+  // select MeshBlocks evolved with reduced angular resolution (if enabled)
+  if (pmesh->pmb_pack->prad != nullptr) {
+    pmesh->pmb_pack->prad->SelectAngularResolution();
+  }
+
   //---- Step 2.  Compute time step (if problem involves time evolution)
   hydro::Hydro *phydro = pmesh->pmb_pack->phydro;
   mhd::MHD *pmhd = pmesh->pmb_pack->pmhd;
   radiation::Radiation *prad = pmesh->pmb_pack->prad;
+  radiation_m1::RadiationM1 *prm1 = pmesh->pmb_pack->prm1;
   z4c::Z4c *pz4c = pmesh->pmb_pack->pz4c;
   if (time_evolution != TimeEvolution::tstatic) {
     if (phydro != nullptr) {
@@ -313,6 +364,9 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
     if (prad != nullptr) {
       (void) pmesh->pmb_pack->prad->NewTimeStep(this, nexp_stages);
     }
+    if (prm1 != nullptr) {
+      (void) pmesh->pmb_pack->prm1->NewTimeStep(this, nexp_stages);
+    }
     if (pz4c != nullptr) {
       (void) pmesh->pmb_pack->pz4c->NewTimeStep(this, nexp_stages);
     }
@@ -331,6 +385,7 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
   //---- Step 4.  Initialize various counters, timers, etc.
   run_time_.reset();
   nmb_updated_ = 0;
+  nmb_frozen_ = 0;
 
   // allocate memory for stiff source terms with ImEx integrators
   // only implemented for ion-neutral two fluid for now
@@ -350,6 +405,9 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
     Kokkos::realloc(impl_src, nimp_stages, nmb, 8, ncells3, ncells2, ncells1);
   }
 
+  // check that all physics supports deep-halo integration, and report its cost
+  if (deep_halo) {CheckDeepHalo(pmesh);}
+
   return;
 }
 
@@ -396,6 +454,9 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       pmesh->ncycle++;
       nmb_updated_ += pmesh->nmb_total;
       npart_updated_ += pmesh->nprtcl_total;
+      if (pmesh->pmact != nullptr) {
+        nmb_frozen_ += pmesh->nmb_total - pmesh->pmact->nmb_active;
+      }
       // load balancing efficiency
       if (global_variable::nranks > 1) {
         int minnmb = std::numeric_limits<int>::max();
@@ -423,6 +484,8 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 
       // AMR
       if (pmesh->adaptive) {pmesh->pmr->AdaptiveMeshRefinement(this, pin);}
+      // freeze/unfreeze MeshBlocks, which sets MeshBlocks used to compute timestep
+      if (pmesh->pmact != nullptr) {pmesh->pmact->UpdateActivity(this);}
       // compute new timestep AFTER all Meshblocks refined/derefined
       pmesh->NewTimeStep(tlim);
 
@@ -456,12 +519,27 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
   float exe_time = run_time_.seconds();
 
   if (time_evolution != TimeEvolution::tstatic) {
+    // With granular_recv, count MeshBlocks of hydro/MHD whose ghost zones were unpacked
+    // while receives of other MeshBlocks in the pack were still pending
+    bool granular_recv = pin->GetOrAddBoolean("mesh","granular_recv",false);
+    std::int64_t nmb_early_unpack = 0;
+    if (pmesh->pmb_pack->phydro != nullptr) {
+      nmb_early_unpack += pmesh->pmb_pack->phydro->pbval_u->nmb_early_unpack;
+    }
+    if (pmesh->pmb_pack->pmhd != nullptr) {
+      nmb_early_unpack += pmesh->pmb_pack->pmhd->pbval_u->nmb_early_unpack;
+      nmb_early_unpack += pmesh->pmb_pack->pmhd->pbval_b->nmb_early_unpack;
+    }
 #if MPI_PARALLEL_ENABLED
     // Collect number of MeshBlocks communicated during load balancing across all ranks
     if (pmesh->adaptive) {
       MPI_Allreduce(MPI_IN_PLACE, &(pmesh->pmr->nmb_sent_thisrank), 1, MPI_INT, MPI_SUM,
                     MPI_COMM_WORLD);
     }
+    if (granular_recv) {
+      MPI_Allreduce(MPI_IN_PLACE, &nmb_early_unpack, 1, MPI_INT64_T, MPI_SUM,
+                    MPI_COMM_WORLD);
+    }
 #endif
     if (global_variable::my_rank == 0) {
       // Print diagnostic messages related to the end of the simulation
@@ -486,6 +564,14 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
           <<"load balancing efficiency = " << (lb_efficiency_/pmesh->ncycle) << std::endl;
 #endif
       }
+      if (pmesh->pmact != nullptr) {
+        std::cout << std::endl << nmb_frozen_ << " MeshBlock-cycles frozen by "
+          << "<mesh_activity>" << std::endl;
+      }
+      if (granular_recv) {
+        std::cout << std::endl << nmb_early_unpack << " MeshBlocks unpacked while "
+          << "receives were pending" << std::endl;
+      }
 
       // Calculate and print the zone-cycles/cpu-second
       // Note the need for 64-bit integers since nmb_updated can easily exceed 2^32.
@@ -503,6 +589,80 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn Driver::CheckDeepHalo()
+//! \brief With <time>/deep_halo=true, ghost zones are exchanged only in the last stage of
+//! each step, and the earlier stages redundantly update a halo of ghost cells that
+//! shrinks by the width of the spatial stencil each stage (see Driver::HaloWidth()).
+//! Only hydro or MHD (with CT) on a uniform grid are supported, without physics that
+//! only updates the active zone (source terms, diffusion, FOFC).  Also checks that
+//! enough ghost zones are allocated, and reports the trade-off between the number of
+//! exchanges saved and the number of redundant cell updates.
+
+void Driver::CheckDeepHalo(Mesh *pm) {
+  MeshBlockPack *pmbp = pm->pmb_pack;
+  hydro::Hydro *phyd = pmbp->phydro;
+  mhd::MHD *pmhd = pmbp->pmhd;
+  std::string msg;
+  int nstencil = 0;
+  if (pm->multilevel) {
+    msg = "SMR/AMR";
+  } else if ((pmbp->prad != nullptr) || (pmbp->prm1 != nullptr) ||
+             (pmbp->pz4c != nullptr) || (pmbp->padm != nullptr) ||
+             (pmbp->pionn != nullptr)) {
+    msg = "physics other than single-fluid hydro or MHD";
+  } else if (pmbp->pcoord->is_general_relativistic) {
+    msg = "general relativity";
+  } else if (pm->pgen->user_srcs) {
+    msg = "user source terms";
+  } else if (phyd != nullptr) {
+    nstencil = ReconstructionStencil(phyd->recon_method);
+    if (phyd->use_fofc) {msg = "FOFC";}
+    if ((phyd->pvisc != nullptr) || (phyd->pcond != nullptr)) {msg = "diffusion";}
+    if (phyd->psrc->AnyEnabled()) {msg = "source terms";}
+  } else if (pmhd != nullptr) {
+    nstencil = ReconstructionStencil(pmhd->recon_method);
+    if (pmhd->use_fofc) {msg = "FOFC";}
+    if ((pmhd->pvisc != nullptr) || (pmhd->presist != nullptr) ||
+        (pmhd->pcond != nullptr)) {msg = "diffusion";}
+    if (pmhd->psrc->AnyEnabled()) {msg = "source terms";}
+  }
+  if (!(msg.empty())) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<time>/deep_halo is not supported with " << msg << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // the first stage consumes nexp_stages stencil widths of ghost cells
+  auto &indcs = pm->mb_indcs;
+  if (indcs.ng < nexp_stages*nstencil) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<time>/deep_halo with integrator=" << integrator << " requires at "
+              << "least " << nexp_stages*nstencil << " ghost zones, but <mesh>/nghost="
+              << indcs.ng << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // report fraction of cell updates per step that are redundant
+  if (global_variable::my_rank == 0) {
+    Real nactive = static_cast<Real>(indcs.nx1)*static_cast<Real>(indcs.nx2)*
+                   static_cast<Real>(indcs.nx3);
+    Real nupdate = 0.0;
+    for (int stage=1; stage<=nexp_stages; ++stage) {
+      int nh = HaloWidth(stage, nstencil);
+      Real n1 = static_cast<Real>(indcs.nx1 + 2*nh);
+      Real n2 = static_cast<Real>((pm->multi_d)? (indcs.nx2 + 2*nh) : 1);
+      Real n3 = static_cast<Real>((pm->three_d)? (indcs.nx3 + 2*nh) : 1);
+      nupdate += n1*n2*n3;
+    }
+    Real redundant = 100.0*(nupdate/(nexp_stages*nactive) - 1.0);
+    std::cout << "Deep-halo integration: ghost-zone exchanges per step reduced from "
+              << nexp_stages << " to 1, at the cost of " << std::setprecision(3)
+              << redundant << "% redundant cell updates" << std::endl;
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn Driver::OutputCycleDiagnostics()
 //! \brief Simple function to print diagnostics every 'ndiag' cycles to stdout
@@ -626,5 +786,19 @@ void Driver::InitBoundaryValuesAndPrimitives(Mesh *pm) {
     (void) prad->Prolongate(this, 0);
   }
 
+  // Initialize M1 radiation: ghost zones of moments (everywhere)
+  // DOES NOT include communications for shearing box boundaries
+  radiation_m1::RadiationM1 *prm1 = pm->pmb_pack->prm1;
+  if (prm1 != nullptr) {
+    (void) prm1->RestrictU(this, 0);
+    (void) prm1->InitRecv(this, -1);  // stage < 0 suppresses InitFluxRecv
+    (void) prm1->SendU(this, 0);
+    (void) prm1->ClearSend(this, -1);
+    (void) prm1->ClearRecv(this, -1);
+    (void) prm1->RecvU(this, 0);
+    (void) prm1->ApplyPhysicalBCs(this, 0);
+    (void) prm1->Prolongate(this, 0);
+  }
+
   return;
 }
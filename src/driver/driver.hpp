@@ -44,6 +44,7 @@ class Driver {
   Real delta[4];                   // weights for updating the intermediate stage (u1)
   Real a_twid[4][4], a_impl;       // matrix elements for implicit stages in ImEx
   Real cfl_limit;                  // maximum CFL number for integrator
+  bool deep_halo;                  // exchange ghost zones only once per step
   Kokkos::Timer* pwall_clock_;     // timer for tracking the wall clock
   Real wall_time;
 
@@ -54,12 +55,25 @@ class Driver {
   void Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout);
   void InitBoundaryValuesAndPrimitives(Mesh *pm);
 
+  // With deep-halo integration ghost zones are exchanged only in the last stage of each
+  // step, and earlier stages also update the (nexp_stages - stage)*nstencil ghost cells
+  // adjacent to the active zone, where nstencil is the number of cells consumed by the
+  // spatial stencil per stage.  Both functions reduce to the default when disabled.
+  int HaloWidth(int stage, int nstencil) const {
+    return (deep_halo && (stage > 0)) ? (nexp_stages - stage)*nstencil : 0;
+  }
+  bool ExchangeGhosts(int stage) const {
+    return (!(deep_halo) || (stage <= 0) || (stage == nexp_stages));
+  }
+
  private:
   Kokkos::Timer run_time_;      // generalized timer for cpu/gpu/etc
   std::uint64_t nmb_updated_;   // running total of MB updated during run
   std::uint64_t npart_updated_; // running total of particles updated during run
+  std::uint64_t nmb_frozen_;    // running total of MB frozen by MeshActivity during run
   float lb_efficiency_;         // measure of how efficient was load balancing
   void OutputCycleDiagnostics(Mesh *pm);
+  void CheckDeepHalo(Mesh *pm);
   Real UpdateWallClock();
 };
 #endif // DRIVER_DRIVER_HPP_
@@ -227,7 +227,7 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::ConvertInternalEnergyToPressure(int is,
 
   const Real mb = eos_.GetBaryonMass();
 
-  par_for("coord_src", DevExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie,
+  par_for("coord_src", TaskExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real n = prim(m, IDN, k, j, i) / mb;
     Real egas = mb*n + prim(m, IEN, k, j, i);
@@ -375,7 +375,7 @@ TaskStatus DynGRMHD::SetTmunu(Driver *pdrive, int stage) {
   auto &cons = pmy_pack->pmhd->u0;
   auto &bcc = pmy_pack->pmhd->bcc0;
 
-  par_for("dyngr_tmunu_loop",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  par_for("dyngr_tmunu_loop",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Calculate the determinant/volume form
     Real detg = adm::SpatialDet(adm.g_dd(m,0,0,k,j,i),adm.g_dd(m,0,1,k,j,i),
@@ -457,7 +457,7 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::AddCoordTermsEOS(const DvceArray5D<Real
     ndim = 3;
   }
 
-  par_for("coord_src", DevExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie,
+  par_for("coord_src", TaskExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Extract the metric and coordinate quantities.
     Real g3d[NSPMETRIC] = {adm.g_dd(m,0,0,k,j,i), adm.g_dd(m,0,1,k,j,i),
@@ -56,6 +56,7 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &excision_mb_ = pmy_pack->pcoord->excision_mb;
   auto &dexcise_ = pmy_pack->pcoord->coord_data.dexcise;
   auto &pexcise_ = pmy_pack->pcoord->coord_data.pexcise;
 
@@ -65,7 +66,7 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   const int nmkji = nmb*nkji;
 
   int nfloord_=0, nfloore_=0, nceilv_=0, nfail_=0, maxit_=0;
-  Kokkos::parallel_reduce("grhyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("grhyd_c2p",Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
   KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf, int &max_it) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
@@ -105,7 +106,7 @@ void IdealGRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
 
     // Only execute cons2prim if outside excised region
     bool excised = false;
-    if (use_excise) {
+    if (use_excise && excision_mb_(m)) {
       if (excision_floor_(m,k,j,i)) {
         w.d = dexcise_;
         w.vx = 0.0;
@@ -218,7 +219,7 @@ void IdealGRHydro::PrimToCons(const DvceArray5D<Real> &prim, DvceArray5D<Real> &
   int &nmb = pmy_pack->nmb_thispack;
   Real &gamma = eos_data.gamma;
 
-  par_for("grhyd_p2c", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
+  par_for("grhyd_p2c", TaskExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
     // Extract components of metric
     Real &x1min = size.d_view(m).x1min;
@@ -81,7 +81,7 @@ void IsothermalHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &pri
   const int nmkji = nmb*nkji;
 
   int nfloord_=0;
-  Kokkos::parallel_reduce("isohyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("isohyd_c2p",Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
   KOKKOS_LAMBDA(const int &idx, int &sumd) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
@@ -145,7 +145,7 @@ void IsothermalHydro::PrimToCons(const DvceArray5D<Real> &prim, DvceArray5D<Real
   int &nscal = pmy_pack->phydro->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
 
-  par_for("isohyd_p2c", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
+  par_for("isohyd_p2c", TaskExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
     // load single state primitive variables
     HydPrim1D w;
@@ -84,7 +84,7 @@ void IsothermalMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real
   const int nmkji = nmb*nkji;
 
   int nfloord_=0;
-  Kokkos::parallel_reduce("isomhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("isomhd_c2p",Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
   KOKKOS_LAMBDA(const int &idx, int &sumd) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
@@ -158,7 +158,7 @@ void IsothermalMHD::PrimToCons(const DvceArray5D<Real> &prim,const DvceArray5D<R
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
 
-  par_for("isomhd_prim2cons", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
+  par_for("isomhd_prim2cons", TaskExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
     // load single state primitive variables
     HydPrim1D w;
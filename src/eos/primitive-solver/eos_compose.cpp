@@ -52,7 +52,7 @@ void EOSCompOSE::ReadTableFromFile(std::string fname) {
     HostArray1D<Real>::HostMirror host_log_nb = create_mirror_view(m_log_nb);
     HostArray1D<Real>::HostMirror host_yq =     create_mirror_view(m_yq);
     HostArray1D<Real>::HostMirror host_log_t =  create_mirror_view(m_log_t);
-    HostArray4D<Real>::HostMirror host_table =  create_mirror_view(m_table);
+    DvceArray4D<Real>::HostMirror host_table =  create_mirror_view(m_table);
 
     { // read nb
       Real * table_nb = table["nb"];
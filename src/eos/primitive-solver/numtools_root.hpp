@@ -36,16 +36,17 @@ class Root {
   // \param[in,out]  lb  The lower bound for the root.
   // \param[in,out]  ub  The upper bound for the root.
   // \param[out]  x  The location of the root.
+  // \param[in]  tol  The relative tolerance for the root.
+  // \param[out]  count  The number of iterations used.
   // \param[in]  args  Additional arguments required by f.
 
   template<class Functor, class ... Types>
   KOKKOS_INLINE_FUNCTION
   bool FalsePosition(Functor&& f, Real &lb, Real &ub, Real& x, Real tol,
-                     Types ... args) const {
+                     unsigned int &count, Types ... args) const {
     int side = 0;
     Real ftest;
-    unsigned int count = 0;
-    //last_count = 0;
+    count = 0;
     // Get our initial bracket.
     Real flb = f(lb, args...);
     Real fub = f(ub, args...);
@@ -93,7 +94,6 @@ class Root {
         side = -1;
       }
     } while (count < iterations);
-    //last_count = count;
 
     // Return success if we're below the tolerance, otherwise report failure.
     return fabs((x-xold)/x) <= tol;
@@ -201,12 +201,15 @@ class PrimitiveSolver {
 
  public:
   Real tol;
+  /// Relative half-width of the bracket about an initial guess for mu
+  Real guess_width;
 
   /// Constructor
   //PrimitiveSolver(EOS<EOSPolicy, ErrorPolicy> *eos) : peos(eos) {
   PrimitiveSolver() {
     //root = NumTools::Root();
     tol = 1e-15;
+    guess_width = 1e-3;
     root.iterations = 30;
   }
 
@@ -220,11 +223,38 @@ class PrimitiveSolver {
   //  \param[in,out] bu    The magnetic field
   //  \param[in]     g3d   The 3x3 spatial metric
   //  \param[in]     g3u   The 3x3 inverse spatial metric
+  //  \param[in]     mu_guess  An initial guess for mu (see GetMuGuess), or a
+  //                           non-positive value to solve on the full bracket
   //
   //  \return information about the solve
   KOKKOS_INLINE_FUNCTION
   SolverResult ConToPrim(Real prim[NPRIM], Real cons[NCONS], Real b[NMAG],
-                         Real g3d[NSPMETRIC], Real g3u[NSPMETRIC]) const;
+                         Real g3d[NSPMETRIC], Real g3u[NSPMETRIC],
+                         Real mu_guess = 0.0) const;
+
+  //! \brief Estimate mu = 1/(hW) from a (previous) set of primitive variables.
+  //
+  //  The estimate is used to warm-start ConToPrim when the primitives are expected
+  //  to change little, e.g. between stages of a time integrator.
+  //
+  //  \param[in] prim  The array of primitive variables (temperature is ignored)
+  //  \param[in] g3d   The 3x3 spatial metric
+  //
+  //  \return the estimate for mu, or zero if the primitives are not usable
+  KOKKOS_INLINE_FUNCTION
+  Real GetMuGuess(Real prim[NPRIM], Real g3d[NSPMETRIC]) const {
+    Real n = prim[PRH];
+    Real P = prim[PPR];
+    if (!(n > 0.0) || !(P > 0.0) || !isfinite(n) || !isfinite(P)) {
+      return 0.0;
+    }
+    Real Wv_u[3] = {prim[PVX], prim[PVY], prim[PVZ]};
+    Real W = sqrt(1.0 + SquareVector(Wv_u, g3d));
+    Real T = eos.GetTemperatureFromP(n, P, &prim[PYF]);
+    Real h = eos.GetEnthalpy(n, T, &prim[PYF]);
+    Real mu = 1.0/(h*W);
+    return (isfinite(mu)) ? mu : 0.0;
+  }
 
   //! \brief Get the conserved variables from the primitive variables.
   //
@@ -364,7 +394,8 @@ Error PrimitiveSolver<EOSPolicy, ErrorPolicy>::CheckDensityValid(Real& mul, Real
 template<typename EOSPolicy, typename ErrorPolicy>
 KOKKOS_INLINE_FUNCTION
 SolverResult PrimitiveSolver<EOSPolicy, ErrorPolicy>::ConToPrim(Real prim[NPRIM],
-      Real cons[NCONS], Real b[NMAG], Real g3d[NSPMETRIC], Real g3u[NSPMETRIC]) const {
+      Real cons[NCONS], Real b[NMAG], Real g3d[NSPMETRIC], Real g3u[NSPMETRIC],
+      Real mu_guess) const {
   SolverResult solver_result{Error::SUCCESS, 0, false, false, false};
 
   // Extract the undensitized conserved variables.
@@ -514,11 +545,23 @@ SolverResult PrimitiveSolver<EOSPolicy, ErrorPolicy>::ConToPrim(Real prim[NPRIM]
 
   // Do the root solve.
   Real n, P, T, mu;
-  bool result = root.FalsePosition(RootFunction, mul, muh, mu, tol,
-                                   D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
-  // WARNING: the reported number of iterations is not thread-safe and should only be
-  // trusted on single-thread benchmarks.
-  solver_result.iterations = root.iterations;
+  unsigned int count = 0;
+  bool result = false;
+  // With an initial guess, first try a narrow bracket about the guess (clipped to the
+  // full bracket). If the root is not bracketed, or the solve does not converge, fall
+  // back to the full bracket.
+  if (mu_guess > mul && mu_guess < muh) {
+    Real mulg = fmax(mul, mu_guess*(1.0 - guess_width));
+    Real muhg = fmin(muh, mu_guess*(1.0 + guess_width));
+    result = root.FalsePosition(RootFunction, mulg, muhg, mu, tol, count,
+                                D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
+    solver_result.iterations = count;
+  }
+  if (!result) {
+    result = root.FalsePosition(RootFunction, mul, muh, mu, tol, count,
+                                D, q, bsqr, rsqr, rbsqr, Y, &eos, &n, &T, &P);
+    solver_result.iterations += count;
+  }
   if (!result) {
     HandleFailure(prim, cons, b, g3d);
     solver_result.error = Error::NO_SOLUTION;
@@ -90,6 +90,7 @@ class PrimitiveSolverHydro {
   MeshBlockPack* pmy_pack;
   unsigned int nerrs;
   unsigned int errcap;
+  bool warm_start;  // use primitives from previous stage as initial guess in C2P
 
   PrimitiveSolverHydro(std::string block, MeshBlockPack *pp, ParameterInput *pin) :
 //        pmy_pack(pp), ps{&eos} {
@@ -101,6 +102,8 @@ class PrimitiveSolverHydro {
     ps.GetEOSMutable().SetThreshold(pin->GetOrAddReal(block, "dthreshold", 1.0));
     ps.tol = pin->GetOrAddReal(block, "c2p_tol", 1e-15);
     ps.GetRootSolverMutable().iterations = pin->GetOrAddInteger(block, "c2p_iter", 50);
+    warm_start = pin->GetOrAddBoolean(block, "c2p_warm_start", false);
+    ps.guess_width = pin->GetOrAddReal(block, "c2p_guess_width", 1e-3);
     errcap = pin->GetOrAddInteger(block, "c2perrs", 1000);
 
     // Calculate maximum allowed velocity
@@ -195,7 +198,7 @@ class PrimitiveSolverHydro {
     Real mb = eos_.GetBaryonMass();
 
 
-    par_for("pshyd_prim2cons", DevExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
+    par_for("pshyd_prim2cons", TaskExeSpace(), 0, (nmb-1), kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       // Extract metric at a single point
       Real g3d[NSPMETRIC];
@@ -281,6 +284,7 @@ class PrimitiveSolverHydro {
     auto &excise = pmy_pack->pcoord->coord_data.bh_excise;
     auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
     auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+    auto &excision_mb_ = pmy_pack->pcoord->excision_mb;
     auto &dexcise_ = pmy_pack->pcoord->coord_data.dexcise;
     auto &pexcise_ = pmy_pack->pcoord->coord_data.pexcise;
 
@@ -296,6 +300,8 @@ class PrimitiveSolverHydro {
     const int rank = global_variable::my_rank;
     const int nerrs_ = nerrs;
     const int errcap_ = errcap;
+    // previous primitives are not a useful guess for the trial states tested for FOFC
+    const bool use_guess = warm_start && !floors_only;
 
     Real mb = eos_.GetBaryonMass();
 
@@ -310,9 +316,9 @@ class PrimitiveSolverHydro {
 
     // FIXME(JMF): We can short-circuit the primitive solve if FOFC is already enabled
     // due to a maximum principle violation.
-    int count_errs=0;
-    Kokkos::parallel_reduce("pshyd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-    KOKKOS_LAMBDA(const int &idx, int &sumerrs) {
+    int count_errs=0, maxit=0;
+    Kokkos::parallel_reduce("pshyd_c2p",Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
+    KOKKOS_LAMBDA(const int &idx, int &sumerrs, int &max_it) {
       int m = (idx)/nkji;
       int k = (idx - m*nkji)/nji;
       int j = (idx - m*nkji - k*nji)/ni;
@@ -324,7 +330,7 @@ class PrimitiveSolverHydro {
       if (floors_only && fofc_(m, k, j, i)) {
         return;
       }
-      if (floors_only && excise) {
+      if (floors_only && excise && excision_mb_(m)) {
         if (excision_flux_(m,k,j,i)) {
           return;
         }
@@ -372,9 +378,24 @@ class PrimitiveSolverHydro {
         b3u[IBZ] = bcc0(m, IBZ, k, j, i)*isdetg;
       }
 
+      // Estimate mu from the existing primitives to warm-start the solver.
+      Real mu_guess = 0.0;
+      if (use_guess) {
+        Real prim_old[NPRIM];
+        prim_old[PRH] = prim(m, IDN, k, j, i)/mb;
+        prim_old[PVX] = prim(m, IVX, k, j, i);
+        prim_old[PVY] = prim(m, IVY, k, j, i);
+        prim_old[PVZ] = prim(m, IVZ, k, j, i);
+        prim_old[PPR] = prim(m, IPR, k, j, i);
+        for (int n = 0; n < nscal; n++) {
+          prim_old[PYF + n] = prim(m, nhyd + n, k, j, i);
+        }
+        mu_guess = ps_.GetMuGuess(prim_old, g3d);
+      }
+
       // If we're in an excised region, set the primitives to some default value.
       Primitive::SolverResult result;
-      if (excise) {
+      if (excise && excision_mb_(m)) {
         if (excision_floor_(m,k,j,i)) {
           prim_pt[PRH] = dexcise_/mb;
           prim_pt[PVX] = 0.0;
@@ -395,12 +416,14 @@ class PrimitiveSolverHydro {
           result.cons_adjusted = true;
           ps_.PrimToCon(prim_pt, cons_pt, b3u, g3d);
         } else {
-          result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+          result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u, mu_guess);
         }
       } else {
-        result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u);
+        result = ps_.ConToPrim(prim_pt, cons_pt, b3u, g3d, g3u, mu_guess);
       }
 
+      max_it = (result.iterations > max_it) ? result.iterations : max_it;
+
       if (result.error != Primitive::Error::SUCCESS && floors_only) {
         fofc_(m,k,j,i) = true;
       } else if (!floors_only) {
@@ -495,13 +518,15 @@ class PrimitiveSolverHydro {
           }
         }
       }
-    }, Kokkos::Sum<int>(count_errs));
+    }, Kokkos::Sum<int>(count_errs), Kokkos::Max<int>(maxit));
 
     if (floors_only) {
       ps.GetEOSMutable().SetPrimitiveFloorFailure(prim_failure);
       ps.GetEOSMutable().SetConservedFloorFailure(cons_failure);
     } else {
       nerrs += count_errs;
+      // store maximum number of root-finder iterations in event counters
+      pmy_pack->pmesh->ecounter.maxit_c2p = maxit;
     }
   }
 
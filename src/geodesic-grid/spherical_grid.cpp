@@ -233,7 +233,7 @@ void SphericalGrid::InterpolateToSphere(int nvars, DvceArray5D<Real> &val) {
   auto &iindcs = interp_indcs;
   auto &iwghts = interp_wghts;
   auto &ivals = interp_vals;
-  par_for("int2sph",DevExeSpace(),0,nang1,0,nvar1,
+  par_for("int2sph",TaskExeSpace(),0,nang1,0,nvar1,
   KOKKOS_LAMBDA(int n, int v) {
     int ii0 = iindcs.d_view(n,0);
     int ii1 = iindcs.d_view(n,1);
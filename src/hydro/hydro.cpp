@@ -34,7 +34,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     u1("cons1",1,1,1,1,1),
     uflx("uflx",1,1,1,1,1),
     utest("utest",1,1,1,1,1),
-    fofc("fofc",1,1,1,1) {
+    fofc("fofc",1,1,1,1),
+    wh("primh",1,1,1,1,1) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -101,8 +102,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int ncells1 = indcs.nx1 + 2*(indcs.ng);
     int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
     int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(u0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-    Kokkos::realloc(w0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+    realloc_first_touch(u0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+    realloc_first_touch(w0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -111,8 +112,10 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells1 = indcs.cnx1 + 2*(indcs.ng);
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(coarse_u0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    realloc_first_touch(coarse_u0, nmb, (nhydro+nscalars),
+                        n_ccells3, n_ccells2, n_ccells1);
+    realloc_first_touch(coarse_w0, nmb, (nhydro+nscalars),
+                        n_ccells3, n_ccells2, n_ccells1);
   }
 
   // allocate boundary buffers for conserved (cell-centered) variables
@@ -133,6 +136,18 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if FOFC is enabled
     use_fofc = pin->GetOrAddBoolean("hydro","fofc",false);
 
+    // single-stage VL2 integrator uses half-step predictor for L/R states
+    if (pin->GetOrAddString("time","integrator","rk2").compare("vl2") == 0) {
+      if (pmy_pack->pcoord->is_special_relativistic ||
+          pmy_pack->pcoord->is_general_relativistic) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time>/integrator = vl2 cannot be used with SR/GR"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      use_hancock = true;
+    }
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("hydro","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -272,15 +287,20 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
       int ncells1 = indcs.nx1 + 2*(indcs.ng);
       int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-      Kokkos::realloc(u1,       nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(u1,       nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
-        Kokkos::realloc(fofc,  nmb, ncells3, ncells2, ncells1);
-        Kokkos::realloc(utest, nmb, nhydro, ncells3, ncells2, ncells1);
+        realloc_first_touch(fofc,  nmb, ncells3, ncells2, ncells1);
+        realloc_first_touch(utest, nmb, nhydro, ncells3, ncells2, ncells1);
+      }
+
+      // allocate half-step primitives used with VL2 (MUSCL-Hancock) integrator
+      if (use_hancock) {
+        realloc_first_touch(wh, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
       }
     }
   }
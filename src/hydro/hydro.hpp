@@ -104,6 +104,10 @@ class Hydro {
   bool use_fofc = false;   // flag to enable FOFC
   DvceArray5D<Real> utest;  // scratch array for FOFC
 
+  // following used for the half-step predictor of the VL2 (MUSCL-Hancock) integrator
+  bool use_hancock = false;  // flag to enable predictor
+  DvceArray5D<Real> wh;      // primitive variables at half time step
+
   // container to hold names of TaskIDs
   HydroTaskIDs id;
 
@@ -140,6 +144,9 @@ class Hydro {
   // first-order flux correction
   void FOFC(Driver *d, int stage);
 
+  // half-step predictor for VL2 integrator
+  void HancockPredictor();
+
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Hydro
 };
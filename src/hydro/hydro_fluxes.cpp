@@ -10,6 +10,7 @@
 
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
 #include "coordinates/coordinates.hpp"
 #include "hydro.hpp"
 #include "eos/eos.hpp"
@@ -40,6 +41,11 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   int is = indcs_.is, ie = indcs_.ie;
   int js = indcs_.js, je = indcs_.je;
   int ks = indcs_.ks, ke = indcs_.ke;
+  // with deep-halo integration, extend computation into ghost zones in early stages
+  int nh = pdriver->HaloWidth(stage, ReconstructionStencil(recon_method));
+  is -= nh; ie += nh;
+  if (pmy_pack->pmesh->multi_d) {js -= nh; je += nh;}
+  if (pmy_pack->pmesh->three_d) {ks -= nh; ke += nh;}
   int ncells1 = indcs_.nx1 + 2*(indcs_.ng);
 
   int &nhyd_  = nhydro;
@@ -54,7 +60,11 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
   auto &eos_ = peos->eos_data;
   auto &size_ = pmy_pack->pmb->mb_size;
   auto &coord_ = pmy_pack->pcoord->coord_data;
+  auto &activity = pmy_pack->pmb->mb_activity;
   auto &w0_ = w0;
+  // VL2 integrator adds the half-step predictor increment (wh - w0) to the L/R states
+  bool use_hancock_ = use_hancock;
+  auto &wh_ = wh;
 
   //--------------------------------------------------------------------------------------
   // i-direction
@@ -74,8 +84,9 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
     }
   }
 
-  par_for_outer("hflux_x1",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
+  par_for_outer("hflux_x1",TaskExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    if (activity.d_view(m) < 0) return;
     ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
 
@@ -97,6 +108,16 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
       default:
         break;
     }
+    if (use_hancock_) {
+      member.team_barrier();
+      for (int n=0; n<nvars; ++n) {
+        par_for_inner(member, il-1, iu, [&](const int i) {
+          Real dw = wh_(m,n,k,j,i) - w0_(m,n,k,j,i);
+          wl(n,i+1) += dw;
+          wr(n,i) += dw;
+        });
+      }
+    }
     // Sync all threads in the team so that scratch memory is consistent
     member.team_barrier();
 
@@ -162,8 +183,9 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
       }
     }
 
-    par_for_outer("hflux_x2",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku,
+    par_for_outer("hflux_x2",TaskExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
+      if (activity.d_view(m) < 0) return;
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
@@ -196,6 +218,16 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           default:
             break;
         }
+        if (use_hancock_) {
+          member.team_barrier();
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, il, iu, [&](const int i) {
+              Real dw = wh_(m,n,k,j,i) - w0_(m,n,k,j,i);
+              wl_jp1(n,i) += dw;
+              wr(n,i) += dw;
+            });
+          }
+        }
         member.team_barrier();
 
         // compute fluxes over [js,je+1].  RS returns flux in input wr array
@@ -257,8 +289,9 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
     il = is, iu = ie, jl = js, ju = je, kl = ks-1, ku = ke+1;
     if (use_fofc) { il = is-1, iu = ie+1, jl = js-1, ju = je+1, kl = ks-2, ku = ke+2; }
 
-    par_for_outer("hflux_x3",DevExeSpace(), scr_size, scr_level, 0, nmb1, jl, ju,
+    par_for_outer("hflux_x3",TaskExeSpace(), scr_size, scr_level, 0, nmb1, jl, ju,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
+      if (activity.d_view(m) < 0) return;
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
@@ -291,6 +324,16 @@ void Hydro::CalculateFluxes(Driver *pdriver, int stage) {
           default:
             break;
         }
+        if (use_hancock_) {
+          member.team_barrier();
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, il, iu, [&](const int i) {
+              Real dw = wh_(m,n,k,j,i) - w0_(m,n,k,j,i);
+              wl_kp1(n,i) += dw;
+              wr(n,i) += dw;
+            });
+          }
+        }
         member.team_barrier();
 
         // compute fluxes over [ks,ke+1].  RS returns flux in input wr array
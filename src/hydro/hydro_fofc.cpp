@@ -58,7 +58,7 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
     if (three_d) { kl = ks-1, ku = ke+1; }
 
     // Estimate updated conserved variables and cell-centered fields
-    par_for("FOFC-newu", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+    par_for("FOFC-newu", TaskExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       Real dtodx1 = beta_dt/size.d_view(m).dx1;
       Real dtodx2 = beta_dt/size.d_view(m).dx2;
@@ -90,6 +90,7 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
   auto &fofc_ = fofc;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &excision_mb_ = pmy_pack->pcoord->excision_mb;
   auto &w0_ = w0;
 
   // Index bounds
@@ -99,7 +100,7 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
 
   // Now replace fluxes with first-order LLF fluxes for any cell where floors needed (if
   // using FOFC) and/or for any cell about the excision (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  par_for("FOFC-flx", TaskExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
@@ -108,7 +109,7 @@ void Hydro::FOFC(Driver *pdriver, int stage) {
     // Check for GR + excision
     bool fofc_excision = false;
     if (is_gr) {
-      if (use_excise) { fofc_excision = excision_flux_(m,k,j,i); }
+      if (use_excise && excision_mb_(m)) { fofc_excision = excision_flux_(m,k,j,i); }
     }
 
     // Apply FOFC
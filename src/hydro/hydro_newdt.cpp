@@ -44,6 +44,7 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
   auto &w0_ = w0;
   auto &eos = pmy_pack->phydro->peos->eos_data;
   auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &activity = pmy_pack->pmb->mb_activity;
   auto &is_special_relativistic_ = pmy_pack->pcoord->is_special_relativistic;
   auto &is_general_relativistic_ = pmy_pack->pcoord->is_general_relativistic;
   auto &is_dynamical_relativistic_ = pmy_pack->pcoord->is_dynamical_relativistic;
@@ -53,10 +54,12 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
 
   if (pdrive->time_evolution == TimeEvolution::kinematic) {
     // find smallest (dx/v) in each direction for advection problems
-    Kokkos::parallel_reduce("HydroNudt1",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    Kokkos::parallel_reduce("HydroNudt1",Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
+      // frozen MeshBlocks do not limit the timestep
+      if (activity.d_view(m) < 1) return;
       int k = (idx - m*nkji)/nji;
       int j = (idx - m*nkji - k*nji)/nx1;
       int i = (idx - m*nkji - k*nji - j*nx1) + is;
@@ -69,10 +72,12 @@ TaskStatus Hydro::NewTimeStep(Driver *pdrive, int stage) {
     }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
   } else {
     // find smallest dx/(v +/- Cs) in each direction for hydrodynamic problems
-    Kokkos::parallel_reduce("HydroNudt2",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    Kokkos::parallel_reduce("HydroNudt2",Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
+      // frozen MeshBlocks do not limit the timestep
+      if (activity.d_view(m) < 1) return;
       int k = (idx - m*nkji)/nji;
       int j = (idx - m*nkji - k*nji)/nx1;
       int i = (idx - m*nkji - k*nji - j*nx1) + is;
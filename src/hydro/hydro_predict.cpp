@@ -0,0 +1,105 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics and numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file hydro_predict.cpp
+//! \brief Half-step predictor of the single-stage MUSCL-Hancock (VL2) integrator.  The
+//! primitives are advanced by dt/2 using the non-conservative (primitive) form of the
+//! Euler equations and limited PLM slopes in each direction.  The increment W^{n+1/2}-W^n
+//! is added to the reconstructed L/R states in CalculateFluxes(), so a single
+//! reconstruction, Riemann solve and ghost-zone exchange is needed per time step.
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "reconstruct/plm.hpp"
+#include "hydro.hpp"
+
+namespace hydro {
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::HancockPredictor
+//  \brief Computes primitives at the half time step, wh = w0 + (dt/2) dw/dt.  Stored in
+//  every cell with both neighbors available; the outermost ghost cells keep w0.
+
+void Hydro::HancockPredictor() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nhyd = nhydro;
+  int nvars = nhydro + nscalars;
+  Real hdt = 0.5*(pmy_pack->pmesh->dt);
+
+  auto &eos = peos->eos_data;
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &activity = pmy_pack->pmb->mb_activity;
+  auto &w0_ = w0;
+  auto &wh_ = wh;
+  par_for("hancock", TaskExeSpace(), 0, nmb1, 0, ncells3-1, 0, ncells2-1, 0, ncells1-1,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    for (int n=0; n<nvars; ++n) {
+      wh_(m,n,k,j,i) = w0_(m,n,k,j,i);
+    }
+    if (activity.d_view(m) < 0) return;
+    if ((i == 0) || (i == ncells1-1)) return;
+    if (multi_d && ((j == 0) || (j == ncells2-1))) return;
+    if (three_d && ((k == 0) || (k == ncells3-1))) return;
+
+    const Real &d = w0_(m,IDN,k,j,i);
+    Real v[3] = {w0_(m,IVX,k,j,i), w0_(m,IVY,k,j,i), w0_(m,IVZ,k,j,i)};
+    Real dd = 0.0, de = 0.0;
+    Real dv[3] = {0.0, 0.0, 0.0};
+
+    // sum contributions A_d(W) dW/dx_d from each direction
+    int ndir = (three_d)? 3 : ((multi_d)? 2 : 1);
+    for (int dir=0; dir<ndir; ++dir) {
+      int di = (dir == 0)? 1 : 0;
+      int dj = (dir == 1)? 1 : 0;
+      int dk = (dir == 2)? 1 : 0;
+      Real dx = (dir == 0)? size.d_view(m).dx1 :
+                ((dir == 1)? size.d_view(m).dx2 : size.d_view(m).dx3);
+      Real dtodx = hdt/dx;
+      Real sv[3];
+      for (int c=0; c<3; ++c) {
+        sv[c] = PLMSlope(w0_(m,IVX+c,k-dk,j-dj,i-di), w0_(m,IVX+c,k,j,i),
+                         w0_(m,IVX+c,k+dk,j+dj,i+di));
+      }
+      Real sd = PLMSlope(w0_(m,IDN,k-dk,j-dj,i-di), d, w0_(m,IDN,k+dk,j+dj,i+di));
+      const Real &vn = v[dir];
+
+      dd -= dtodx*(vn*sd + d*sv[dir]);
+      for (int c=0; c<3; ++c) {
+        dv[c] -= dtodx*vn*sv[c];
+      }
+      if (eos.is_ideal) {
+        Real se = PLMSlope(w0_(m,IEN,k-dk,j-dj,i-di), w0_(m,IEN,k,j,i),
+                           w0_(m,IEN,k+dk,j+dj,i+di));
+        de -= dtodx*(vn*se + eos.gamma*w0_(m,IEN,k,j,i)*sv[dir]);
+        dv[dir] -= dtodx*eos.IdealGasPressure(se)/d;
+      } else {
+        dv[dir] -= dtodx*SQR(eos.iso_cs)*sd/d;
+      }
+      // passive scalars are advected
+      for (int n=nhyd; n<nvars; ++n) {
+        Real ss = PLMSlope(w0_(m,n,k-dk,j-dj,i-di), w0_(m,n,k,j,i),
+                           w0_(m,n,k+dk,j+dj,i+di));
+        wh_(m,n,k,j,i) -= dtodx*vn*ss;
+      }
+    }
+
+    wh_(m,IDN,k,j,i) = fmax(d + dd, eos.dfloor);
+    wh_(m,IVX,k,j,i) += dv[0];
+    wh_(m,IVY,k,j,i) += dv[1];
+    wh_(m,IVZ,k,j,i) += dv[2];
+    if (eos.is_ideal) {
+      wh_(m,IEN,k,j,i) = fmax(wh_(m,IEN,k,j,i) + de, eos.pfloor/(eos.gamma - 1.0));
+    }
+  });
+  return;
+}
+
+} // namespace hydro
@@ -84,6 +84,9 @@ void Hydro::AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>>
 //! initialize all boundary receive status flags to waiting (with or without MPI).
 
 TaskStatus Hydro::InitRecv(Driver *pdrive, int stage) {
+  // with deep-halo integration, ghost zones are not exchanged in early stages
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
+
   // post receives for U
   TaskStatus tstat = pbval_u->InitRecv(nhydro+nscalars);
   if (tstat != TaskStatus::complete) return tstat;
@@ -125,7 +128,7 @@ TaskStatus Hydro::InitRecv(Driver *pdrive, int stage) {
 
 TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
   if (stage == 1) {
-    Kokkos::deep_copy(DevExeSpace(), u1, u0);
+    Kokkos::deep_copy(TaskExeSpace(), u1, u0);
   } else {
     if (pdrive->integrator == "rk4") {
       // parallel loop to update u1 with u0 at later stages, only for rk4
@@ -133,13 +136,21 @@ TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
       int is = indcs.is, ie = indcs.ie;
       int js = indcs.js, je = indcs.je;
       int ks = indcs.ks, ke = indcs.ke;
+      // with deep-halo integration, extend into ghost zones updated in this stage
+      int nh = pdrive->HaloWidth(stage, ReconstructionStencil(recon_method));
+      is -= nh; ie += nh;
+      if (pmy_pack->pmesh->multi_d) {js -= nh; je += nh;}
+      if (pmy_pack->pmesh->three_d) {ks -= nh; ke += nh;}
       int nmb1 = pmy_pack->nmb_thispack - 1;
       int nvar = nhydro + nscalars;
       auto &u0 = pmy_pack->phydro->u0;
       auto &u1 = pmy_pack->phydro->u1;
       Real &delta = pdrive->delta[stage-1];
-      par_for("rk4_copy_cons", DevExeSpace(),0, nmb1, 0, nvar-1, ks, ke, js, je, is, ie,
+      auto &activity = pmy_pack->pmb->mb_activity;
+      par_for("rk4_copy_cons", TaskExeSpace(),0, nmb1, 0, nvar-1, ks, ke, js, je, is, ie,
       KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+        // u1 of frozen MeshBlocks must keep values at start of cycle
+        if (activity.d_view(m) < 1) return;
         u1(m,n,k,j,i) += delta*u0(m,n,k,j,i);
       });
     }
@@ -153,6 +164,9 @@ TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
 //! of conserved variables
 
 TaskStatus Hydro::Fluxes(Driver *pdrive, int stage) {
+  // half-step predictor of VL2 integrator
+  if (use_hancock) {HancockPredictor();}
+
   // select which calculate_flux function to call based on rsolver_method
   if (rsolver_method == Hydro_RSolver::advect) {
     CalculateFluxes<Hydro_RSolver::advect>(pdrive, stage);
@@ -233,12 +247,14 @@ TaskStatus Hydro::RecvFlux(Driver *pdrive, int stage) {
 TaskStatus Hydro::HydroSrcTerms(Driver *pdrive, int stage) {
   Real beta_dt = (pdrive->beta[stage-1])*(pmy_pack->pmesh->dt);
 
-  // Add source terms for various physics.  Must be computed from primitives.
-  if (psrc->const_accel)  psrc->ConstantAccel(w0, peos->eos_data,  beta_dt, u0);
-  if (psrc->ism_cooling)  psrc->ISMCooling(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->rel_cooling)  psrc->RelCooling(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->sn_driving)   psrc->SupernovaDriving(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->shearing_box) psrc->ShearingBox(w0, peos->eos_data, beta_dt, u0);
+  // Add source terms for various physics.  Must be computed from primitives, which are
+  // taken at the half time step with the VL2 integrator.
+  auto &w = (use_hancock)? wh : w0;
+  if (psrc->const_accel)  psrc->ConstantAccel(w, peos->eos_data,  beta_dt, u0);
+  if (psrc->ism_cooling)  psrc->ISMCooling(w, peos->eos_data, beta_dt, u0);
+  if (psrc->rel_cooling)  psrc->RelCooling(w, peos->eos_data, beta_dt, u0);
+  if (psrc->sn_driving)   psrc->SupernovaDriving(w, peos->eos_data, beta_dt, u0);
+  if (psrc->shearing_box) psrc->ShearingBox(w, peos->eos_data, beta_dt, u0);
 
   // Add coordinate source terms in GR.  Again, must be computed with only primitives.
   if (pmy_pack->pcoord->is_general_relativistic) {
@@ -250,6 +266,9 @@ TaskStatus Hydro::HydroSrcTerms(Driver *pdrive, int stage) {
     (pmy_pack->pmesh->pgen->user_srcs_func)(pmy_pack->pmesh, beta_dt);
   }
 
+  // Remove source terms from frozen MeshBlocks
+  if (pmy_pack->pmesh->pmact != nullptr) {pmy_pack->pmesh->pmact->ResetFrozen(u0, u1);}
+
   return TaskStatus::complete;
 }
 
@@ -300,6 +319,7 @@ TaskStatus Hydro::RestrictU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to pack/send cell-centered conserved variables
 
 TaskStatus Hydro::SendU(Driver *pdrive, int stage) {
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = pbval_u->PackAndSendCC(u0, coarse_u0);
   return tstat;
 }
@@ -309,6 +329,7 @@ TaskStatus Hydro::SendU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to receive/unpack cell-centered conserved variables
 
 TaskStatus Hydro::RecvU(Driver *pdrive, int stage) {
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
   return tstat;
 }
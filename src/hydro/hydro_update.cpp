@@ -28,6 +28,11 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
   int ncells1 = indcs.nx1 + 2*(indcs.ng);
   bool &multi_d = pmy_pack->pmesh->multi_d;
   bool &three_d = pmy_pack->pmesh->three_d;
+  // with deep-halo integration, extend update into ghost zones in early stages
+  int nh = pdriver->HaloWidth(stage, ReconstructionStencil(recon_method));
+  is -= nh; ie += nh;
+  if (multi_d) {js -= nh; je += nh;}
+  if (three_d) {ks -= nh; ke += nh;}
 
   Real &gam0 = pdriver->gam0[stage-1];
   Real &gam1 = pdriver->gam1[stage-1];
@@ -40,6 +45,7 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
   auto flx2 = uflx.x2f;
   auto flx3 = uflx.x3f;
   auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &activity = pmy_pack->pmb->mb_activity;
 
   // hierarchical parallel loop that updates conserved variables to intermediate step
   // using weights and fractional time step appropriate to stages of time-integrator.
@@ -47,8 +53,9 @@ TaskStatus Hydro::RKUpdate(Driver *pdriver, int stage) {
   int scr_level = 0;
   size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1);
 
-  par_for_outer("h_update",DevExeSpace(),scr_size,scr_level,0,nmb1,0,nvar-1,ks,ke,js,je,
+  par_for_outer("h_update",TaskExeSpace(),scr_size,scr_level,0,nmb1,0,nvar-1,ks,ke,js,je,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
+    if (activity.d_view(m) < 1) return;
     ScrArray1D<Real> divf(member.team_scratch(scr_level), ncells1);
 
     // compute dF1/dx1
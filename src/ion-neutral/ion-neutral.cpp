@@ -28,5 +28,20 @@ IonNeutral::IonNeutral(MeshBlockPack *pp, ParameterInput *pin) :
   drag_coeff = pin->GetReal("ion-neutral","drag_coeff");
   ionization_coeff = pin->GetOrAddReal("ion-neutral","ionization_coeff",0.0);
   recombination_coeff = pin->GetOrAddReal("ion-neutral","recombination_coeff",0.0);
+
+  // allocate boundary buffers for conserved variables of both fluids.  Must be called
+  // after Hydro and MHD constructors, so that number of variables is known.
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  pbval_u = new MeshBoundaryValuesCC(pp, pin, false);
+  pbval_u->InitializeBuffers((pmhd->nmhd + pmhd->nscalars) +
+                             (phyd->nhydro + phyd->nscalars));
+}
+
+//----------------------------------------------------------------------------------------
+// destructor
+
+IonNeutral::~IonNeutral() {
+  delete pbval_u;
 }
 } // namespace ion_neutral
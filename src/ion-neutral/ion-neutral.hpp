@@ -15,6 +15,7 @@
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "tasklist/task_list.hpp"
+#include "bvals/bvals.hpp"
 #include "driver/driver.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -22,8 +23,7 @@
 //  \brief container to hold TaskIDs of all ion-neutral tasks
 
 struct IonNeutralTaskIDs {
-  TaskID i_irecv;
-  TaskID n_irecv;
+  TaskID irecv;
   TaskID impl_2x;
   TaskID i_flux;
   TaskID i_sendf;
@@ -36,10 +36,8 @@ struct IonNeutralTaskIDs {
   TaskID n_rkupdt;
   TaskID n_restu;
   TaskID impl;
-  TaskID i_sendu;
-  TaskID i_recvu;
-  TaskID n_sendu;
-  TaskID n_recvu;
+  TaskID sendu;
+  TaskID recvu;
   TaskID efld;
   TaskID sende;
   TaskID recve;
@@ -55,8 +53,7 @@ struct IonNeutralTaskIDs {
   TaskID n_c2p;
   TaskID i_newdt;
   TaskID n_newdt;
-  TaskID i_clear;
-  TaskID n_clear;
+  TaskID clear;
 };
 
 namespace ion_neutral {
@@ -75,11 +72,19 @@ class IonNeutral {
   Real ionization_coeff;         // ionization rate, xi
   Real recombination_coeff;      // recombination rate, alpha
 
+  // Boundary communication of the conserved variables of both the ions (MHD) and the
+  // neutrals (Hydro), which are packed into the same buffers and sent in one message
+  MeshBoundaryValuesCC *pbval_u;
+
   // container to hold names of TaskIDs
   IonNeutralTaskIDs id;
 
   // functions
   void AssembleIonNeutralTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
+  TaskStatus InitRecv(Driver* pdrive, int stage);
+  TaskStatus SendU(Driver* pdrive, int stage);
+  TaskStatus RecvU(Driver* pdrive, int stage);
+  TaskStatus ClearSend(Driver* pdrive, int stage);
   TaskStatus FirstTwoImpRK(Driver* pdrive, int stage);
   TaskStatus ImpRKUpdate(Driver* pdrive, int stage);
 
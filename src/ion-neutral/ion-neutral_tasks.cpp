@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <iostream>
 
 #include "athena.hpp"
@@ -36,8 +37,7 @@ void IonNeutral::AssembleIonNeutralTasks(
   Hydro *phyd = pmy_pack->phydro;
 
   // assemble "before_stagen_tl" task list
-  id.i_irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, pmhd, none);
-  id.n_irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, phyd, none);
+  id.irecv = tl["before_stagen"]->AddTask(&IonNeutral::InitRecv, this, none);
 
   // assemble "stagen_tl" task list
   // FirstTwoImpRK task does CopyCons
@@ -57,12 +57,11 @@ void IonNeutral::AssembleIonNeutralTasks(
   id.i_restu  = tl["stagen"]->AddTask(&MHD::RestrictU, pmhd, id.impl);
   id.n_restu  = tl["stagen"]->AddTask(&Hydro::RestrictU, phyd, id.i_restu);
 
-  id.i_sendu  = tl["stagen"]->AddTask(&MHD::SendU, pmhd, id.n_restu);
-  id.n_sendu  = tl["stagen"]->AddTask(&Hydro::SendU, phyd, id.n_restu);
-  id.i_recvu  = tl["stagen"]->AddTask(&MHD::RecvU, pmhd, id.i_sendu);
-  id.n_recvu  = tl["stagen"]->AddTask(&Hydro::RecvU, phyd, id.n_sendu);
+  // conserved variables of ions and neutrals are communicated together
+  id.sendu    = tl["stagen"]->AddTask(&IonNeutral::SendU, this, id.n_restu);
+  id.recvu    = tl["stagen"]->AddTask(&IonNeutral::RecvU, this, id.sendu);
 
-  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.i_recvu);
+  id.efld     = tl["stagen"]->AddTask(&MHD::CornerE, pmhd, id.recvu);
   id.sende    = tl["stagen"]->AddTask(&MHD::SendE, pmhd, id.efld);
   id.recve    = tl["stagen"]->AddTask(&MHD::RecvE, pmhd, id.sende);
   id.ct       = tl["stagen"]->AddTask(&MHD::CT, pmhd, id.recve);
@@ -71,7 +70,7 @@ void IonNeutral::AssembleIonNeutralTasks(
   id.recvb    = tl["stagen"]->AddTask(&MHD::RecvB, pmhd, id.sendb);
 
   id.i_bcs    = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, pmhd, id.recvb);
-  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, id.n_recvu);
+  id.n_bcs    = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, phyd, id.recvu);
   id.i_prol   = tl["stagen"]->AddTask(&MHD::Prolongate, pmhd, id.i_bcs);
   id.n_prol   = tl["stagen"]->AddTask(&Hydro::Prolongate, phyd, id.n_bcs);
   id.i_c2p    = tl["stagen"]->AddTask(&MHD::ConToPrim, pmhd, id.i_prol);
@@ -80,12 +79,98 @@ void IonNeutral::AssembleIonNeutralTasks(
   id.n_newdt  = tl["stagen"]->AddTask(&Hydro::NewTimeStep, phyd, id.n_c2p);
 
   // assemble "after_stagen_tl" task list
-  id.i_clear = tl["after_stagen"]->AddTask(&MHD::ClearSend, pmhd, none);
-  id.n_clear = tl["after_stagen"]->AddTask(&Hydro::ClearSend, phyd, none);
+  id.clear = tl["after_stagen"]->AddTask(&IonNeutral::ClearSend, this, none);
 
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus IonNeutral::InitRecv
+//! \brief Wrapper task list function to post non-blocking receives (with MPI) for the
+//! combined conserved variables of both fluids, the face-centered magnetic field, and the
+//! fluxes of all three.  Replaces separate calls to MHD::InitRecv and Hydro::InitRecv,
+//! which would post receives for U that are never matched by a send.
+
+TaskStatus IonNeutral::InitRecv(Driver *pdrive, int stage) {
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  // post receives for U of both fluids
+  TaskStatus tstat = pbval_u->InitRecv((pmhd->nmhd + pmhd->nscalars) +
+                                       (phyd->nhydro + phyd->nscalars));
+  if (tstat != TaskStatus::complete) return tstat;
+  // post receives for B
+  tstat = pmhd->pbval_b->InitRecv(3);
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // with SMR/AMR post receives for fluxes of U, always post receives for fluxes of B
+  // do not post receives for fluxes when stage < 0 (i.e. ICs)
+  if (stage >= 0) {
+    if (pmy_pack->pmesh->multilevel) {
+      tstat = pmhd->pbval_u->InitFluxRecv(pmhd->nmhd + pmhd->nscalars);
+      if (tstat != TaskStatus::complete) return tstat;
+      tstat = phyd->pbval_u->InitFluxRecv(phyd->nhydro + phyd->nscalars);
+      if (tstat != TaskStatus::complete) return tstat;
+    }
+    tstat = pmhd->pbval_b->InitFluxRecv(3);
+    if (tstat != TaskStatus::complete) return tstat;
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus IonNeutral::SendU
+//! \brief Wrapper task list function to pack/send conserved variables of both fluids
+
+TaskStatus IonNeutral::SendU(Driver *pdrive, int stage) {
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  std::vector<DvceArray5D<Real>> u0 = {pmhd->u0, phyd->u0};
+  std::vector<DvceArray5D<Real>> coarse_u0 = {pmhd->coarse_u0, phyd->coarse_u0};
+  TaskStatus tstat = pbval_u->PackAndSendCC(u0, coarse_u0);
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus IonNeutral::RecvU
+//! \brief Wrapper task list function to receive/unpack conserved variables of both fluids
+
+TaskStatus IonNeutral::RecvU(Driver *pdrive, int stage) {
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  std::vector<DvceArray5D<Real>> u0 = {pmhd->u0, phyd->u0};
+  std::vector<DvceArray5D<Real>> coarse_u0 = {pmhd->coarse_u0, phyd->coarse_u0};
+  TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus IonNeutral::ClearSend
+//! \brief Wrapper task list function that checks all MPI sends posted in the ion-neutral
+//! task list have completed.
+
+TaskStatus IonNeutral::ClearSend(Driver *pdrive, int stage) {
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  // check sends of U and B complete
+  TaskStatus tstat = pbval_u->ClearSend();
+  if (tstat != TaskStatus::complete) return tstat;
+  tstat = pmhd->pbval_b->ClearSend();
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // check sends of fluxes complete (fluxes of U only with SMR/AMR)
+  if (stage >= 0) {
+    if (pmy_pack->pmesh->multilevel) {
+      tstat = pmhd->pbval_u->ClearFluxSend();
+      if (tstat != TaskStatus::complete) return tstat;
+      tstat = phyd->pbval_u->ClearFluxSend();
+      if (tstat != TaskStatus::complete) return tstat;
+    }
+    tstat = pmhd->pbval_b->ClearFluxSend();
+    if (tstat != TaskStatus::complete) return tstat;
+  }
+  return tstat;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn IonNeutral::FirstTwoImpRK
 //  \brief Executes first two implicit stages of the ImEx integrator for ion-neutral
@@ -98,11 +183,11 @@ TaskStatus IonNeutral::FirstTwoImpRK(Driver *pdrive, int stage) {
   hydro::Hydro *phyd = pmy_pack->phydro;
 
   // copy conserved hydro and MHD variables
-  Kokkos::deep_copy(DevExeSpace(), phyd->u1, phyd->u0);
-  Kokkos::deep_copy(DevExeSpace(), pmhd->u1, pmhd->u0);
-  Kokkos::deep_copy(DevExeSpace(), pmhd->b1.x1f, pmhd->b0.x1f);
-  Kokkos::deep_copy(DevExeSpace(), pmhd->b1.x2f, pmhd->b0.x2f);
-  Kokkos::deep_copy(DevExeSpace(), pmhd->b1.x3f, pmhd->b0.x3f);
+  Kokkos::deep_copy(TaskExeSpace(), phyd->u1, phyd->u0);
+  Kokkos::deep_copy(TaskExeSpace(), pmhd->u1, pmhd->u0);
+  Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x1f, pmhd->b0.x1f);
+  Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x2f, pmhd->b0.x2f);
+  Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x3f, pmhd->b0.x3f);
 
   // Solve implicit equations first time (nexp_stage = -1)
   auto status = ImpRKUpdate(pdrive, -1);
@@ -163,7 +248,7 @@ TaskStatus IonNeutral::ImpRKUpdate(Driver *pdriver, int estage) {
     auto &a_twid = pdriver->a_twid;
     Real dt = pmy_pack->pmesh->dt;
     auto ru_ = pdriver->impl_src;
-    par_for_outer("imex_exp",DevExeSpace(),scr_size,scr_level,0,nmb1,0,(n3-1),0,(n2-1),
+    par_for_outer("imex_exp",TaskExeSpace(),scr_size,scr_level,0,nmb1,0,(n3-1),0,(n2-1),
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
       for (int s=0; s<=(istage-2); ++s) {
         Real adt = a_twid[istage-2][s]*dt;
@@ -190,7 +275,7 @@ TaskStatus IonNeutral::ImpRKUpdate(Driver *pdriver, int estage) {
     Real alpha_adt = recombination_coeff*(pdriver->a_impl)*(pmy_pack->pmesh->dt);
     auto ui = pmhd->u0;
     auto un = phyd->u0;
-    par_for("imex_imp",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
+    par_for("imex_imp",TaskExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       Real rho_i = ui(m,IDN,k,j,i);
       if (alpha_adt > 0) { // to avoid division by zero
@@ -238,7 +323,7 @@ TaskStatus IonNeutral::ImpRKUpdate(Driver *pdriver, int estage) {
     auto xi = ionization_coeff;
     auto alpha = recombination_coeff;
     auto ru_ = pdriver->impl_src;
-    par_for("imex_rup",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
+    par_for("imex_rup",TaskExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       // drag term in IM1 component of ion momentum
       ru_(s,m,0,k,j,i) = drag*(ui(m,IDN,k,j,i)*un(m,IM1,k,j,i) -
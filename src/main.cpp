@@ -256,6 +256,14 @@ int main(int argc, char *argv[]) {
     return(0);
   }
 
+  // Partition default execution space into independent instances, if requested, so that
+  // tasks without mutual dependencies can execute concurrently.  Must precede Mesh
+  // construction since task lists are assembled with the physics modules.
+  exec_instances::Initialize(pinput->GetOrAddInteger("job", "exec_instances", 0));
+
+  // Report binding of OpenMP threads to cores and NUMA nodes
+  ReportThreadBinding(pinput->GetOrAddBoolean("job", "report_binding", false));
+
   //--- Step 4. --------------------------------------------------------------------------
   // Construct Mesh.  Then build MeshBlockTree and add MeshBlockPack containing MeshBlocks
   // on this rank.  Latter cannot be performed in Mesh constructor since it requires
@@ -274,6 +282,7 @@ int main(int argc, char *argv[]) {
     if (res_flag) {restartfile.Close();}
     delete pmesh;
     delete pinput;
+    exec_instances::Finalize();
     Kokkos::finalize();
 #if MPI_PARALLEL_ENABLED
     MPI_Finalize();
@@ -301,6 +310,16 @@ int main(int argc, char *argv[]) {
   // in Driver.Initialize(). Add wall clock timer to Driver if necessary.
 
   ChangeRunDir(run_dir);
+  // Optionally auto-tune launch configuration of par_for_outer kernels during the run.
+  {
+    std::string tuning_file;
+    if (pinput->DoesParameterExist("job", "tuning_file")) {
+      tuning_file = pinput->GetString("job", "tuning_file");
+    }
+    launch_tuning::Initialize(pinput->GetOrAddBoolean("job", "tune_kernels", false),
+                              pinput->GetOrAddInteger("job", "tune_trials", 3),
+                              tuning_file);
+  } // extra brace to limit scope of string
   Driver* pdriver = new Driver(pinput, pmesh, wtlim, &timer);
   Outputs* pout = new Outputs(pinput, pmesh);
 
@@ -318,10 +337,12 @@ int main(int argc, char *argv[]) {
   // clean up, and terminate
   // Note anything containing a Kokkos::view must be deleted before Kokkos::finalize()
 
+  launch_tuning::Finalize();
   delete pout;
   delete pdriver;
   delete pmesh;
   delete pinput;
+  exec_instances::Finalize();
   Kokkos::finalize();
 #if MPI_PARALLEL_ENABLED
   MPI_Finalize();
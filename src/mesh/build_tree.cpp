@@ -8,8 +8,12 @@
 
 #include <iostream>
 #include <cinttypes>
+#include <cstdlib>  // abs
 #include <limits> // numeric_limits<>
+#include <map>
 #include <memory> // make_unique<>
+#include <tuple>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -344,6 +348,7 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   // Now copy mesh data read from restart file into Mesh variables. Order of variables
   // set by Write()'s in restart.cpp
   // Note this overwrites size and indices initialized in Mesh constructor.
+  RegionIndcs new_mb_indcs = mb_indcs;  // set from input parameters in Mesh constructor
   IOWrapperSizeT hdos = 0;
   std::memcpy(&nmb_total, &(headerdata[hdos]), sizeof(int));
   hdos += sizeof(int);
@@ -362,6 +367,38 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
   std::memcpy(&ncycle, &(headerdata[hdos]), sizeof(int));
   delete [] headerdata;
 
+  // MeshBlock size can be changed on restart by specifying new <meshblock>/nx1,nx2,nx3
+  // (e.g. on the command line).  MeshBlocks in the restart file are then split or merged
+  // by the same factor 2^rst_reblock in each direction (rst_reblock>0 to split), which
+  // shifts all logical levels including the root level.  Data is remapped onto the new
+  // MeshBlocks in the ProblemGenerator constructor for restarts.
+  if ((new_mb_indcs.nx1 != mb_indcs.nx1) || (new_mb_indcs.nx2 != mb_indcs.nx2) ||
+      (new_mb_indcs.nx3 != mb_indcs.nx3)) {
+    // returns log2(nold/nnew) if nold/nnew is a power of two (or its inverse), else 99
+    auto log2ratio = [](int nold, int nnew) {
+      int r = 0;
+      if (nold >= nnew) {
+        while ((nnew << r) < nold) {r++;}
+        return ((nnew << r) == nold) ? r : 99;
+      }
+      while ((nold << r) < nnew) {r++;}
+      return ((nold << r) == nnew) ? -r : 99;
+    };
+    int r = log2ratio(mb_indcs.nx1, new_mb_indcs.nx1);
+    if ((r == 99) || (multi_d && log2ratio(mb_indcs.nx2, new_mb_indcs.nx2) != r) ||
+        (three_d && log2ratio(mb_indcs.nx3, new_mb_indcs.nx3) != r)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MeshBlock size in restart file (" << mb_indcs.nx1 << "x"
+                << mb_indcs.nx2 << "x" << mb_indcs.nx3 << ") can only be changed by the "
+                << "same power-of-two factor in each direction" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    rst_reblock = r;
+    rst_mb_indcs = mb_indcs;
+    mb_indcs = new_mb_indcs;
+    root_level += r;
+  }
+
   // calculate the number of MeshBlocks at root level in each dir
   nmb_rootx1 = mesh_indcs.nx1/mb_indcs.nx1;
   nmb_rootx2 = mesh_indcs.nx2/mb_indcs.nx2;
@@ -417,6 +454,67 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile) {
     if (lloc_eachmb[i].level > current_level) current_level = lloc_eachmb[i].level;
   }
   delete [] idlist;
+
+  // With re-blocking, replace list of MeshBlocks read from restart file with list of
+  // MeshBlocks created by splitting (or merging) them.  Merging requires that all
+  // MeshBlocks to be merged exist at the same level.
+  if (rst_reblock != 0) {
+    rst_lloc_eachmb.assign(lloc_eachmb, lloc_eachmb + nmb_total);
+    int nsub1 = 1 << std::abs(rst_reblock);
+    int nsub2 = (multi_d)? nsub1 : 1;
+    int nsub3 = (three_d)? nsub1 : 1;
+    std::vector<LogicalLocation> new_lloc;
+    if (rst_reblock > 0) {
+      int r = rst_reblock;
+      for (auto &lloc : rst_lloc_eachmb) {
+        for (int k=0; k<nsub3; ++k) {
+          for (int j=0; j<nsub2; ++j) {
+            for (int i=0; i<nsub1; ++i) {
+              new_lloc.push_back({(lloc.lx1<<r) + i, (lloc.lx2<<r) + j,
+                                  (lloc.lx3<<r) + k, lloc.level + r});
+            }
+          }
+        }
+      }
+    } else {
+      int s = -rst_reblock;
+      std::map<std::tuple<int,int,int,int>, int> nmerged;
+      for (auto &lloc : rst_lloc_eachmb) {
+        nmerged[std::make_tuple(lloc.level-s, lloc.lx3>>s, lloc.lx2>>s, lloc.lx1>>s)]++;
+      }
+      for (auto &it : nmerged) {
+        if (it.second != nsub1*nsub2*nsub3) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "MeshBlocks in restart file cannot be merged into "
+                    << "larger MeshBlocks, since refined regions are not aligned with "
+                    << "new MeshBlock boundaries" << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
+        new_lloc.push_back({std::get<3>(it.first), std::get<2>(it.first),
+                            std::get<1>(it.first), std::get<0>(it.first)});
+      }
+    }
+    if (global_variable::my_rank == 0) {
+      std::cout << "Re-blocking restart: " << nmb_total << " MeshBlocks of size "
+                << rst_mb_indcs.nx1 << "x" << rst_mb_indcs.nx2 << "x" << rst_mb_indcs.nx3
+                << " replaced by " << new_lloc.size() << " MeshBlocks of size "
+                << mb_indcs.nx1 << "x" << mb_indcs.nx2 << "x" << mb_indcs.nx3
+                << std::endl;
+    }
+    // reallocate lists (ordered by new gids when tree is rebuilt below)
+    nmb_total = static_cast<int>(new_lloc.size());
+    delete [] cost_eachmb;
+    delete [] rank_eachmb;
+    delete [] lloc_eachmb;
+    cost_eachmb = new float[nmb_total];
+    rank_eachmb = new int[nmb_total];
+    lloc_eachmb = new LogicalLocation[nmb_total];
+    for (int i=0; i<nmb_total; i++) {
+      lloc_eachmb[i] = new_lloc[i];
+      cost_eachmb[i] = 1.0;
+    }
+    current_level += rst_reblock;
+  }
   if (!adaptive) max_level = current_level;
 
   // rebuild the MeshBlockTree
@@ -25,6 +25,7 @@
 #include "diffusion/resistivity.hpp"
 #include "diffusion/conduction.hpp"
 #include "radiation/radiation.hpp"
+#include "radiation_m1/radiation_m1.hpp"
 #include "particles/particles.hpp"
 #include "srcterms/srcterms.hpp"
 #include "outputs/io_wrapper.hpp"
@@ -174,6 +175,8 @@ Mesh::Mesh(ParameterInput *pin) :
     ?  true : false;
   multilevel = (adaptive || pin->GetString("mesh_refinement","refinement") == "static")
     ?  true : false;
+  // restrict every MeshBlock, rather than only those whose coarse data is used (testing)
+  restrict_all = pin->GetOrAddBoolean("mesh_refinement","restrict_all",false);
 
   // FIXME: The shearing box is not currently compatible with SMR/AMR
   if (multilevel && pin->DoesBlockExist("shearing_box")) {
@@ -344,6 +347,9 @@ Mesh::~Mesh() {
   if (multilevel) {
     delete pmr;
   }
+  if (pmact != nullptr) {
+    delete pmact;
+  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -576,8 +582,11 @@ void Mesh::NewTimeStep(const Real tlim) {
   // limit increase in timestep to 2x old value
   dt = 2.0*dt;
 
+  // fluid held fixed by radiation does not limit the timestep
+  bool fixed_fluid = (pmb_pack->prad != nullptr && pmb_pack->prad->fixed_fluid);
+
   // Hydro timestep
-  if (pmb_pack->phydro != nullptr) {
+  if (pmb_pack->phydro != nullptr && !(fixed_fluid)) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->dtnew) );
     // viscosity timestep
     if (pmb_pack->phydro->pvisc != nullptr) {
@@ -591,7 +600,7 @@ void Mesh::NewTimeStep(const Real tlim) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->psrc->dtnew) );
   }
   // MHD timestep
-  if (pmb_pack->pmhd != nullptr) {
+  if (pmb_pack->pmhd != nullptr && !(fixed_fluid)) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->dtnew) );
     // viscosity timestep
     if (pmb_pack->pmhd->pvisc != nullptr) {
@@ -616,6 +625,10 @@ void Mesh::NewTimeStep(const Real tlim) {
   if (pmb_pack->prad != nullptr) {
     dt = std::min(dt, (cfl_no)*(pmb_pack->prad->dtnew) );
   }
+  // M1 radiation timestep
+  if (pmb_pack->prm1 != nullptr) {
+    dt = std::min(dt, (cfl_no)*(pmb_pack->prm1->dtnew) );
+  }
   // Particles timestep
   if (pmb_pack->ppart != nullptr) {
     dt = std::min(dt, (pmb_pack->ppart->dtnew) );
@@ -626,6 +639,11 @@ void Mesh::NewTimeStep(const Real tlim) {
   MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
 #endif
 
+  // with multirate z4c, limit matter time steps to end on spacetime time levels
+  if (pmb_pack->pz4c != nullptr) {
+    pmb_pack->pz4c->MultirateLimitDt(dt, time);
+  }
+
   // limit last time step to stop at tlim *exactly*
   if ( (time < tlim) && ((time + dt) > tlim) ) {dt = tlim - time;}
 
@@ -642,6 +660,11 @@ void Mesh::AddCoordinatesAndPhysics(ParameterInput *pinput) {
     pmb_pack->AddPhysics(pinput);
   }
 
+  // Freeze evolution of inactive MeshBlocks, if requested
+  if (pinput->DoesBlockExist("mesh_activity")) {
+    pmact = new MeshActivity(this, pinput);
+  }
+
   // Determine total number of particles across all ranks
   particles::Particles *ppart = pmb_pack->ppart;
   if (ppart != nullptr) {
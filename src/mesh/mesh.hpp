@@ -14,6 +14,7 @@
 #include <cstdint>  // int32_t
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 
@@ -84,6 +85,7 @@ class Mesh;
 #include "meshblock_pack.hpp"
 #include "meshblock_tree.hpp"
 #include "mesh_refinement.hpp"
+#include "mesh_activity.hpp"
 
 //----------------------------------------------------------------------------------------
 //! \class Mesh
@@ -114,6 +116,7 @@ class Mesh {
   bool multi_d;               // flag to indicate 2D and 3D calculations
   bool multilevel;            // true for SMR and AMR
   bool adaptive;              // true only for AMR
+  bool restrict_all;          // restrict all MBs, not only those that need coarse data
 
   int nmb_rootx1, nmb_rootx2, nmb_rootx3; // # of MeshBlocks at root level in each dir
   int nmb_total;           // total number of MeshBlocks across all levels/ranks
@@ -123,6 +126,12 @@ class Mesh {
   int root_level; // logical level of root (physical) grid (e.g. Fig. 3 of method paper)
   int max_level;  // logical level of maximum refinement grid in Mesh
 
+  // MeshBlock decomposition stored in restart file, when MeshBlocks are re-blocked on
+  // restart (by factor 2^rst_reblock in each direction) in BuildTreeFromRestart()
+  int rst_reblock=0;                             // 0 if MeshBlocks are not re-blocked
+  RegionIndcs rst_mb_indcs;                      // MeshBlock indices in restart file
+  std::vector<LogicalLocation> rst_lloc_eachmb;  // LogicalLocations in restart file
+
   int nprtcl_thisrank;     // number of particles this rank
   int nprtcl_total;        // total number of particles across all ranks
 
@@ -145,6 +154,7 @@ class Mesh {
   MeshBlockPack* pmb_pack;                 // container for MeshBlocks on this rank
   std::unique_ptr<ProblemGenerator> pgen;  // class containing functions to set ICs
   MeshRefinement *pmr=nullptr;             // mesh refinement data/functions (if needed)
+  MeshActivity *pmact=nullptr;             // freezing of inactive MeshBlocks (if needed)
 
   // functions
   void BuildTreeFromScratch(ParameterInput *pin);
@@ -0,0 +1,270 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file mesh_activity.cpp
+//! \brief Implements constructor and functions in MeshActivity class.
+//!
+//! MeshBlocks are frozen when every cell is excised (freeze_excised=true), when flagged
+//! by a user function (ProblemGenerator::user_activity_func), or when the maximum change
+//! of every conserved variable over the last cycle relative to its maximum in the
+//! MeshBlock is below change_threshold.  MeshBlocks adjacent to any MeshBlock that
+//! changed are kept active, so frozen regions are woken up before a disturbance arrives.
+//!
+//! Frozen MeshBlocks skip the Hydro/MHD update and source terms, and do not limit the
+//! timestep, and those without active neighbors also skip calculation of fluxes.  Since
+//! a frozen hydrostatic region would drift if source terms were applied without the
+//! balancing flux divergence, conserved variables of frozen MeshBlocks are reset to
+//! their values at the start of the cycle after source terms.  Frozen MeshBlocks still
+//! exchange boundary data and compute primitives, so that they provide valid ghost zones
+//! to active neighbors, and can be reactivated at any check.
+
+#include <iostream>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh.hpp"
+#include "mesh_activity.hpp"
+#include "driver/driver.hpp"
+#include "pgen/pgen.hpp"
+#include "coordinates/coordinates.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace {
+//----------------------------------------------------------------------------------------
+// Stores in dmax(m) the maximum over variables of max|u0-u1|/max|u1| in each MeshBlock,
+// where u1 holds the conserved variables at the start of the last cycle.
+
+void MaxRelativeChange(Mesh *pm, DvceArray5D<Real> &u0, DvceArray5D<Real> &u1,
+                       DvceArray1D<Real> &dmax) {
+  auto &indcs = pm->mb_indcs;
+  int is = indcs.is, nx1 = indcs.nx1;
+  int js = indcs.js, nx2 = indcs.nx2;
+  int ks = indcs.ks, nx3 = indcs.nx3;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  int nvar = u0.extent_int(1);
+  auto dmax_ = dmax;
+
+  par_for_outer("ActivityChange",DevExeSpace(), 0, 0, 0, (nmb-1),
+  KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
+    Real rel_max = 0.0;
+    for (int n=0; n<nvar; ++n) {
+      Real team_du = 0.0, team_u = 0.0;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+      [=](const int idx, Real& du) {
+        int k = (idx)/nji;
+        int j = (idx - k*nji)/nx1;
+        int i = (idx - k*nji - j*nx1) + is;
+        j += js;
+        k += ks;
+        du = fmax(fabs(u0(m,n,k,j,i) - u1(m,n,k,j,i)), du);
+      },Kokkos::Max<Real>(team_du));
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+      [=](const int idx, Real& umax) {
+        int k = (idx)/nji;
+        int j = (idx - k*nji)/nx1;
+        int i = (idx - k*nji - j*nx1) + is;
+        j += js;
+        k += ks;
+        umax = fmax(fabs(u1(m,n,k,j,i)), umax);
+      },Kokkos::Max<Real>(team_u));
+      if (team_du > 0.0) {
+        rel_max = fmax(rel_max, ((team_u > 0.0)? team_du/team_u : 1.0));
+      }
+    }
+    dmax_(m) = fmax(dmax_(m), rel_max);
+  });
+  return;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+// MeshActivity constructor:
+// called from Mesh::AddCoordinatesAndPhysics() when the <mesh_activity> block exists
+
+MeshActivity::MeshActivity(Mesh *pm, ParameterInput *pin) :
+  nmb_active(pm->nmb_total),
+  pmy_mesh(pm),
+  nmb_amr_last_(0) {
+  ncyc_check = pin->GetOrAddInteger("mesh_activity", "ncycle_check", 1);
+  change_threshold = pin->GetOrAddReal("mesh_activity", "change_threshold", 0.0);
+  freeze_excised = pin->GetOrAddBoolean("mesh_activity", "freeze_excised", false);
+  if (ncyc_check < 1) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<mesh_activity>/ncycle_check must be >= 1" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if ((pm->pmb_pack->phydro == nullptr) && (pm->pmb_pack->pmhd == nullptr)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<mesh_activity> requires <hydro> or <mhd> block"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshActivity::UpdateActivity()
+//! \brief Sets activity of all MeshBlocks.  Called by Driver at the end of each cycle
+//! (after AMR, and before the new timestep is computed).  Activity is exchanged between
+//! all ranks, since it depends on the state of neighboring MeshBlocks.
+
+void MeshActivity::UpdateActivity(Driver *pdrive) {
+  // u1 is not redistributed by AMR, so change over last cycle is unknown if mesh changed
+  bool mesh_changed = false;
+  if (pmy_mesh->adaptive) {
+    int nmb_amr = pmy_mesh->pmr->nmb_created + pmy_mesh->pmr->nmb_deleted;
+    mesh_changed = (nmb_amr != nmb_amr_last_);
+    nmb_amr_last_ = nmb_amr;
+  }
+  if ((pmy_mesh->ncycle)%(ncyc_check) != 0) {return;}
+  MeshBlockPack *pmbp = pmy_mesh->pmb_pack;
+  auto &activity = pmbp->pmb->mb_activity;
+  int nmb = pmbp->nmb_thispack;
+  int mbs = pmy_mesh->gids_eachrank[global_variable::my_rank];
+
+  // u1 does not store the state at the start of the cycle with RK4
+  if (change_threshold > 0.0 && pdrive->integrator == "rk4") {
+    if (global_variable::my_rank == 0) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "<mesh_activity>/change_threshold cannot be used with rk4 "
+                << "integrator, and is ignored" << std::endl;
+    }
+    change_threshold = 0.0;
+  }
+
+  // (1) Set MeshBlocks frozen irrespective of evolution: first mark all MBs active, then
+  // freeze fully excised MBs and those flagged by user function (on device)
+  for (int m=0; m<nmb; ++m) {
+    activity.h_view(m) = 1;
+  }
+  activity.template modify<HostMemSpace>();
+  activity.template sync<DevExeSpace>();
+
+  auto &coord = pmbp->pcoord->coord_data;
+  if (freeze_excised && coord.bh_excise) {
+    auto &indcs = pmy_mesh->mb_indcs;
+    int is = indcs.is, nx1 = indcs.nx1;
+    int js = indcs.js, nx2 = indcs.nx2;
+    int ks = indcs.ks, nx3 = indcs.nx3;
+    const int nkji = nx3*nx2*nx1;
+    const int nji  = nx2*nx1;
+    auto &excised = pmbp->pcoord->excision_floor;
+    auto activity_ = activity;
+    par_for_outer("ActivityExcise",DevExeSpace(), 0, 0, 0, (nmb-1),
+    KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
+      int team_nexcised = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+      [=](const int idx, int& nexcised) {
+        int k = (idx)/nji;
+        int j = (idx - k*nji)/nx1;
+        int i = (idx - k*nji - j*nx1) + is;
+        j += js;
+        k += ks;
+        if (excised(m,k,j,i)) {nexcised += 1;}
+      },Kokkos::Sum<int>(team_nexcised));
+      if (team_nexcised == nkji) {activity_.d_view(m) = 0;}
+    });
+  }
+  if (pmy_mesh->pgen->user_activity_func != nullptr) {
+    pmy_mesh->pgen->user_activity_func(pmbp);
+  }
+  activity.template modify<DevExeSpace>();
+  activity.template sync<HostMemSpace>();
+
+  // (2) Find relative change of conserved variables over last cycle.  All MeshBlocks are
+  // treated as changing when the mesh was just refined.
+  DvceArray1D<Real> dmax("dmax", nmb);
+  if (change_threshold > 0.0 && !(mesh_changed)) {
+    if (pmbp->phydro != nullptr) {
+      MaxRelativeChange(pmy_mesh, pmbp->phydro->u0, pmbp->phydro->u1, dmax);
+    }
+    if (pmbp->pmhd != nullptr) {
+      MaxRelativeChange(pmy_mesh, pmbp->pmhd->u0, pmbp->pmhd->u1, dmax);
+    }
+  }
+  auto h_dmax = Kokkos::create_mirror_view_and_copy(HostMemSpace(), dmax);
+
+  // (3) Flag MeshBlocks that are changing (and not forced to be frozen), and pass flags
+  // between all ranks
+  int nmb_total = pmy_mesh->nmb_total;
+  std::vector<int> changing(nmb_total, 0), active(nmb_total, 0);
+  std::vector<bool> forced(nmb, false);
+  for (int m=0; m<nmb; ++m) {
+    forced[m] = (activity.h_view(m) == 0);
+    changing[m+mbs] = !(forced[m]) && ((change_threshold <= 0.0) || mesh_changed ||
+                                       (h_dmax(m) >= change_threshold));
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allgatherv(MPI_IN_PLACE, nmb, MPI_INT, changing.data(), pmy_mesh->nmb_eachrank,
+                 pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
+#endif
+
+  // (4) MeshBlocks that are changing, or adjacent to a changing MB, are active
+  auto &nghbr = pmbp->pmb->nghbr;
+  int nnghbr = pmbp->pmb->nnghbr;
+  for (int m=0; m<nmb; ++m) {
+    active[m+mbs] = changing[m+mbs];
+    if (!(forced[m])) {
+      for (int n=0; n<nnghbr; ++n) {
+        int gid = nghbr.h_view(m,n).gid;
+        if (gid >= 0 && changing[gid]) {active[m+mbs] = 1;}
+      }
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allgatherv(MPI_IN_PLACE, nmb, MPI_INT, active.data(), pmy_mesh->nmb_eachrank,
+                 pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
+#endif
+
+  // (5) Frozen MeshBlocks adjacent to an active MB still compute fluxes, which are needed
+  // for flux/EMF correction by their active neighbors
+  for (int m=0; m<nmb; ++m) {
+    if (active[m+mbs]) {
+      activity.h_view(m) = 1;
+    } else {
+      activity.h_view(m) = -1;
+      for (int n=0; n<nnghbr; ++n) {
+        int gid = nghbr.h_view(m,n).gid;
+        if (gid >= 0 && active[gid]) {activity.h_view(m) = 0;}
+      }
+    }
+  }
+  activity.template modify<HostMemSpace>();
+  activity.template sync<DevExeSpace>();
+
+  nmb_active = 0;
+  for (int m=0; m<nmb_total; ++m) {
+    nmb_active += active[m];
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshActivity::ResetFrozen()
+//! \brief Resets conserved variables u0 of frozen MeshBlocks to u1, which stores their
+//! values at the start of the cycle (the RK update, including the u1 register update of
+//! rk4, is skipped for frozen MeshBlocks).  Called after source terms are added in each
+//! stage, so source terms (including user sources) have no effect on frozen MeshBlocks.
+
+void MeshActivity::ResetFrozen(DvceArray5D<Real> &u0, DvceArray5D<Real> &u1) {
+  if (nmb_active == pmy_mesh->nmb_total) {return;}
+  int nmb1 = pmy_mesh->pmb_pack->nmb_thispack - 1;
+  int nvar = u0.extent_int(1);
+  int n3 = u0.extent_int(2) - 1, n2 = u0.extent_int(3) - 1, n1 = u0.extent_int(4) - 1;
+  auto &activity = pmy_mesh->pmb_pack->pmb->mb_activity;
+  par_for("reset_frozen", TaskExeSpace(), 0, nmb1, 0, nvar-1, 0, n3, 0, n2, 0, n1,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    if (activity.d_view(m) < 1) {u0(m,n,k,j,i) = u1(m,n,k,j,i);}
+  });
+  return;
+}
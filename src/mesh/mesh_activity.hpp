@@ -0,0 +1,39 @@
+#ifndef MESH_MESH_ACTIVITY_HPP_
+#define MESH_MESH_ACTIVITY_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file mesh_activity.hpp
+//! \brief defines MeshActivity class, which freezes the evolution of Hydro/MHD variables
+//! in MeshBlocks that are dynamically irrelevant.  Enabled by the <mesh_activity> block.
+
+// forward declarations
+class Driver;
+
+//----------------------------------------------------------------------------------------
+//! \class MeshActivity
+//! \brief data/functions used to set activity of each MeshBlock (MeshBlock::mb_activity)
+
+class MeshActivity {
+ public:
+  MeshActivity(Mesh *pm, ParameterInput *pin);
+  ~MeshActivity() = default;
+
+  // data
+  int ncyc_check;          // # of cycles between updates of activity
+  Real change_threshold;   // relative change per cycle below which MBs are frozen
+  bool freeze_excised;     // freeze MeshBlocks in which all cells are excised
+  int nmb_active;          // # of active MeshBlocks across all ranks after last update
+
+  // functions
+  void UpdateActivity(Driver *pdrive);
+  void ResetFrozen(DvceArray5D<Real> &u0, DvceArray5D<Real> &u1);
+
+ private:
+  Mesh *pmy_mesh;
+  int nmb_amr_last_;       // # of MeshBlocks created+deleted by AMR at last call
+};
+
+#endif // MESH_MESH_ACTIVITY_HPP_
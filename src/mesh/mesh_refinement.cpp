@@ -14,6 +14,7 @@
 #include <cmath>     // abs
 #include <algorithm> // sort
 #include <utility>   // pair
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -24,6 +25,7 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "radiation/radiation.hpp"
+#include "radiation_m1/radiation_m1.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
 #include "prolongation.hpp"
@@ -41,16 +43,23 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   pmy_mesh(pm),
   refine_flag("rflag",pm->nmb_total),
   ncyc_since_ref("cyc_since_ref",pm->nmb_total),
+  nderef_flagged("nderef_flagged",pm->nmb_total),
   nmb_created(0),
   nmb_deleted(0),
   nmb_sent_thisrank(0),
   ncyc_check_amr(1),
   refinement_interval(5),
   prolong_prims(false),
+  nbuffer_ref(0),
+  buffer_downstream(true),
+  nderef_check(1),
   d_threshold_(0.0),
   dd_threshold_(0.0),
   dp_threshold_(0.0),
   dv_threshold_(0.0),
+  d_deref_threshold_(0.0),
+  dd_deref_threshold_(0.0),
+  dp_deref_threshold_(0.0),
   check_cons_(false) {
   if (pin->DoesBlockExist("mesh_refinement")) {
     // read interval (in cycles) between check of AMR and derefinement
@@ -77,6 +86,34 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
       dd_threshold_ = pin->GetReal("mesh_refinement", "dvel_max");
       check_cons_ = true;
     }
+    // read derefinement thresholds, which default to the original fixed fractions of the
+    // refinement thresholds.  Setting them lower than the refinement thresholds adds
+    // hysteresis, so MBs near a threshold are not repeatedly refined and derefined.
+    d_deref_threshold_ = pin->GetOrAddReal("mesh_refinement", "dens_deref",
+                                           d_threshold_);
+    dd_deref_threshold_ = pin->GetOrAddReal("mesh_refinement", "ddens_deref",
+                                            0.25*dd_threshold_);
+    dp_deref_threshold_ = pin->GetOrAddReal("mesh_refinement", "dpres_deref",
+                                            0.25*dp_threshold_);
+    if ((d_deref_threshold_ > d_threshold_) || (dd_deref_threshold_ > dd_threshold_) ||
+        (dp_deref_threshold_ > dp_threshold_)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Derefinement thresholds in <mesh_refinement> block "
+                << "cannot be larger than refinement thresholds" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    // read number of layers of buffer MBs refined around (or downstream of) flagged MBs,
+    // and number of successive checks a MB must be flagged before it is derefined
+    nbuffer_ref = pin->GetOrAddInteger("mesh_refinement", "refine_buffer", 0);
+    buffer_downstream = pin->GetOrAddBoolean("mesh_refinement", "buffer_downstream",
+                                             true);
+    nderef_check = pin->GetOrAddInteger("mesh_refinement", "derefine_count", 1);
+    if (nbuffer_ref < 0 || nderef_check < 1) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<mesh_refinement>/refine_buffer must be >= 0 and "
+                << "<mesh_refinement>/derefine_count must be >= 1" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
   }
 
   if (pm->adaptive) {  // allocate arrays for AMR
@@ -90,6 +127,7 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   for (int m=0; m<(pm->nmb_total); ++m) {
     refine_flag.h_view(m) = 0;
     ncyc_since_ref(m) = 0;
+    nderef_flagged(m) = 0;
   }
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
@@ -142,6 +180,9 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
     if (pmbp->prad != nullptr) {
       (void) pmbp->prad->NewTimeStep(pdriver, pdriver->nexp_stages);
     }
+    if (pmbp->prm1 != nullptr) {
+      (void) pmbp->prm1->NewTimeStep(pdriver, pdriver->nexp_stages);
+    }
     if (pmbp->pz4c != nullptr) {
       (void) pmbp->pz4c->NewTimeStep(pdriver, pdriver->nexp_stages);
     }
@@ -196,6 +237,9 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
   auto &dens_thresh  = d_threshold_;
   auto &ddens_thresh = dd_threshold_;
   auto &dpres_thresh = dp_threshold_;
+  auto &dens_deref  = d_deref_threshold_;
+  auto &ddens_deref = dd_deref_threshold_;
+  auto &dpres_deref = dp_deref_threshold_;
   int nmb = pmbp->nmb_thispack;
   int mbs = pmy_mesh->gids_eachrank[global_variable::my_rank];
   if (((pmbp->phydro != nullptr) || (pmbp->pmhd != nullptr)) && check_cons_) {
@@ -204,6 +248,10 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
 
     par_for_outer("ConsRefineCond",DevExeSpace(), 0, 0, 0, (nmb-1),
     KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
+      // MB is refined if any condition is above its refinement threshold, and derefined
+      // only if all conditions are below their derefinement thresholds
+      bool refine = false, derefine = true;
+
       // density threshold
       if (dens_thresh!= 0.0) {
         Real team_dmax=0.0;
@@ -217,8 +265,8 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
           dmax = fmax(u0(m,IDN,k,j,i), dmax);
         },Kokkos::Max<Real>(team_dmax));
 
-        if (team_dmax > dens_thresh) {refine_flag_.d_view(m+mbs) = 1;}
-        if (team_dmax < dens_thresh) {refine_flag_.d_view(m+mbs) = -1;}
+        if (team_dmax > dens_thresh) {refine = true;}
+        if (team_dmax >= dens_deref) {derefine = false;}
       }
 
       // density gradient threshold
@@ -237,8 +285,8 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
           ddmax = fmax((sqrt(d2)/u0(m,IDN,k,j,i)), ddmax);
         },Kokkos::Max<Real>(team_ddmax));
 
-        if (team_ddmax > ddens_thresh) {refine_flag_.d_view(m+mbs) = 1;}
-        if (team_ddmax < 0.25*ddens_thresh) {refine_flag_.d_view(m+mbs) = -1;}
+        if (team_ddmax > ddens_thresh) {refine = true;}
+        if (team_ddmax >= ddens_deref) {derefine = false;}
       }
 
       // pressure gradient threshold
@@ -257,8 +305,14 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
           dpmax = fmax((sqrt(d2)/w0(m,IEN,k,j,i)), dpmax);
         },Kokkos::Max<Real>(team_dpmax));
 
-        if (team_dpmax > dpres_thresh) {refine_flag_.d_view(m+mbs) = 1;}
-        if (team_dpmax < 0.25*dpres_thresh) {refine_flag_.d_view(m+mbs) = -1;}
+        if (team_dpmax > dpres_thresh) {refine = true;}
+        if (team_dpmax >= dpres_deref) {derefine = false;}
+      }
+
+      if (refine) {
+        refine_flag_.d_view(m+mbs) = 1;
+      } else if (derefine) {
+        refine_flag_.d_view(m+mbs) = -1;
       }
     });
   }
@@ -285,16 +339,143 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
   for (int m=0; m<nmb; ++m) {
     if (ncyc_since_ref(m+mbs) < refinement_interval) {refine_flag.h_view(m+mbs) = 0;}
   }
+
+  // Check (on host) that MB has been flagged for derefinement on enough successive checks
+  for (int m=0; m<nmb; ++m) {
+    if (refine_flag.h_view(m+mbs) < 0) {
+      nderef_flagged(m+mbs) += 1;
+      if (nderef_flagged(m+mbs) < nderef_check) {refine_flag.h_view(m+mbs) = 0;}
+    } else {
+      nderef_flagged(m+mbs) = 0;
+    }
+  }
 #if MPI_PARALLEL_ENABLED
   // Pass refine_flag between all ranks
     MPI_Allgatherv(MPI_IN_PLACE, pmy_mesh->nmb_eachrank[global_variable::my_rank],
                    MPI_INT, refine_flag.h_view.data(), pmy_mesh->nmb_eachrank,
                    pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
+  // counters must be valid on all ranks, since MBs may move to other ranks after AMR
+  if (nderef_check > 1) {
+    MPI_Allgatherv(MPI_IN_PLACE, pmy_mesh->nmb_eachrank[global_variable::my_rank],
+                   MPI_INT, nderef_flagged.data(), pmy_mesh->nmb_eachrank,
+                   pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
+  }
 #endif
   // sync host array with device
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
 
+  // Add buffer of refined MBs around flagged MBs
+  if (nbuffer_ref > 0) {AddRefinementBuffer(pmbp);}
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::AddRefinementBuffer()
+//! \brief Flags for refinement nbuffer_ref layers of neighbors around MeshBlocks already
+//! flagged, so that moving features remain inside the refined region between checks and
+//! ncycle_check can be larger.  With buffer_downstream=true (and Hydro/MHD), neighbors
+//! whose mean velocity points back towards the flagged MB (upstream neighbors) are not
+//! refined.  No neighbor of a MB flagged for refinement is derefined.
+//! Must be called with refine_flag up-to-date on all ranks.
+
+void MeshRefinement::AddRefinementBuffer(MeshBlockPack* pmbp) {
+  int nmb = pmbp->nmb_thispack;
+  int nmb_total = pmy_mesh->nmb_total;
+  int mbs = pmy_mesh->gids_eachrank[global_variable::my_rank];
+
+  // compute (on device) mass-weighted mean velocity in each MB
+  bool use_vel = buffer_downstream &&
+                 ((pmbp->phydro != nullptr) || (pmbp->pmhd != nullptr));
+  DvceArray2D<Real> vel("vel", nmb, 3);
+  if (use_vel) {
+    auto &indcs = pmy_mesh->mb_indcs;
+    int is = indcs.is, nx1 = indcs.nx1;
+    int js = indcs.js, nx2 = indcs.nx2;
+    int ks = indcs.ks, nx3 = indcs.nx3;
+    const int nkji = nx3*nx2*nx1;
+    const int nji  = nx2*nx1;
+    auto &u0 = (pmbp->phydro != nullptr)? pmbp->phydro->u0 : pmbp->pmhd->u0;
+    par_for_outer("BufferVel",DevExeSpace(), 0, 0, 0, (nmb-1),
+    KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
+      Real team_mass = 0.0;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+      [=](const int idx, Real& mass) {
+        int k = (idx)/nji;
+        int j = (idx - k*nji)/nx1;
+        int i = (idx - k*nji - j*nx1) + is;
+        j += js;
+        k += ks;
+        mass += u0(m,IDN,k,j,i);
+      },Kokkos::Sum<Real>(team_mass));
+      for (int n=0; n<3; ++n) {
+        Real team_mom = 0.0;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+        [=](const int idx, Real& mom) {
+          int k = (idx)/nji;
+          int j = (idx - k*nji)/nx1;
+          int i = (idx - k*nji - j*nx1) + is;
+          j += js;
+          k += ks;
+          mom += u0(m,IM1+n,k,j,i);
+        },Kokkos::Sum<Real>(team_mom));
+        vel(m,n) = (team_mass > 0.0)? team_mom/team_mass : 0.0;
+      }
+    });
+  }
+  auto h_vel = Kokkos::create_mirror_view_and_copy(HostMemSpace(), vel);
+
+  // Each pass adds one layer of neighbors to MBs flagged for refinement
+  auto &nghbr = pmbp->pmb->nghbr;
+  int nnghbr = pmbp->pmb->nnghbr;
+  LogicalLocation *lloc = pmy_mesh->lloc_eachmb;
+  std::vector<int> flagged(nmb_total);
+  for (int l=0; l<nbuffer_ref; ++l) {
+    for (int n=0; n<nmb_total; ++n) {
+      flagged[n] = (refine_flag.h_view(n) > 0);
+    }
+    for (int m=0; m<nmb; ++m) {
+      int &flag = refine_flag.h_view(m+mbs);
+      if (flag > 0) {continue;}
+      auto &myloc = lloc[m+mbs];
+      for (int n=0; n<nnghbr; ++n) {
+        int gid = nghbr.h_view(m,n).gid;
+        if (gid < 0 || !(flagged[gid])) {continue;}
+        if (flag < 0) {flag = 0;}
+        // coarser neighbors are refined to maintain 2:1 ratio anyway, so only refine
+        // neighbors at same level as flagged MB
+        if ((myloc.level != lloc[gid].level) || (myloc.level == pmy_mesh->max_level) ||
+            (ncyc_since_ref(m+mbs) < refinement_interval)) {continue;}
+        if (use_vel) {
+          // offset of this MB from flagged MB, accounting for periodic boundaries
+          int shift = myloc.level - pmy_mesh->root_level;
+          int nx[3] = {(pmy_mesh->nmb_rootx1 << shift), (pmy_mesh->nmb_rootx2 << shift),
+                       (pmy_mesh->nmb_rootx3 << shift)};
+          int dx[3] = {static_cast<int>(myloc.lx1 - lloc[gid].lx1),
+                       static_cast<int>(myloc.lx2 - lloc[gid].lx2),
+                       static_cast<int>(myloc.lx3 - lloc[gid].lx3)};
+          Real vdotd = 0.0;
+          for (int d=0; d<3; ++d) {
+            if (2*dx[d] > nx[d]) {dx[d] -= nx[d];}
+            if (2*dx[d] < -nx[d]) {dx[d] += nx[d];}
+            vdotd += h_vel(m,d)*static_cast<Real>(dx[d]);
+          }
+          if (vdotd < 0.0) {continue;}
+        }
+        flag = 1;
+        break;
+      }
+    }
+#if MPI_PARALLEL_ENABLED
+    MPI_Allgatherv(MPI_IN_PLACE, pmy_mesh->nmb_eachrank[global_variable::my_rank],
+                   MPI_INT, refine_flag.h_view.data(), pmy_mesh->nmb_eachrank,
+                   pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
+#endif
+  }
+  refine_flag.template modify<HostMemSpace>();
+  refine_flag.template sync<DevExeSpace>();
+
   return;
 }
 
@@ -648,6 +829,19 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   Kokkos::realloc(ncyc_since_ref, new_nmb_total);
   Kokkos::deep_copy(ncyc_since_ref, new_ncyc_since_ref);
 
+  // Update new number of successive checks flagged for derefinement
+  HostArray1D<int> new_nderef_flagged("nderef",new_nmb_total);
+  for (int m=0; m<(new_nmb_total); ++m) {
+    int oldm = newtoold[m];
+    if (refine_flag.h_view(oldm) != 0) {
+      new_nderef_flagged(m) = 0;
+    } else {
+      new_nderef_flagged(m) = nderef_flagged(oldm);
+    }
+  }
+  Kokkos::realloc(nderef_flagged, new_nmb_total);
+  Kokkos::deep_copy(nderef_flagged, new_nderef_flagged);
+
   // Step 10.
   // Update data in Mesh/MeshBlockPack/MeshBlock classes with new grid properties
   delete [] pm->lloc_eachmb;
@@ -1178,8 +1372,13 @@ void MeshRefinement::RefineFC(DualArray1D<int> &n2o, DvceFaceFld4D<Real> &b,
 
 void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
     bool is_z4c) {
-  int nmb  = u.extent_int(0);  // TODO(@user): 1st index from L of in array must be NMB
   int nvar = u.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
+  // only restrict MeshBlocks whose coarse data is used (see MeshBlock::SetNeighbors()).
+  // Z4c appends coarse data to every exchange with a neighbor at the same level, so all
+  // MeshBlocks are restricted.
+  int nmr = (is_z4c)? pmy_mesh->pmb_pack->nmb_thispack :
+                      pmy_mesh->pmb_pack->pmb->nmb_restrict;
+  auto &mbr = pmy_mesh->pmb_pack->pmb->mb_restrict.d_view;
 
   auto &indcs = pmy_mesh->mb_indcs;
   auto &cis = indcs.cis, &cie = indcs.cie;
@@ -1193,15 +1392,17 @@ void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
   auto& restrict_4th_edge = weights.restrict_4th_edge;
   // restrict in 1D
   if (pmy_mesh->one_d) {
-    par_for("restrictCC-1D",DevExeSpace(), 0,nmb-1, 0,nvar-1, cis,cie,
-    KOKKOS_LAMBDA(const int m, const int n, const int i) {
+    par_for("restrictCC-1D",TaskExeSpace(), 0,nmr-1, 0,nvar-1, cis,cie,
+    KOKKOS_LAMBDA(const int mr, const int n, const int i) {
+      int m = (is_z4c)? mr : mbr(mr);
       int finei = 2*i - cis;  // correct when cis=is
       cu(m,n,cks,cjs,i) = 0.5*(u(m,n,cks,cjs,finei) + u(m,n,cks,cjs,finei+1));
     });
   // restrict in 2D
   } else if (pmy_mesh->two_d) {
-    par_for("restrictCC-2D",DevExeSpace(), 0,nmb-1, 0,nvar-1, cjs,cje, cis,cie,
-    KOKKOS_LAMBDA(const int m, const int n, const int j, const int i) {
+    par_for("restrictCC-2D",TaskExeSpace(), 0,nmr-1, 0,nvar-1, cjs,cje, cis,cie,
+    KOKKOS_LAMBDA(const int mr, const int n, const int j, const int i) {
+      int m = (is_z4c)? mr : mbr(mr);
       int finei = 2*i - cis;  // correct when cis=is
       int finej = 2*j - cjs;  // correct when cjs=js
       cu(m,n,cks,j,i) = 0.25*(u(m,n,cks,finej  ,finei) + u(m,n,cks,finej  ,finei+1)
@@ -1210,8 +1411,9 @@ void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
 
   // restrict in 3D
   } else {
-    par_for("restrictCC-3D",DevExeSpace(), 0,nmb-1, 0,nvar-1, cks,cke, cjs,cje, cis,cie,
-    KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
+    par_for("restrictCC-3D",TaskExeSpace(), 0,nmr-1, 0,nvar-1, cks,cke, cjs,cje, cis,cie,
+    KOKKOS_LAMBDA(const int mr, const int n, const int k, const int j, const int i) {
+      int m = (is_z4c)? mr : mbr(mr);
       int finei = 2*i - cis;  // correct when cis=is
       int finej = 2*j - cjs;  // correct when cjs=js
       int finek = 2*k - cks;  // correct when cks=ks
@@ -1241,7 +1443,9 @@ void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
 //! \brief Restricts face-centered variables to coarse mesh
 
 void MeshRefinement::RestrictFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb) {
-  int nmb  = b.x1f.extent_int(0);  // TODO(@user): 1st idx from L of in array must be NMB
+  // only restrict MeshBlocks whose coarse data is used (see MeshBlock::SetNeighbors())
+  int nmr = pmy_mesh->pmb_pack->pmb->nmb_restrict;
+  auto &mbr = pmy_mesh->pmb_pack->pmb->mb_restrict.d_view;
 
   auto &cis = pmy_mesh->mb_indcs.cis;
   auto &cie = pmy_mesh->mb_indcs.cie;
@@ -1252,8 +1456,9 @@ void MeshRefinement::RestrictFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb)
 
   // restrict in 1D
   if (pmy_mesh->one_d) {
-    par_for("restrictFC-1D",DevExeSpace(), 0,nmb-1, cis,cie,
-    KOKKOS_LAMBDA(const int m, const int i) {
+    par_for("restrictFC-1D",TaskExeSpace(), 0,nmr-1, cis,cie,
+    KOKKOS_LAMBDA(const int mr, const int i) {
+      int m = mbr(mr);
       int finei = 2*i - cis;  // correct when cis=is
       // restrict B1
       cb.x1f(m,cks,cjs,i) = b.x1f(m,cks,cjs,finei);
@@ -1272,8 +1477,9 @@ void MeshRefinement::RestrictFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb)
 
   // restrict in 2D
   } else if (pmy_mesh->two_d) {
-    par_for("restrictFC-2D",DevExeSpace(), 0,nmb-1, cjs,cje, cis,cie,
-    KOKKOS_LAMBDA(const int m, const int j, const int i) {
+    par_for("restrictFC-2D",TaskExeSpace(), 0,nmr-1, cjs,cje, cis,cie,
+    KOKKOS_LAMBDA(const int mr, const int j, const int i) {
+      int m = mbr(mr);
       int finei = 2*i - cis;  // correct when cis=is
       int finej = 2*j - cjs;  // correct when cjs=js
       // restrict B1
@@ -1297,8 +1503,9 @@ void MeshRefinement::RestrictFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb)
 
   // restrict in 3D
   } else {
-    par_for("restrictFC-3D",DevExeSpace(), 0,nmb-1, cks,cke, cjs,cje, cis,cie,
-    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    par_for("restrictFC-3D",TaskExeSpace(), 0,nmr-1, cks,cke, cjs,cje, cis,cie,
+    KOKKOS_LAMBDA(const int mr, const int k, const int j, const int i) {
+      int m = mbr(mr);
       int finei = 2*i - cis;  // correct when cis=is
       int finej = 2*j - cjs;  // correct when cjs=js
       int finek = 2*k - cks;  // correct when cks=ks
@@ -50,10 +50,14 @@ class MeshRefinement {
   int ncyc_check_amr;        // # of cycles between checking mesh for ref/derefinement
   int refinement_interval;   // # of cycles between allowing successive ref/derefinement
   bool prolong_prims;        // flag to enable prolongation of primitive vars
+  int nbuffer_ref;           // # of layers of neighbors refined with flagged MeshBlocks
+  bool buffer_downstream;    // only refine neighbors downstream of flagged MeshBlocks
+  int nderef_check;          // # of successive checks MB flagged before it is derefined
 
-  // following 2x Views are dimensioned [nmb_total]
+  // following 3x Views are dimensioned [nmb_total]
   DualArray1D<int> refine_flag;    // refinement flag for each MeshBlock
   HostArray1D<int> ncyc_since_ref; // # of cycles since MB last refined/derefined
+  HostArray1D<int> nderef_flagged; // # of successive checks MB flagged for derefinement
 
   // following 4x arrays allocated with length [nranks] only with AMR
   int *nref_eachrank;     // number of MBs refined per rank
@@ -94,6 +98,7 @@ class MeshRefinement {
 
   // functions
   void CheckForRefinement(MeshBlockPack* pmbp);
+  void AddRefinementBuffer(MeshBlockPack* pmbp);
   void AdaptiveMeshRefinement(Driver *pdrive, ParameterInput *pin);
   void UpdateMeshBlockTree(int &nnew, int &ndel);
   void RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, int ndel);
@@ -132,6 +137,7 @@ class MeshRefinement {
   // data
   Mesh *pmy_mesh;
   Real d_threshold_, dd_threshold_, dp_threshold_, dv_threshold_, chi_threshold_;
+  Real d_deref_threshold_, dd_deref_threshold_, dp_deref_threshold_;
   bool check_cons_;
 };
 #endif // MESH_MESH_REFINEMENT_HPP_
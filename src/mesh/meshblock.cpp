@@ -27,7 +27,8 @@ MeshBlock::MeshBlock(MeshBlockPack* ppack, int igids, int nmb) :
   mb_gid("mb_gid",nmb),
   mb_lev("mb_lev",nmb),
   mb_size("mbsize",nmb),
-  mb_bcs("mbbcs",nmb,6) {
+  mb_bcs("mbbcs",nmb,6),
+  mb_activity("mbactivity",nmb) {
   Mesh* pm = pmy_pack->pmesh;
   auto &ms = pm->mesh_size;
 
@@ -116,6 +117,9 @@ MeshBlock::MeshBlock(MeshBlockPack* ppack, int igids, int nmb) :
                             static_cast<Real>(pm->mb_indcs.nx2);
     mb_size.h_view(m).dx3 = (mb_size.h_view(m).x3max - mb_size.h_view(m).x3min)/
                             static_cast<Real>(pm->mb_indcs.nx3);
+
+    // all MeshBlocks are evolved until frozen by MeshActivity
+    mb_activity.h_view(m) = 1;
   }
 
   // For each DualArray: mark host views as modified, and then sync to device array
@@ -123,11 +127,13 @@ MeshBlock::MeshBlock(MeshBlockPack* ppack, int igids, int nmb) :
   mb_lev.template modify<HostMemSpace>();
   mb_size.template modify<HostMemSpace>();
   mb_bcs.template modify<HostMemSpace>();
+  mb_activity.template modify<HostMemSpace>();
 
   mb_gid.template sync<DevExeSpace>();
   mb_lev.template sync<DevExeSpace>();
   mb_size.template sync<DevExeSpace>();
   mb_bcs.template sync<DevExeSpace>();
+  mb_activity.template sync<DevExeSpace>();
 }
 
 //----------------------------------------------------------------------------------------
@@ -426,5 +432,28 @@ void MeshBlock::SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklis
   nghbr.template modify<HostMemSpace>();
   nghbr.template sync<DevExeSpace>();
 
+  // Build list of MeshBlocks that need restricted (coarse) data.  With SMR only MBs with
+  // a coarser neighbor ever use their coarse arrays (to send restricted data, and to
+  // prolongate data received from that neighbor).  With AMR, coarse data of every MB may
+  // be needed when it is derefined, so all MBs are included.  This list is not used for
+  // Z4c, which also sends coarse data to neighbors at the same level (see RestrictCC()).
+  // All MBs are also included with <mesh_refinement>/restrict_all=true.
+  nmb_restrict = 0;
+  Kokkos::realloc(mb_restrict, nmb);
+  for (int m=0; m<nmb; ++m) {
+    bool need_coarse = (pmy_pack->pmesh->adaptive || pmy_pack->pmesh->restrict_all);
+    for (int n=0; n<nnghbr; ++n) {
+      if ((nghbr.h_view(m,n).gid >= 0) && (nghbr.h_view(m,n).lev < mb_lev.h_view(m))) {
+        need_coarse = true;
+      }
+    }
+    if (need_coarse) {
+      mb_restrict.h_view(nmb_restrict) = m;
+      nmb_restrict++;
+    }
+  }
+  mb_restrict.template modify<HostMemSpace>();
+  mb_restrict.template sync<DevExeSpace>();
+
   return;
 }
@@ -41,6 +41,14 @@ class MeshBlock {
   DualArray1D<RegionSize> mb_size;   // physical size of each MeshBlock
   DualArray2D<BoundaryFlag> mb_bcs;  // boundary conditions at 6 faces of each MeshBlock
   DualArray2D<NeighborBlock> nghbr;  // data on all (up to 56) neighbors for each MB
+  // Activity of each MeshBlock, set by MeshActivity with <mesh_activity>: 1 if evolved,
+  // 0 if frozen but fluxes are still computed (it has active neighbors), -1 if frozen
+  DualArray1D<int> mb_activity;
+
+  // With SMR/AMR, indices of MeshBlocks whose coarse arrays must be restricted each
+  // stage.  Set by SetNeighbors(), dimensioned [nmb_restrict]
+  int nmb_restrict;
+  DualArray1D<int> mb_restrict;
 
   // function to set data describing neighbors
   void SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist);
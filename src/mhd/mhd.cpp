@@ -56,7 +56,10 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     fofc("fofc",1,1,1,1),
     eta1("eta1",1,1,1,1),
     eta2("eta2",1,1,1,1),
-    eta3("eta3",1,1,1,1) {
+    eta3("eta3",1,1,1,1),
+    wh("primh",1,1,1,1,1),
+    bcch("B_cch",1,1,1,1,1),
+    bh("B_fch",1,1,1,1) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -140,14 +143,14 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     int ncells1 = indcs.nx1 + 2*(indcs.ng);
     int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
     int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(u0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
-    Kokkos::realloc(w0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+    realloc_first_touch(u0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+    realloc_first_touch(w0,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
 
     // allocate memory for face-centered and cell-centered magnetic fields
-    Kokkos::realloc(bcc0,   nmb, 3, ncells3, ncells2, ncells1);
-    Kokkos::realloc(b0.x1f, nmb, ncells3, ncells2, ncells1+1);
-    Kokkos::realloc(b0.x2f, nmb, ncells3, ncells2+1, ncells1);
-    Kokkos::realloc(b0.x3f, nmb, ncells3+1, ncells2, ncells1);
+    realloc_first_touch(bcc0,   nmb, 3, ncells3, ncells2, ncells1);
+    realloc_first_touch(b0.x1f, nmb, ncells3, ncells2, ncells1+1);
+    realloc_first_touch(b0.x2f, nmb, ncells3, ncells2+1, ncells1);
+    realloc_first_touch(b0.x3f, nmb, ncells3+1, ncells2, ncells1);
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -156,11 +159,11 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells1 = indcs.cnx1 + 2*(indcs.ng);
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(coarse_u0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_b0.x1f, nmb, n_ccells3, n_ccells2, n_ccells1+1);
-    Kokkos::realloc(coarse_b0.x2f, nmb, n_ccells3, n_ccells2+1, n_ccells1);
-    Kokkos::realloc(coarse_b0.x3f, nmb, n_ccells3+1, n_ccells2, n_ccells1);
+    realloc_first_touch(coarse_u0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    realloc_first_touch(coarse_w0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    realloc_first_touch(coarse_b0.x1f, nmb, n_ccells3, n_ccells2, n_ccells1+1);
+    realloc_first_touch(coarse_b0.x2f, nmb, n_ccells3, n_ccells2+1, n_ccells1);
+    realloc_first_touch(coarse_b0.x3f, nmb, n_ccells3+1, n_ccells2, n_ccells1);
   }
 
   // allocate boundary buffers for conserved (cell-centered) and face-centered variables
@@ -190,6 +193,18 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     // determine if h-correction is enabled (Sanders, Morano & Druguet 1998)
     use_hcorr = pin->GetOrAddBoolean("mhd","h_correction",false);
 
+    // single-stage VL2 integrator uses half-step predictor for L/R states
+    if (pin->GetOrAddString("time","integrator","rk2").compare("vl2") == 0) {
+      if (pmy_pack->pcoord->is_special_relativistic ||
+          pmy_pack->pcoord->is_general_relativistic) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time>/integrator = vl2 cannot be used with SR/GR"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      use_hancock = true;
+    }
+
     // select reconstruction method (default PLM)
     std::string xorder = pin->GetOrAddString("mhd","reconstruct","plm");
     if (xorder.compare("dc") == 0) {
@@ -326,44 +341,53 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       int ncells1 = indcs.nx1 + 2*(indcs.ng);
       int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
       int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
-      Kokkos::realloc(u1,     nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
-      Kokkos::realloc(b1.x1f, nmb, ncells3, ncells2, ncells1+1);
-      Kokkos::realloc(b1.x2f, nmb, ncells3, ncells2+1, ncells1);
-      Kokkos::realloc(b1.x3f, nmb, ncells3+1, ncells2, ncells1);
+      realloc_first_touch(u1,     nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+      realloc_first_touch(b1.x1f, nmb, ncells3, ncells2, ncells1+1);
+      realloc_first_touch(b1.x2f, nmb, ncells3, ncells2+1, ncells1);
+      realloc_first_touch(b1.x3f, nmb, ncells3+1, ncells2, ncells1);
 
       // allocate fluxes, electric fields
-      Kokkos::realloc(uflx.x1f, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1+1);
-      Kokkos::realloc(uflx.x2f, nmb, (nmhd+nscalars), ncells3, ncells2+1, ncells1);
-      Kokkos::realloc(uflx.x3f, nmb, (nmhd+nscalars), ncells3+1, ncells2, ncells1);
-      Kokkos::realloc(efld.x1e, nmb, ncells3+1, ncells2+1, ncells1);
-      Kokkos::realloc(efld.x2e, nmb, ncells3+1, ncells2, ncells1+1);
-      Kokkos::realloc(efld.x3e, nmb, ncells3, ncells2+1, ncells1+1);
+      realloc_first_touch(uflx.x1f, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1+1);
+      realloc_first_touch(uflx.x2f, nmb, (nmhd+nscalars), ncells3, ncells2+1, ncells1);
+      realloc_first_touch(uflx.x3f, nmb, (nmhd+nscalars), ncells3+1, ncells2, ncells1);
+      realloc_first_touch(efld.x1e, nmb, ncells3+1, ncells2+1, ncells1);
+      realloc_first_touch(efld.x2e, nmb, ncells3+1, ncells2, ncells1+1);
+      realloc_first_touch(efld.x3e, nmb, ncells3, ncells2+1, ncells1+1);
 
       // allocate scratch arrays for face- and cell-centered E used in CornerE
-      Kokkos::realloc(e3x1, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2x1, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1x2, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e3x2, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2x3, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1x3, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e3x1, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e2x1, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e1x2, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e3x2, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e2x3, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e1x3, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e1_cc, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e2_cc, nmb, ncells3, ncells2, ncells1);
+      realloc_first_touch(e3_cc, nmb, ncells3, ncells2, ncells1);
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
         int nvars = (pmy_pack->pcoord->is_dynamical_relativistic) ? nmhd+nscalars : nmhd;
-        Kokkos::realloc(fofc,    nmb, ncells3, ncells2, ncells1);
-        Kokkos::realloc(utest,   nmb, nvars, ncells3, ncells2, ncells1);
-        Kokkos::realloc(bcctest, nmb, 3,    ncells3, ncells2, ncells1);
+        realloc_first_touch(fofc,    nmb, ncells3, ncells2, ncells1);
+        realloc_first_touch(utest,   nmb, nvars, ncells3, ncells2, ncells1);
+        realloc_first_touch(bcctest, nmb, 3,    ncells3, ncells2, ncells1);
         Kokkos::deep_copy(fofc, false);
       }
 
       // allocate cell-centered max eigenvalue arrays for h-correction
       if (use_hcorr) {
-        Kokkos::realloc(eta1, nmb, ncells3, ncells2, ncells1);
-        Kokkos::realloc(eta2, nmb, ncells3, ncells2, ncells1);
-        Kokkos::realloc(eta3, nmb, ncells3, ncells2, ncells1);
+        realloc_first_touch(eta1, nmb, ncells3, ncells2, ncells1);
+        realloc_first_touch(eta2, nmb, ncells3, ncells2, ncells1);
+        realloc_first_touch(eta3, nmb, ncells3, ncells2, ncells1);
+      }
+
+      // allocate half-step variables used with VL2 (MUSCL-Hancock) integrator
+      if (use_hancock) {
+        realloc_first_touch(wh,     nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+        realloc_first_touch(bcch,   nmb, 3, ncells3, ncells2, ncells1);
+        realloc_first_touch(bh.x1f, nmb, ncells3, ncells2, ncells1+1);
+        realloc_first_touch(bh.x2f, nmb, ncells3, ncells2+1, ncells1);
+        realloc_first_touch(bh.x3f, nmb, ncells3+1, ncells2, ncells1);
       }
     }
   }
@@ -394,8 +418,8 @@ void MHD::SetSaveWBcc() {
   int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
 
   // allocated saved arrays for time derivatives
-  Kokkos::realloc(wsaved,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
-  Kokkos::realloc(bccsaved, nmb, 3,               ncells3, ncells2, ncells1);
+  realloc_first_touch(wsaved,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+  realloc_first_touch(bccsaved, nmb, 3,               ncells3, ncells2, ncells1);
 
   wbcc_saved = true;
 }
@@ -149,6 +149,12 @@ class MHD {
   DvceArray4D<Real> eta1, eta2, eta3;  // max |eigenvalue| in x1, x2, x3 per cell
   bool use_hcorr = false;              // flag to enable h-correction
 
+  // following used for the half-step predictor of the VL2 (MUSCL-Hancock) integrator
+  bool use_hancock = false;  // flag to enable predictor
+  DvceArray5D<Real> wh;      // primitive variables at half time step
+  DvceArray5D<Real> bcch;    // cell-centered magnetic fields at half time step
+  DvceFaceFld4D<Real> bh;    // face-centered magnetic fields at half time step
+
   // container to hold names of TaskIDs
   MHDTaskIDs id;
 
@@ -200,6 +206,9 @@ class MHD {
   // first-order flux correction
   void FOFC(Driver *d, int stage);
 
+  // half-step predictor for VL2 integrator
+  void HancockPredictor();
+
   DvceArray5D<Real> utest, bcctest;  // scratch arrays for FOFC
 
  private:
@@ -30,6 +30,11 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
   int ks = indcs.ks, ke = indcs.ke;
+  // with deep-halo integration, extend computation into ghost zones in early stages
+  int nh = pdriver->HaloWidth(stage, ReconstructionStencil(recon_method));
+  is -= nh; ie += nh;
+  if (pmy_pack->pmesh->multi_d) {js -= nh; je += nh;}
+  if (pmy_pack->pmesh->three_d) {ks -= nh; ke += nh;}
   int nmb1 = pmy_pack->nmb_thispack - 1;
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
@@ -46,7 +51,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     auto e3 = efld.x3e;
     auto e2x1_ = e2x1;
     auto e3x1_ = e3x1;
-    par_for("emf1", DevExeSpace(), 0, nmb1, is, ie+1,
+    par_for("emf1", TaskExeSpace(), 0, nmb1, is, ie+1,
     KOKKOS_LAMBDA(int m, int i) {
       e2(m,ks  ,js  ,i) = e2x1_(m,ks,js,i);
       e2(m,ke+1,js  ,i) = e2x1_(m,ks,js,i);
@@ -60,14 +65,14 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
 
   if (pmy_pack->pmesh->two_d) {
     // Compute cell-centered E3 = -(v X B) = VyBx-VxBy
-    auto w0_ = w0;
-    auto bcc_ = bcc0;
+    auto w0_ = (use_hancock)? wh : w0;
+    auto bcc_ = (use_hancock)? bcch : bcc0;
     auto e3cc_ = e3_cc;
 
     // compute cell-centered EMF in dynamical GRMHD
     if (pmy_pack->padm != nullptr) {
       auto &adm = pmy_pack->padm->adm;
-      par_for("e_cc_2d", DevExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_2d", TaskExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int j, int i) {
         // Calculate the spatial components of the three-velocity
         const Real &ux = w0_(m,IVX,ks,j,i);
@@ -87,16 +92,16 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
       });
     } else if (pmy_pack->pcoord->is_general_relativistic) {
       // compute cell-centered EMF in GR MHD
-      par_for("e_cc_2d", DevExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_2d", TaskExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int j, int i) {
         // Extract components of metric
         Real &x1min = size.d_view(m).x1min;
         Real &x1max = size.d_view(m).x1max;
-        Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+        Real x1v = CellCenterX(i-indcs.is, indcs.nx1, x1min, x1max);
 
         Real &x2min = size.d_view(m).x2min;
         Real &x2max = size.d_view(m).x2max;
-        Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+        Real x2v = CellCenterX(j-indcs.js, indcs.nx2, x2min, x2max);
 
         Real &x3min = size.d_view(m).x3min;
         Real &x3max = size.d_view(m).x3max;
@@ -136,7 +141,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
 
     // compute cell-centered EMF in SR MHD
     } else if (pmy_pack->pcoord->is_special_relativistic) {
-      par_for("e_cc_2d", DevExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_2d", TaskExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int j, int i) {
         const Real &u1 = w0_(m,IVX,ks,j,i);
         const Real &u2 = w0_(m,IVY,ks,j,i);
@@ -147,7 +152,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
 
     // compute cell-centered EMF in Newtonian MHD
     } else {
-      par_for("e_cc_2d", DevExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_2d", TaskExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int j, int i) {
         e3cc_(m,ks,j,i) = w0_(m,IVY,ks,j,i)*bcc_(m,IBX,ks,j,i) -
                           w0_(m,IVX,ks,j,i)*bcc_(m,IBY,ks,j,i);
@@ -169,7 +174,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     //  Note e1[is:ie,  js:je+1,ks:ke+1]
     //       e2[is:ie+1,js:je,  ks:ke+1]
     //       e3[is:ie+1,js:je+1,ks:ke  ]
-    par_for("emf2", DevExeSpace(), 0, nmb1, js, je+1, is, ie+1,
+    par_for("emf2", TaskExeSpace(), 0, nmb1, js, je+1, is, ie+1,
     KOKKOS_LAMBDA(const int m, const int j, const int i) {
       e2(m,ks  ,j,i) = e2x1_(m,ks,j,i);
       e2(m,ke+1,j,i) = e2x1_(m,ks,j,i);
@@ -210,8 +215,8 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     // E1=-(v X B)=VzBy-VyBz
     // E2=-(v X B)=VxBz-VzBx
     // E3=-(v X B)=VyBx-VxBy
-    auto w0_ = w0;
-    auto bcc_ = bcc0;
+    auto w0_ = (use_hancock)? wh : w0;
+    auto bcc_ = (use_hancock)? bcch : bcc0;
     auto e1cc_ = e1_cc;
     auto e2cc_ = e2_cc;
     auto e3cc_ = e3_cc;
@@ -219,7 +224,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     // compute cell-centered EMFs in dynamical GRMHD
     if (pmy_pack->padm != nullptr) {
       auto &adm = pmy_pack->padm->adm;
-      par_for("e_cc_3d", DevExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_3d", TaskExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         // Calculate something that resembles the spatial components of the four-velocity
         // normalized by W.
@@ -244,20 +249,20 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
       });
     } else if (pmy_pack->pcoord->is_general_relativistic) {
       // compute cell-centered EMFs in GR MHD
-      par_for("e_cc_3d", DevExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_3d", TaskExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         // Extract components of metric
         Real &x1min = size.d_view(m).x1min;
         Real &x1max = size.d_view(m).x1max;
-        Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+        Real x1v = CellCenterX(i-indcs.is, indcs.nx1, x1min, x1max);
 
         Real &x2min = size.d_view(m).x2min;
         Real &x2max = size.d_view(m).x2max;
-        Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+        Real x2v = CellCenterX(j-indcs.js, indcs.nx2, x2min, x2max);
 
         Real &x3min = size.d_view(m).x3min;
         Real &x3max = size.d_view(m).x3max;
-        Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+        Real x3v = CellCenterX(k-indcs.ks, indcs.nx3, x3min, x3max);
 
         Real glower[4][4], gupper[4][4];
         ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
@@ -295,7 +300,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
 
     // compute cell-centered EMFs in SR MHD
     } else if (pmy_pack->pcoord->is_special_relativistic) {
-      par_for("e_cc_3d", DevExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_3d", TaskExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         const Real &u1 = w0_(m,IVX,k,j,i);
         const Real &u2 = w0_(m,IVY,k,j,i);
@@ -308,7 +313,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
 
     // compute cell-centered EMFs in Newtonian MHD
     } else {
-      par_for("e_cc_3d", DevExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
+      par_for("e_cc_3d", TaskExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         e1cc_(m,k,j,i) = w0_(m,IVZ,k,j,i)*bcc_(m,IBY,k,j,i) -
                          w0_(m,IVY,k,j,i)*bcc_(m,IBZ,k,j,i);
@@ -337,7 +342,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     //  Note e1[is:ie,  js:je+1,ks:ke+1]
     //       e2[is:ie+1,js:je,  ks:ke+1]
     //       e3[is:ie+1,js:je+1,ks:ke  ]
-    par_for("emf3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je+1, is, ie+1,
+    par_for("emf3", TaskExeSpace(), 0, nmb1, ks, ke+1, js, je+1, is, ie+1,
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       // integrate E1 to corner using SG07
       Real e1_l3, e1_r3, e1_l2, e1_r2;
@@ -25,6 +25,11 @@ TaskStatus MHD::CT(Driver *pdriver, int stage) {
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
   int ks = indcs.ks, ke = indcs.ke;
+  // with deep-halo integration, extend update into ghost zones in early stages
+  int nh = pdriver->HaloWidth(stage, ReconstructionStencil(recon_method));
+  is -= nh; ie += nh;
+  if (pmy_pack->pmesh->multi_d) {js -= nh; je += nh;}
+  if (pmy_pack->pmesh->three_d) {ks -= nh; ke += nh;}
   int nmb1 = pmy_pack->nmb_thispack - 1;
 
   // capture class variables for the kernels
@@ -37,13 +42,15 @@ TaskStatus MHD::CT(Driver *pdriver, int stage) {
   auto e2 = efld.x2e;
   auto e3 = efld.x3e;
   auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &activity = pmy_pack->pmb->mb_activity;
 
   //---- update B1 (only for 2D/3D problems)
   if (multi_d) {
     auto bx1f = b0.x1f;
     auto bx1f_old = b1.x1f;
-    par_for("CT-b1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
+    par_for("CT-b1", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      if (activity.d_view(m) < 1) return;
       bx1f(m,k,j,i) = gam0*bx1f(m,k,j,i) + gam1*bx1f_old(m,k,j,i);
       bx1f(m,k,j,i) -= beta_dt*(e3(m,k,j+1,i) - e3(m,k,j,i))/mbsize.d_view(m).dx2;
       if (three_d) {
@@ -55,8 +62,9 @@ TaskStatus MHD::CT(Driver *pdriver, int stage) {
   //---- update B2 (curl terms in 1D and 3D problems)
   auto bx2f = b0.x2f;
   auto bx2f_old = b1.x2f;
-  par_for("CT-b2", DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
+  par_for("CT-b2", TaskExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    if (activity.d_view(m) < 1) return;
     bx2f(m,k,j,i) = gam0*bx2f(m,k,j,i) + gam1*bx2f_old(m,k,j,i);
     bx2f(m,k,j,i) += beta_dt*(e3(m,k,j,i+1) - e3(m,k,j,i))/mbsize.d_view(m).dx1;
     if (three_d) {
@@ -67,8 +75,9 @@ TaskStatus MHD::CT(Driver *pdriver, int stage) {
   //---- update B3 (curl terms in 1D and 2D/3D problems)
   auto bx3f = b0.x3f;
   auto bx3f_old = b1.x3f;
-  par_for("CT-b3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
+  par_for("CT-b3", TaskExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    if (activity.d_view(m) < 1) return;
     bx3f(m,k,j,i) = gam0*bx3f(m,k,j,i) + gam1*bx3f_old(m,k,j,i);
     bx3f(m,k,j,i) -= beta_dt*(e2(m,k,j,i+1) - e2(m,k,j,i))/mbsize.d_view(m).dx1;
     if (multi_d) {
@@ -13,6 +13,7 @@
 
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
 #include "mhd.hpp"
 #include "eos/eos.hpp"
 #include "reconstruct/dc.hpp"
@@ -42,6 +43,11 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   int is = indcs_.is, ie = indcs_.ie;
   int js = indcs_.js, je = indcs_.je;
   int ks = indcs_.ks, ke = indcs_.ke;
+  // with deep-halo integration, extend computation into ghost zones in early stages
+  int nh = pdriver->HaloWidth(stage, ReconstructionStencil(recon_method));
+  is -= nh; ie += nh;
+  if (pmy_pack->pmesh->multi_d) {js -= nh; je += nh;}
+  if (pmy_pack->pmesh->three_d) {ks -= nh; ke += nh;}
   int ncells1 = indcs_.nx1 + 2*(indcs_.ng);
 
   int &nmhd_ = nmhd;
@@ -55,9 +61,15 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
 
   auto &eos_ = peos->eos_data;
   auto &size_ = pmy_pack->pmb->mb_size;
+  auto &activity = pmy_pack->pmb->mb_activity;
   auto &coord_ = pmy_pack->pcoord->coord_data;
   auto &w0_ = w0;
   auto &b0_ = bcc0;
+  // VL2 integrator adds the half-step predictor increments (wh - w0) and (bcch - bcc0) to
+  // the L/R states, and uses half-step face fields as the normal field in the RS
+  bool use_hancock_ = use_hancock;
+  auto &wh_ = wh;
+  auto &bcch_ = bcch;
   auto &eta1_ = eta1;
   auto &eta2_ = eta2;
   auto &eta3_ = eta3;
@@ -74,7 +86,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
       int ku_hc = (pmy_pack->pmesh->one_d || pmy_pack->pmesh->two_d) ? ke : ke+1;
       int jl_hc = pmy_pack->pmesh->one_d ? js : js-1;
       int ju_hc = pmy_pack->pmesh->one_d ? je : je+1;
-      par_for("hcorr_eta", DevExeSpace(), 0, nmb1, kl_hc, ku_hc, jl_hc, ju_hc, is-1, ie+1,
+      par_for("hcorr_eta", TaskExeSpace(), 0, nmb1, kl_hc, ku_hc, jl_hc, ju_hc, is-1,ie+1,
       KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
         Real d  = w0_(m,IDN,k,j,i);
         Real vx = w0_(m,IVX,k,j,i);
@@ -110,7 +122,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   auto &flx1_ = uflx.x1f;
   auto &e31_ = e3x1;
   auto &e21_ = e2x1;
-  auto &bx_ = b0.x1f;
+  auto &bx_ = (use_hancock)? bh.x1f : b0.x1f;
 
   // set the loop limits for 1D/2D/3D problems
   int jl,ju,kl,ku;
@@ -124,8 +136,9 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
   int il = is, iu = ie+1;
   if (use_fofc) { il = is-1, iu = ie+2; }
 
-  par_for_outer("mhd_flux1",DevExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
+  par_for_outer("mhd_flux1",TaskExeSpace(), scr_size, scr_level, 0, nmb1, kl, ku, jl, ju,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    if (activity.d_view(m) < 0) return;
     ScrArray2D<Real> wl(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> wr(member.team_scratch(scr_level), nvars, ncells1);
     ScrArray2D<Real> bl(member.team_scratch(scr_level), 3, ncells1);
@@ -153,6 +166,23 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
       default:
         break;
     }
+    if (use_hancock_) {
+      member.team_barrier();
+      for (int n=0; n<nvars; ++n) {
+        par_for_inner(member, il-1, iu, [&](const int i) {
+          Real dw = wh_(m,n,k,j,i) - w0_(m,n,k,j,i);
+          wl(n,i+1) += dw;
+          wr(n,i) += dw;
+        });
+      }
+      for (int n=0; n<3; ++n) {
+        par_for_inner(member, il-1, iu, [&](const int i) {
+          Real db = bcch_(m,n,k,j,i) - b0_(m,n,k,j,i);
+          bl(n,i+1) += db;
+          br(n,i) += db;
+        });
+      }
+    }
     // Sync all threads in the team so that scratch memory is consistent
     member.team_barrier();
 
@@ -213,7 +243,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
                 ScrArray2D<Real>::shmem_size(3, ncells1)) * 3;
     auto &flx2_ = uflx.x2f;
-    auto &by_ = b0.x2f;
+    auto &by_ = (use_hancock)? bh.x2f : b0.x2f;
     auto &e12_ = e1x2;
     auto &e32_ = e3x2;
 
@@ -226,8 +256,9 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     jl = js-1, ju = je+1;
     if (use_fofc) { jl = js-2, ju = je+2; }
 
-    par_for_outer("mhd_flux2",DevExeSpace(),scr_size,scr_level,0,nmb1, kl, ku,
+    par_for_outer("mhd_flux2",TaskExeSpace(),scr_size,scr_level,0,nmb1, kl, ku,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
+      if (activity.d_view(m) < 0) return;
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
@@ -272,6 +303,23 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           default:
             break;
         }
+        if (use_hancock_) {
+          member.team_barrier();
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              Real dw = wh_(m,n,k,j,i) - w0_(m,n,k,j,i);
+              wl_jp1(n,i) += dw;
+              wr(n,i) += dw;
+            });
+          }
+          for (int n=0; n<3; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              Real db = bcch_(m,n,k,j,i) - b0_(m,n,k,j,i);
+              bl_jp1(n,i) += db;
+              br(n,i) += db;
+            });
+          }
+        }
         member.team_barrier();
 
         // compute fluxes over [js,je+1].  MHD RS also computes electric fields, where
@@ -343,7 +391,7 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     scr_size = (ScrArray2D<Real>::shmem_size(nvars, ncells1) +
                 ScrArray2D<Real>::shmem_size(3, ncells1)) * 3;
     auto &flx3_ = uflx.x3f;
-    auto &bz_ = b0.x3f;
+    auto &bz_ = (use_hancock)? bh.x3f : b0.x3f;
     auto &e23_ = e2x3;
     auto &e13_ = e1x3;
 
@@ -351,8 +399,9 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
     kl = ks-1, ku = ke+1;
     if (use_fofc) { kl = ks-2, ku = ke+2; }
 
-    par_for_outer("mhd_flux3",DevExeSpace(), scr_size, scr_level, 0, nmb1, js-1, je+1,
+    par_for_outer("mhd_flux3",TaskExeSpace(), scr_size, scr_level, 0, nmb1, js-1, je+1,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
+      if (activity.d_view(m) < 0) return;
       ScrArray2D<Real> scr1(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr2(member.team_scratch(scr_level), nvars, ncells1);
       ScrArray2D<Real> scr3(member.team_scratch(scr_level), nvars, ncells1);
@@ -397,6 +446,23 @@ void MHD::CalculateFluxes(Driver *pdriver, int stage) {
           default:
             break;
         }
+        if (use_hancock_) {
+          member.team_barrier();
+          for (int n=0; n<nvars; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              Real dw = wh_(m,n,k,j,i) - w0_(m,n,k,j,i);
+              wl_kp1(n,i) += dw;
+              wr(n,i) += dw;
+            });
+          }
+          for (int n=0; n<3; ++n) {
+            par_for_inner(member, is-1, ie+1, [&](const int i) {
+              Real db = bcch_(m,n,k,j,i) - b0_(m,n,k,j,i);
+              bl_kp1(n,i) += db;
+              br(n,i) += db;
+            });
+          }
+        }
         member.team_barrier();
 
         // compute fluxes over [ks,ke+1].  MHD RS also computes electric fields, where
@@ -68,7 +68,7 @@ void MHD::FOFC(Driver *pdriver, int stage) {
     if (three_d) { kl = ks-1, ku = ke+1; }
 
     // Estimate updated conserved variables and cell-centered fields
-    par_for("FOFC-newu", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+    par_for("FOFC-newu", TaskExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       Real dtodx1 = beta_dt/size.d_view(m).dx1;
       Real dtodx2 = beta_dt/size.d_view(m).dx2;
@@ -120,6 +120,7 @@ void MHD::FOFC(Driver *pdriver, int stage) {
   auto fofc_ = fofc;
   auto &use_excise_ = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
+  auto &excision_mb_ = pmy_pack->pcoord->excision_mb;
   auto &w0_ = w0;
   auto &b0_ = b0;
 
@@ -130,7 +131,7 @@ void MHD::FOFC(Driver *pdriver, int stage) {
 
   // Replace fluxes with first-order LLF fluxes at i,j,k faces for any cell where FOFC
   // and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  par_for("FOFC-flx", TaskExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
@@ -139,7 +140,7 @@ void MHD::FOFC(Driver *pdriver, int stage) {
     // Check for GR + excision
     bool fofc_excision = false;
     if (is_gr) {
-      if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
+      if (use_excise_ && excision_mb_(m)) { fofc_excision = excision_flux_(m,k,j,i); }
     }
 
     // Apply FOFC
@@ -307,7 +308,7 @@ void MHD::FOFC(Driver *pdriver, int stage) {
 
   // Replace fluxes with first-order LLF fluxes at i+1,j+1,k+1 faces for any cell where
   // FOFC and/or excision is used (if GR+excising)
-  par_for("FOFC-flx", DevExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
+  par_for("FOFC-flx", TaskExeSpace(), 0, nmb-1, kl, ku, jl, ju, il, iu,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Check for FOFC flag
     bool fofc_flag = false;
@@ -316,7 +317,7 @@ void MHD::FOFC(Driver *pdriver, int stage) {
     // Check for GR + excision
     bool fofc_excision = false;
     if (is_gr) {
-      if (use_excise_) { fofc_excision = excision_flux_(m,k,j,i); }
+      if (use_excise_ && excision_mb_(m)) { fofc_excision = excision_flux_(m,k,j,i); }
     }
 
     // Apply FOFC
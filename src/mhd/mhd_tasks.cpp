@@ -91,8 +91,8 @@ void MHD::AssembleMHDTasks(std::map<std::string, std::shared_ptr<TaskList>> tl)
 
 TaskStatus MHD::SaveMHDState(Driver *pdrive, int stage) {
   if (wbcc_saved) {
-    Kokkos::deep_copy(DevExeSpace(), wsaved, w0);
-    Kokkos::deep_copy(DevExeSpace(), bccsaved, bcc0);
+    Kokkos::deep_copy(TaskExeSpace(), wsaved, w0);
+    Kokkos::deep_copy(TaskExeSpace(), bccsaved, bcc0);
   }
   return TaskStatus::complete;
 }
@@ -105,6 +105,9 @@ TaskStatus MHD::SaveMHDState(Driver *pdrive, int stage) {
 //! face-centered fields AND their fluxes (with SMR/AMR).
 
 TaskStatus MHD::InitRecv(Driver *pdrive, int stage) {
+  // with deep-halo integration, ghost zones are not exchanged in early stages
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
+
   // post receives for U
   TaskStatus tstat = pbval_u->InitRecv(nmhd+nscalars);
   if (tstat != TaskStatus::complete) return tstat;
@@ -159,10 +162,10 @@ TaskStatus MHD::InitRecv(Driver *pdrive, int stage) {
 
 TaskStatus MHD::CopyCons(Driver *pdrive, int stage) {
   if (stage == 1) {
-    Kokkos::deep_copy(DevExeSpace(), u1, u0);
-    Kokkos::deep_copy(DevExeSpace(), b1.x1f, b0.x1f);
-    Kokkos::deep_copy(DevExeSpace(), b1.x2f, b0.x2f);
-    Kokkos::deep_copy(DevExeSpace(), b1.x3f, b0.x3f);
+    Kokkos::deep_copy(TaskExeSpace(), u1, u0);
+    Kokkos::deep_copy(TaskExeSpace(), b1.x1f, b0.x1f);
+    Kokkos::deep_copy(TaskExeSpace(), b1.x2f, b0.x2f);
+    Kokkos::deep_copy(TaskExeSpace(), b1.x3f, b0.x3f);
   }
   return TaskStatus::complete;
 }
@@ -173,6 +176,9 @@ TaskStatus MHD::CopyCons(Driver *pdrive, int stage) {
 //! of conserved variables
 
 TaskStatus MHD::Fluxes(Driver *pdrive, int stage) {
+  // half-step predictor of VL2 integrator
+  if (use_hancock) {HancockPredictor();}
+
   // select which calculate_flux function to call based on rsolver_method
   if (rsolver_method == MHD_RSolver::advect) {
     CalculateFluxes<MHD_RSolver::advect>(pdrive, stage);
@@ -255,12 +261,15 @@ TaskStatus MHD::RecvFlux(Driver *pdrive, int stage) {
 TaskStatus MHD::MHDSrcTerms(Driver *pdrive, int stage) {
   Real beta_dt = (pdrive->beta[stage-1])*(pmy_pack->pmesh->dt);
 
-  // Add source terms for various physics
-  if (psrc->const_accel)  psrc->ConstantAccel(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->ism_cooling)  psrc->ISMCooling(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->rel_cooling)  psrc->RelCooling(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->sn_driving)   psrc->SupernovaDriving(w0, peos->eos_data, beta_dt, u0);
-  if (psrc->shearing_box) psrc->ShearingBox(w0, bcc0, peos->eos_data, beta_dt, u0);
+  // Add source terms for various physics, using primitives and fields at the half time
+  // step with the VL2 integrator
+  auto &w = (use_hancock)? wh : w0;
+  auto &bcc = (use_hancock)? bcch : bcc0;
+  if (psrc->const_accel)  psrc->ConstantAccel(w, peos->eos_data, beta_dt, u0);
+  if (psrc->ism_cooling)  psrc->ISMCooling(w, peos->eos_data, beta_dt, u0);
+  if (psrc->rel_cooling)  psrc->RelCooling(w, peos->eos_data, beta_dt, u0);
+  if (psrc->sn_driving)   psrc->SupernovaDriving(w, peos->eos_data, beta_dt, u0);
+  if (psrc->shearing_box) psrc->ShearingBox(w, bcc, peos->eos_data, beta_dt, u0);
 
   // Add coordinate source terms in GR.  Again, must be computed with only primitives.
   if (pmy_pack->pcoord->is_general_relativistic &&
@@ -275,6 +284,9 @@ TaskStatus MHD::MHDSrcTerms(Driver *pdrive, int stage) {
     (pmy_pack->pmesh->pgen->user_srcs_func)(pmy_pack->pmesh, beta_dt);
   }
 
+  // Remove source terms from frozen MeshBlocks
+  if (pmy_pack->pmesh->pmact != nullptr) {pmy_pack->pmesh->pmact->ResetFrozen(u0, u1);}
+
   return TaskStatus::complete;
 }
 
@@ -324,6 +336,7 @@ TaskStatus MHD::RestrictU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to pack/send cell-centered conserved variables
 
 TaskStatus MHD::SendU(Driver *pdrive, int stage) {
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = pbval_u->PackAndSendCC(u0, coarse_u0);
   return tstat;
 }
@@ -333,6 +346,7 @@ TaskStatus MHD::SendU(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to receive/unpack cell-centered conserved variables
 
 TaskStatus MHD::RecvU(Driver *pdrive, int stage) {
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
   return tstat;
 }
@@ -384,6 +398,9 @@ TaskStatus MHD::EFieldSrc(Driver *pdrive, int stage) {
 //! MeshBlocks), and at fine/coarse boundaries with SMR/AMR using restricted values of E.
 
 TaskStatus MHD::SendE(Driver *pdrive, int stage) {
+  // with deep-halo integration, E on shared edges is computed identically on each
+  // MeshBlock in early stages, so it need not be exchanged
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = TaskStatus::complete;
   tstat = pbval_b->PackAndSendFluxFC(efld);
   return tstat;
@@ -395,6 +412,7 @@ TaskStatus MHD::SendE(Driver *pdrive, int stage) {
 //! (i.e. edge-centered electric field E) at MeshBlock boundaries
 
 TaskStatus MHD::RecvE(Driver *pdrive, int stage) {
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = TaskStatus::complete;
   tstat = pbval_b->RecvAndUnpackFluxFC(efld);
   return tstat;
@@ -434,6 +452,7 @@ TaskStatus MHD::RecvB_OA(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to pack/send face-centered magnetic fields
 
 TaskStatus MHD::SendB(Driver *pdrive, int stage) {
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = pbval_b->PackAndSendFC(b0, coarse_b0);
   return tstat;
 }
@@ -443,6 +462,7 @@ TaskStatus MHD::SendB(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to recv/unpack face-centered magnetic fields
 
 TaskStatus MHD::RecvB(Driver *pdrive, int stage) {
+  if (!(pdrive->ExchangeGhosts(stage))) return TaskStatus::complete;
   TaskStatus tstat = pbval_b->RecvAndUnpackFC(b0, coarse_b0);
   return tstat;
 }
@@ -27,6 +27,7 @@
 #include "z4c/z4c.hpp"
 #include "srcterms/srcterms.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "radiation_m1/radiation_m1.hpp"
 #include "outputs.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -45,6 +46,7 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
   // exit for history, restart, or event log files
   if (out_params.file_type.compare("hst") == 0 ||
       out_params.file_type.compare("rst") == 0 ||
+      out_params.file_type.compare("brst") == 0 ||
       out_params.file_type.compare("log") == 0 ||
       out_params.file_type.compare("trk") == 0) {return;}
 
@@ -237,6 +239,14 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
        << std::endl << "Input file is likely missing corresponding block" << std::endl;
     exit(EXIT_FAILURE);
   }
+  if ((!power_spectrum_alias) && (ivar>=152) && (ivar<157) &&
+      (pm->pmb_pack->prm1 == nullptr)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+       << "Output of M1 radiation moments requested in <output> block '"
+       << out_params.block_name << "' but no RadiationM1 object has been constructed."
+       << std::endl << "Input file is likely missing a <radiation_m1> block" << std::endl;
+    exit(EXIT_FAILURE);
+  }
 
   // Now load STL vector of output variables
   outvars.clear();
@@ -663,6 +673,24 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
       outvars.emplace_back("force3",2,&(pm->pmb_pack->pturb->force));
     }
 
+    // M1 radiation energy density and flux
+    if (variable.compare("rad_m1_e") == 0 ||
+        variable.compare("rad_m1") == 0) {
+      outvars.emplace_back("r_e",IER,&(pm->pmb_pack->prm1->u0));
+    }
+    if (variable.compare("rad_m1_f1") == 0 ||
+        variable.compare("rad_m1") == 0) {
+      outvars.emplace_back("r_f1",IFX,&(pm->pmb_pack->prm1->u0));
+    }
+    if (variable.compare("rad_m1_f2") == 0 ||
+        variable.compare("rad_m1") == 0) {
+      outvars.emplace_back("r_f2",IFY,&(pm->pmb_pack->prm1->u0));
+    }
+    if (variable.compare("rad_m1_f3") == 0 ||
+        variable.compare("rad_m1") == 0) {
+      outvars.emplace_back("r_f3",IFZ,&(pm->pmb_pack->prm1->u0));
+    }
+
     // ADM variables, excluding gauge
     for (int v = 0; v < adm::ADM::nadm - 4; ++v) {
       if (variable.compare("adm") == 0 ||
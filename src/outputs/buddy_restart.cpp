@@ -0,0 +1,352 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file buddy_restart.cpp
+//! \brief writes in-memory (buddy) checkpoints, enabled with file_type=brst.
+//!
+//! At each checkpoint the restart data of every rank is packed into host memory in the
+//! same layout used by restart files, and a copy is sent to a buddy rank which by default
+//! is on another node.  Only every flush_interval checkpoints is the data written to a
+//! standard restart file in rst/, using non-blocking writes that complete while the
+//! following steps are computed.  Optionally, the checkpoint of each rank and the copy it
+//! holds for its partner are also written to a node-local directory (buddy_dir), from
+//! which the most recent complete checkpoint can be assembled into a restart file with
+//! vis/python/assemble_buddy_rst.py after a job fails.
+//!
+//! Each file in buddy_dir starts with 6 uint64 values (ncycle, rank, nranks,
+//! header_size, data_offset, data_size) followed by the restart file header (only for
+//! rank 0) and the data of that rank, which starts at data_offset in the restart file.
+
+#include <sys/stat.h>  // mkdir
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "coordinates/adm.hpp"
+#include "z4c/z4c.hpp"
+#include "radiation/radiation.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+#include "srcterms/turb_driver.hpp"
+#include "outputs.hpp"
+
+//----------------------------------------------------------------------------------------
+// ctor: also calls RestartOutput base class constructor
+
+BuddyRestartOutput::BuddyRestartOutput(ParameterInput *pin, Mesh *pm,
+                                       OutputParameters op) :
+  RestartOutput(pin, pm, op),
+  ncheckpoints(0),
+  own_offset(0),
+  buddy_data_offset(0),
+  flush_pending(false) {
+  flush_interval = pin->GetOrAddInteger(op.block_name, "flush_interval", 10);
+  if (flush_interval < 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "flush_interval in output block '" << op.block_name
+              << "' must be >= 0" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  buddy_dir = pin->GetOrAddString(op.block_name, "buddy_dir", "");
+  if (!(buddy_dir.empty())) {
+    mkdir(buddy_dir.c_str(), 0775);
+  }
+
+  // By default the buddy is the rank with the same local rank on the next node, assuming
+  // ranks are assigned to nodes in blocks of equal size.
+  int nranks = global_variable::nranks;
+  int node_size = 1;
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, global_variable::my_rank,
+                      MPI_INFO_NULL, &node_comm);
+  MPI_Comm_size(node_comm, &node_size);
+  MPI_Comm_free(&node_comm);
+  MPI_Allreduce(MPI_IN_PLACE, &node_size, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  buddy_offset = pin->GetOrAddInteger(op.block_name, "buddy_offset", node_size);
+  if (nranks > 1 && (buddy_offset % nranks) == 0) {
+    buddy_offset = nranks/2;
+    if (global_variable::my_rank == 0) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "All ranks of output block '" << op.block_name << "' are on one "
+                << "node, buddy checkpoints do not protect against node failures"
+                << std::endl;
+    }
+  }
+  buddy_offset = (nranks > 1)? (buddy_offset % nranks) : 0;
+}
+
+//----------------------------------------------------------------------------------------
+// destructor: writes the last checkpoint if it has not been flushed, and waits for the
+// flush to complete.  Must be called by all ranks before MPI_Finalize.
+
+BuddyRestartOutput::~BuddyRestartOutput() {
+  FinishFlush();
+  if (ncheckpoints > 0 && flush_interval > 0) {
+    char number[6];
+    std::snprintf(number, sizeof(number), "%05d", out_params.file_number);
+    std::string fname = "rst/" + out_params.file_basename + "." + number + ".rst";
+    flush_file.Open(fname.c_str(), IOWrapper::FileMode::write);
+    if (global_variable::my_rank == 0) {
+      flush_file.Write_bytes_at_nb(own_header.data(), own_header.size(), 0);
+    }
+    flush_file.Write_bytes_at_nb(own_data.data(), own_data.size(), own_offset);
+    flush_pending = true;
+    FinishFlush();
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BuddyRestartOutput::WriteOutputFile(Mesh *pm)
+//  \brief Stores restart data in memory, exchanges it with buddy rank, and every
+//  flush_interval checkpoints starts writing it to a restart file.
+
+void BuddyRestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
+  int my_rank = global_variable::my_rank;
+  ncheckpoints++;
+  bool flush = (flush_interval > 0 && ncheckpoints >= flush_interval);
+
+  // increment counters now so values for *next* dump are stored in checkpoint.  The file
+  // number is only incremented if this checkpoint is written to disk, but the checkpoint
+  // always stores the number following its own so it can be flushed later.
+  int this_file_number = out_params.file_number;
+  if (out_params.last_time < 0.0) {
+    out_params.last_time = pm->time;
+  } else {
+    out_params.last_time += out_params.dt;
+  }
+  pin->SetInteger(out_params.block_name, "file_number", this_file_number + 1);
+  pin->SetReal(out_params.block_name, "last_time", out_params.last_time);
+
+  // create string holding input parameters (copy of input file)
+  std::stringstream ost;
+  pin->ParameterDump(ost);
+  std::string sbuf = ost.str();
+  if (flush) {
+    out_params.file_number++;
+  } else {
+    pin->SetInteger(out_params.block_name, "file_number", this_file_number);
+  }
+
+  // pack header, including size of data for each MeshBlock.  Only kept on root.
+  IOWrapperSizeT data_size = RestartDataSize(pm);
+  PackRestartHeader(pm, sbuf, own_header);
+  const char *pdsize = reinterpret_cast<const char*>(&data_size);
+  own_header.insert(own_header.end(), pdsize, pdsize + sizeof(IOWrapperSizeT));
+  own_offset = own_header.size() + data_size*(pm->gids_eachrank[my_rank]);
+  if (my_rank != 0) {
+    own_header.clear();
+  }
+
+  // pack data of all MeshBlocks on this rank, in same order as in restart files
+  int nmb = pm->nmb_thisrank;
+  own_data.resize(nmb*data_size);
+  for (int m=0; m<nmb; ++m) {
+    char *pdata = own_data.data() + m*data_size;
+    auto pack = [&pdata](const Real *src, std::size_t cnt) {
+      std::memcpy(pdata, src, cnt*sizeof(Real));
+      pdata += cnt*sizeof(Real);
+    };
+    if (pm->pmb_pack->phydro != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_hyd, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      pack(mbptr.data(), mbptr.size());
+    }
+    if (pm->pmb_pack->pmhd != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_mhd, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      pack(mbptr.data(), mbptr.size());
+      auto x1fptr = Kokkos::subview(outfield.x1f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      pack(x1fptr.data(), x1fptr.size());
+      auto x2fptr = Kokkos::subview(outfield.x2f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      pack(x2fptr.data(), x2fptr.size());
+      auto x3fptr = Kokkos::subview(outfield.x3f,m,Kokkos::ALL,Kokkos::ALL,Kokkos::ALL);
+      pack(x3fptr.data(), x3fptr.size());
+    }
+    if (pm->pmb_pack->prad != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_rad, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      pack(mbptr.data(), mbptr.size());
+    }
+    if (pm->pmb_pack->prm1 != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_rm1, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      pack(mbptr.data(), mbptr.size());
+    }
+    if (pm->pmb_pack->pturb != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_force, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      pack(mbptr.data(), mbptr.size());
+    }
+    if (pm->pmb_pack->pz4c != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_z4c, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      pack(mbptr.data(), mbptr.size());
+      // spacetime levels and evolved gauge stored for multirate coupling
+      if (pm->pmb_pack->pz4c->mr_nsub > 1) {
+        auto mrptr = Kokkos::subview(outarray_z4cmr, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        pack(mrptr.data(), mrptr.size());
+      }
+    } else if (pm->pmb_pack->padm != nullptr) {
+      auto mbptr = Kokkos::subview(outarray_adm, m, Kokkos::ALL, Kokkos::ALL,
+                                   Kokkos::ALL, Kokkos::ALL);
+      pack(mbptr.data(), mbptr.size());
+    }
+  }
+
+  // keep copy of checkpoint on buddy rank, and optionally in node-local storage
+  ExchangeWithBuddy();
+  if (!(buddy_dir.empty())) {
+    int nranks = global_variable::nranks;
+    int buddy = (my_rank - buddy_offset + nranks) % nranks;
+    char number[6];
+    std::snprintf(number, sizeof(number), "%05d", my_rank);
+    WritePiece(buddy_dir + "/" + out_params.file_basename + "." + number + ".brst",
+               my_rank, pm->ncycle, own_header, own_data, own_offset, data_size);
+    if (buddy != my_rank) {
+      std::snprintf(number, sizeof(number), "%05d", buddy);
+      WritePiece(buddy_dir + "/" + out_params.file_basename + "." + number +
+                 ".copy.brst", buddy, pm->ncycle, buddy_header, buddy_data,
+                 buddy_data_offset, data_size);
+    }
+  }
+
+  // start writing checkpoint to disk.  Data is copied into separate buffers so that the
+  // writes can continue while further checkpoints are stored in memory.
+  if (flush) {
+    FinishFlush();
+    flush_header = own_header;
+    flush_data = own_data;
+
+    char number[6];
+    std::snprintf(number, sizeof(number), "%05d", this_file_number);
+    std::string fname = "rst/" + out_params.file_basename + "." + number + ".rst";
+    flush_file.Open(fname.c_str(), IOWrapper::FileMode::write);
+    if (my_rank == 0) {
+      flush_file.Write_bytes_at_nb(flush_header.data(), flush_header.size(), 0);
+    }
+    flush_file.Write_bytes_at_nb(flush_data.data(), flush_data.size(), own_offset);
+    flush_pending = true;
+    ncheckpoints = 0;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BuddyRestartOutput::ExchangeWithBuddy()
+//  \brief Sends checkpoint of this rank to rank (my_rank + buddy_offset), and receives
+//  checkpoint of rank (my_rank - buddy_offset).  Messages are split into chunks to avoid
+//  exceeding the 2^31 limit on counts.
+
+void BuddyRestartOutput::ExchangeWithBuddy() {
+#if MPI_PARALLEL_ENABLED
+  if (buddy_offset == 0) return;
+  int my_rank = global_variable::my_rank;
+  int nranks = global_variable::nranks;
+  int send_rank = (my_rank + buddy_offset) % nranks;
+  int recv_rank = (my_rank - buddy_offset + nranks) % nranks;
+
+  // exchange sizes of header and data, and offset of data in restart file
+  std::uint64_t send_info[3] = {own_header.size(), own_data.size(), own_offset};
+  std::uint64_t recv_info[3];
+  MPI_Sendrecv(send_info, 3, MPI_UINT64_T, send_rank, 0,
+               recv_info, 3, MPI_UINT64_T, recv_rank, 0,
+               MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+  buddy_header.resize(recv_info[0]);
+  buddy_data.resize(recv_info[1]);
+  buddy_data_offset = recv_info[2];
+
+  // exchange header and data, using chunk number as tag
+  const std::uint64_t max_chunk = (static_cast<std::uint64_t>(1) << 30);
+  std::vector<MPI_Request> req;
+  auto post = [&](std::vector<char> &sbuf, std::vector<char> &rbuf, int tag0) {
+    int tag = tag0;
+    for (std::uint64_t n=0; n<sbuf.size(); n+=max_chunk, ++tag) {
+      int cnt = static_cast<int>(std::min(max_chunk, sbuf.size() - n));
+      req.emplace_back();
+      MPI_Isend(sbuf.data() + n, cnt, MPI_BYTE, send_rank, tag, MPI_COMM_WORLD,
+                &req.back());
+    }
+    tag = tag0;
+    for (std::uint64_t n=0; n<rbuf.size(); n+=max_chunk, ++tag) {
+      int cnt = static_cast<int>(std::min(max_chunk, rbuf.size() - n));
+      req.emplace_back();
+      MPI_Irecv(rbuf.data() + n, cnt, MPI_BYTE, recv_rank, tag, MPI_COMM_WORLD,
+                &req.back());
+    }
+  };
+  req.reserve(16);
+  post(own_header, buddy_header, 1);
+  // data tags start after any possible header chunks
+  post(own_data, buddy_data, 1024);
+  MPI_Waitall(static_cast<int>(req.size()), req.data(), MPI_STATUSES_IGNORE);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BuddyRestartOutput::WritePiece()
+//  \brief Writes checkpoint of one rank into node-local storage.  Data is first written
+//  to a temporary file which is then renamed, so that an existing piece is only replaced
+//  by a complete one.
+
+void BuddyRestartOutput::WritePiece(const std::string &fname, int rank, int ncycle,
+                                    const std::vector<char> &header,
+                                    const std::vector<char> &data,
+                                    IOWrapperSizeT data_offset,
+                                    IOWrapperSizeT data_size) {
+  std::string tmpname = fname + ".tmp";
+  std::FILE *pfile = std::fopen(tmpname.c_str(), "wb");
+  if (pfile == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Buddy checkpoint file '" << tmpname << "' could not be opened"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  std::uint64_t info[6] = {static_cast<std::uint64_t>(ncycle),
+                           static_cast<std::uint64_t>(rank),
+                           static_cast<std::uint64_t>(global_variable::nranks),
+                           header.size(), data_offset, data_size};
+  bool ok = (std::fwrite(info, sizeof(std::uint64_t), 6, pfile) == 6);
+  ok = ok && (std::fwrite(header.data(), 1, header.size(), pfile) == header.size());
+  ok = ok && (std::fwrite(data.data(), 1, data.size(), pfile) == data.size());
+  ok = (std::fclose(pfile) == 0) && ok;
+  if (!(ok) || std::rename(tmpname.c_str(), fname.c_str()) != 0) {
+    std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Buddy checkpoint file '" << fname << "' not written correctly"
+              << std::endl;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BuddyRestartOutput::FinishFlush()
+//  \brief Waits for writes of any restart file in progress to complete and closes file
+
+void BuddyRestartOutput::FinishFlush() {
+  if (flush_pending) {
+    flush_file.Wait();
+    flush_file.Close();
+    flush_pending = false;
+  }
+  return;
+}
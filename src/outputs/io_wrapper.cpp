@@ -6,6 +6,7 @@
 //! \file io_wrapper.cpp
 //! \brief functions that provide wrapper for MPI-IO versus serial input/output
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <iomanip>
@@ -450,6 +451,55 @@ std::size_t IOWrapper::Write_any_type_at_all(const void *buf, IOWrapperSizeT cnt
 #endif
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void IOWrapper::Write_bytes_at_nb()
+//! \brief wrapper for {MPI_File_iwrite_at} versus {std::fseek+std::fwrite} for writing
+//! bytes without waiting for completion.  Large buffers are split into several requests
+//! to avoid exceeding the 2^31 limit on counts.  Writes are completed by Wait().  Without
+//! MPI the data is written immediately.
+
+void IOWrapper::Write_bytes_at_nb(const void *buf, IOWrapperSizeT cnt,
+                                  IOWrapperSizeT offset) {
+#if MPI_PARALLEL_ENABLED
+  const IOWrapperSizeT max_chunk = (static_cast<IOWrapperSizeT>(1) << 30);
+  const char *pbuf = static_cast<const char*>(buf);
+  while (cnt > 0) {
+    int n = static_cast<int>(std::min(cnt, max_chunk));
+    MPI_Request req;
+    int errcode = MPI_File_iwrite_at(fh_, offset, pbuf, n, MPI_BYTE, &req);
+    if (errcode != MPI_SUCCESS) {
+      char msg[MPI_MAX_ERROR_STRING];
+      int resultlen;
+      MPI_Error_string(errcode, msg, &resultlen);
+      Kokkos::printf("%.*s\n", resultlen, msg);
+      MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+    req_.push_back(req);
+    pbuf += n;
+    offset += n;
+    cnt -= n;
+  }
+#else
+  std::fseek(fh_, offset, SEEK_SET);
+  std::fwrite(buf, sizeof(char), cnt, fh_);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int IOWrapper::Wait()
+//! \brief wait for all non-blocking writes started by Write_bytes_at_nb() to complete
+
+int IOWrapper::Wait() {
+#if MPI_PARALLEL_ENABLED
+  if (req_.size() > 0) {
+    MPI_Waitall(static_cast<int>(req_.size()), req_.data(), MPI_STATUSES_IGNORE);
+    req_.clear();
+  }
+#endif
+  return true;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void IOWrapper::Close()
 //  \brief wrapper for {MPI_File_close} versus {std::fclose}
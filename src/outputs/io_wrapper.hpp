@@ -10,6 +10,7 @@
 
 #include <string>
 #include <cstdio>
+#include <vector>
 #include "athena.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -48,6 +49,9 @@ class IOWrapper {
   std::size_t Read_Reals(void *buf, IOWrapperSizeT count);
   std::size_t Read_Reals_at(void *buf, IOWrapperSizeT count, IOWrapperSizeT offset);
   std::size_t Read_Reals_at_all(void *buf, IOWrapperSizeT count, IOWrapperSizeT offset);
+  // non-blocking write of bytes, buffer must not be modified until Wait() returns
+  void Write_bytes_at_nb(const void *buf, IOWrapperSizeT count, IOWrapperSizeT offset);
+  int Wait();
   int Close();
   int Seek(IOWrapperSizeT offset);
   IOWrapperSizeT GetPosition();
@@ -56,6 +60,7 @@ class IOWrapper {
   IOWrapperFile fh_;
 #if MPI_PARALLEL_ENABLED
   MPI_Comm comm_;
+  std::vector<MPI_Request> req_;  // pending non-blocking writes
 #endif
 };
 #endif // OUTPUTS_IO_WRAPPER_HPP_
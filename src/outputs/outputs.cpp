@@ -18,7 +18,7 @@
 //! Required parameters that must be specified in an <output[n]> block are:
 //!   - variable  = [list of currently implemented strings for specifing output variables
 //!                  is defined at start of outputs.hpp file]
-//!   - file_type = tab,vtk,hst,bin,rst
+//!   - file_type = tab,vtk,hst,bin,rst,brst
 //!   - dt        = problem time between outputs
 //!
 //! EXAMPLE of an <output[n]> block for a TAB dump:
@@ -93,6 +93,7 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       // but only for those output types that use them
       if (opar.file_type.compare("hst") != 0 &&
           opar.file_type.compare("rst") != 0 &&
+          opar.file_type.compare("brst") != 0 &&
           opar.file_type.compare("log") != 0 &&
           opar.file_type.compare("trk") != 0) {
         if (opar.file_type.compare("power_spectrum") == 0) {
@@ -190,6 +191,7 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
       // set output variable and optional file id (default is output variable name)
       if (opar.file_type.compare("hst") != 0 &&
           opar.file_type.compare("rst") != 0 &&
+          opar.file_type.compare("brst") != 0 &&
           opar.file_type.compare("log") != 0 &&
           opar.file_type.compare("trk") != 0) {
         if (opar.file_type.compare("power_spectrum") == 0) {
@@ -296,6 +298,10 @@ Outputs::Outputs(ParameterInput *pin, Mesh *pm) {
         pnode = new RestartOutput(pin,pm,opar);
         pout_list.push_back(pnode);
         num_rst++;
+      } else if (opar.file_type.compare("brst") == 0) {
+        pnode = new BuddyRestartOutput(pin,pm,opar);
+        pout_list.push_back(pnode);
+        num_rst++;
       } else {
         std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
             << std::endl << "Unrecognized file format = '" << opar.file_type
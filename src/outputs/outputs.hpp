@@ -21,7 +21,7 @@
     #error NHISTORY > NREDUCTION in outputs.hpp
 #endif
 
-#define NOUTPUT_CHOICES 152
+#define NOUTPUT_CHOICES 157
 // choices for output variables used in <ouput> blocks in input file
 // TO ADD MORE CHOICES:
 //   - add more strings to array below, change NOUTPUT_CHOICES above appropriately
@@ -96,7 +96,10 @@ static const char *var_choice[NOUTPUT_CHOICES] = {
   "tmunu",
 
   // Particles (150-151)
-  "prtcl_all", "prtcl_d"
+  "prtcl_all", "prtcl_d",
+
+  // M1 radiation (152-156)
+  "rad_m1_e", "rad_m1_f1", "rad_m1_f2", "rad_m1_f3", "rad_m1"
 };
 
 
@@ -188,16 +191,6 @@ struct HistoryData {
   explicit HistoryData(PhysicsModule name) : physics(name), header_written(false) {}
 };
 
-//----------------------------------------------------------------------------------------
-//! \struct TrackedParticleData
-//! \brief data (tag, pos, vel) output for tracked particles
-
-struct TrackedParticleData {
-  int tag;
-  Real x,y,z;
-  Real vx,vy,vz;
-};
-
 //----------------------------------------------------------------------------------------
 // \brief abstract base class for different output types (modes/formats); node in
 //        std::list of BaseTypeOutput created & stored in the Outputs class
@@ -241,8 +234,9 @@ class BaseTypeOutput {
   // CC output data on host with dims (n,m,k,j,i) except
   // for restarts, where dims are (m,n,k,j,i)
   HostArray5D<Real> outarray;
-  HostArray5D<Real> outarray_hyd, outarray_mhd, outarray_rad,
-                    outarray_force, outarray_z4c, outarray_adm;
+  HostArray5D<Real> outarray_hyd, outarray_mhd, outarray_rad, outarray_rm1,
+                    outarray_force, outarray_z4c, outarray_z4cmr,
+                    outarray_adm;
   HostFaceFld4D<Real> outfield;  // FC output field on host
   std::vector<int> noutmbs;   // with MPI, number of output MBs across all ranks
   int noutmbs_min;            // with MPI, minimum number of output MBs across all ranks
@@ -360,9 +354,9 @@ class ParticleVTKOutput : public BaseTypeOutput {
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
  protected:
   int npout_thisrank;
-  int npout_total;
-  HostArray2D<Real> outpart_rdata;
-  HostArray2D<int>  outpart_idata;
+  std::int64_t npout_total;
+  std::int64_t npout_offset;   // number of particles written by lower ranks
+  HostArray1D<float> outdata;  // positions (x,y,z) followed by each integer variable
 };
 
 //----------------------------------------------------------------------------------------
@@ -383,6 +377,42 @@ class RestartOutput : public BaseTypeOutput {
   RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+ protected:
+  void PackRestartHeader(Mesh *pm, const std::string &sbuf, std::vector<char> &buf);
+  IOWrapperSizeT RestartDataSize(Mesh *pm);
+};
+
+//----------------------------------------------------------------------------------------
+//! \class BuddyRestartOutput
+//  \brief derived RestartOutput class for in-memory checkpoints.  Restart data of each
+//  rank is kept in host memory and copied to a buddy rank on another node, and is only
+//  flushed to a standard restart file every flush_interval checkpoints using
+//  non-blocking writes that overlap with the following steps.
+
+class BuddyRestartOutput : public RestartOutput {
+ public:
+  BuddyRestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
+  ~BuddyRestartOutput();
+  void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+ private:
+  int flush_interval;          // number of checkpoints between flushes to disk (0=never)
+  int ncheckpoints;            // number of checkpoints since last flush
+  int buddy_offset;            // data sent to rank (my_rank + buddy_offset)%nranks
+  std::string buddy_dir;       // optional node-local directory for checkpoint pieces
+  // checkpoint of this rank and copy received from buddy.  Headers are only non-empty on
+  // rank 0, offsets locate data of each rank in the restart file
+  std::vector<char> own_header, own_data, buddy_header, buddy_data;
+  IOWrapperSizeT own_offset, buddy_data_offset;
+  // buffers and file for flush in progress
+  std::vector<char> flush_header, flush_data;
+  IOWrapper flush_file;
+  bool flush_pending;
+
+  void ExchangeWithBuddy();
+  void WritePiece(const std::string &fname, int rank, int ncycle,
+                  const std::vector<char> &header, const std::vector<char> &data,
+                  IOWrapperSizeT data_offset, IOWrapperSizeT data_size);
+  void FinishFlush();
 };
 
 //----------------------------------------------------------------------------------------
@@ -412,11 +442,10 @@ class TrackedParticleOutput : public BaseTypeOutput {
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
  protected:
   int ntrack;           // total number of tracked particles across all ranks
-  int ntrack_thisrank;  // number of tracked particles this rank (guess)
   int npout;            // number of tracked particles to be written this rank
   bool header_written;
-  std::vector<int> npout_eachrank;
-  HostArray1D<TrackedParticleData> outpart;
+  HostArray1D<int> outtag;     // tags of tracked particles on this rank
+  HostArray1D<float> outdata;  // (x,y,z,vx,vy,vz) of tracked particles on this rank
 };
 
 //----------------------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 #include <sstream>
 #include <string>
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/cell_locations.hpp"
@@ -28,6 +29,7 @@
 #include "z4c/compact_object_tracker.hpp"
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
+#include "radiation_m1/radiation_m1.hpp"
 #include "srcterms/turb_driver.hpp"
 //#include "outputs.hpp"
 
@@ -59,8 +61,9 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
   adm::ADM* padm = pm->pmb_pack->padm;
   z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
   radiation::Radiation* prad = pm->pmb_pack->prad;
+  radiation_m1::RadiationM1* prm1 = pm->pmb_pack->prm1;
   TurbulenceDriver* pturb=pm->pmb_pack->pturb;
-  int nhydro=0, nmhd=0, nrad=0, nforce=3, nadm=0, nz4c=0;
+  int nhydro=0, nmhd=0, nrad=0, nm1=0, nforce=3, nadm=0, nz4c=0;
   if (phydro != nullptr) {
     nhydro = phydro->nhydro + phydro->nscalars;
   }
@@ -76,45 +79,75 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
   if (prad != nullptr) {
     nrad = prad->prgeo->nangles;
   }
+  if (prm1 != nullptr) {
+    nm1 = NM1VAR;
+  }
 
   // Note for restarts, outarrays are dimensioned (m,n,k,j,i)
   if (phydro != nullptr) {
     Kokkos::realloc(outarray_hyd, nmb, nhydro, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_hyd, Kokkos::subview(phydro->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outarray_hyd, Kokkos::subview(phydro->u0, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
   if (pmhd != nullptr) {
     Kokkos::realloc(outarray_mhd, nmb, nmhd, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_mhd, Kokkos::subview(pmhd->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outarray_mhd, Kokkos::subview(pmhd->u0, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
     Kokkos::realloc(outfield.x1f, nmb, nout3, nout2, nout1+1);
-    Kokkos::deep_copy(outfield.x1f, Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outfield.x1f, Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
     Kokkos::realloc(outfield.x2f, nmb, nout3, nout2+1, nout1);
-    Kokkos::deep_copy(outfield.x2f, Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outfield.x2f, Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
     Kokkos::realloc(outfield.x3f, nmb, nout3+1, nout2, nout1);
-    Kokkos::deep_copy(outfield.x3f, Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outfield.x3f, Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
   if (prad != nullptr) {
     Kokkos::realloc(outarray_rad, nmb, nrad, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_rad, Kokkos::subview(prad->i0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outarray_rad, Kokkos::subview(prad->i0, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+  }
+  if (prm1 != nullptr) {
+    Kokkos::realloc(outarray_rm1, nmb, nm1, nout3, nout2, nout1);
+    deep_copy_layout(outarray_rm1, Kokkos::subview(prm1->u0, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
   if (pturb != nullptr) {
     Kokkos::realloc(outarray_force, nmb, nforce, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_force, Kokkos::subview(pturb->force, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outarray_force, Kokkos::subview(pturb->force, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
   if (pz4c != nullptr) {
     Kokkos::realloc(outarray_z4c, nmb, nz4c, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_z4c, Kokkos::subview(pz4c->u0, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outarray_z4c, Kokkos::subview(pz4c->u0, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    // with multirate coupling, also store both spacetime levels and the evolved gauge
+    if (pz4c->mr_nsub > 1) {
+      int nmr = 2*(adm::ADM::nadm) + 4;
+      int nadm_ = adm::ADM::nadm;
+      DvceArray5D<Real> mrtmp("rst-mr", nmb, nmr, nout3, nout2, nout1);
+      Kokkos::deep_copy(Kokkos::subview(mrtmp, Kokkos::ALL, std::make_pair(0,nadm_),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(pz4c->mr_adm_old, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+      Kokkos::deep_copy(Kokkos::subview(mrtmp, Kokkos::ALL,
+                        std::make_pair(nadm_,2*nadm_), Kokkos::ALL, Kokkos::ALL,
+                        Kokkos::ALL),
+                        Kokkos::subview(pz4c->mr_adm_new, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+      Kokkos::deep_copy(Kokkos::subview(mrtmp, Kokkos::ALL,
+                        std::make_pair(2*nadm_,nmr), Kokkos::ALL, Kokkos::ALL,
+                        Kokkos::ALL),
+                        Kokkos::subview(pz4c->mr_gauge, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+      Kokkos::realloc(outarray_z4cmr, nmb, nmr, nout3, nout2, nout1);
+      deep_copy_layout(outarray_z4cmr, mrtmp);
+    }
   } else if (padm != nullptr) {
     Kokkos::realloc(outarray_adm, nmb, nadm, nout3, nout2, nout1);
-    Kokkos::deep_copy(outarray_adm, Kokkos::subview(padm->u_adm, std::make_pair(0,nmb),
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+    deep_copy_layout(outarray_adm, Kokkos::subview(padm->u_adm, std::make_pair(0,nmb),
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
 
   // calculate max/min number of MeshBlocks across all ranks
@@ -126,6 +159,110 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::PackRestartHeader()
+//  \brief Packs the header of restart files (everything written by the root process
+//  before the size of the data for each MeshBlock) into a buffer.  The string sbuf holds
+//  a copy of the input parameters.
+
+void RestartOutput::PackRestartHeader(Mesh *pm, const std::string &sbuf,
+                                      std::vector<char> &buf) {
+  auto append = [&buf](const void *data, std::size_t size) {
+    const char *pdata = static_cast<const char*>(data);
+    buf.insert(buf.end(), pdata, pdata + size);
+  };
+  buf.clear();
+
+  //--- STEP 1.  Header data (input file, critical variables)
+  // Input file data is read by ParameterInput on restart, and the remaining header
+  // variables are read in Mesh::BuildTreeFromRestart()
+  append(sbuf.c_str(), sbuf.size());
+  append(&(pm->nmb_total), sizeof(int));
+  append(&(pm->root_level), sizeof(int));
+  append(&(pm->mesh_size), sizeof(RegionSize));
+  append(&(pm->mesh_indcs), sizeof(RegionIndcs));
+  append(&(pm->mb_indcs), sizeof(RegionIndcs));
+  append(&(pm->time), sizeof(Real));
+  append(&(pm->dt), sizeof(Real));
+  append(&(pm->ncycle), sizeof(int));
+
+  //--- STEP 2.  List of logical locations and cost of MeshBlocks
+  // This data read in Mesh::BuildTreeFromRestart()
+  append(&(pm->lloc_eachmb[0]), (pm->nmb_total)*sizeof(LogicalLocation));
+  append(&(pm->cost_eachmb[0]), (pm->nmb_total)*sizeof(float));
+
+  //--- STEP 3.  Internal state of objects that require it
+  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
+  TurbulenceDriver* pturb=pm->pmb_pack->pturb;
+  // store z4c information
+  if (pz4c != nullptr) {
+    append(&(pz4c->last_output_time), sizeof(Real));
+    // output puncture tracker data
+    for (auto & pt : pz4c->ptracker) {
+      append(pt.GetPos(), 3*sizeof(Real));
+    }
+    // times of the spacetime levels stored for multirate coupling
+    if (pz4c->mr_nsub > 1) {
+      Real mr_state[3] = {pz4c->mr_told, pz4c->mr_tnew,
+                          static_cast<Real>(pz4c->mr_init)};
+      append(&(mr_state[0]), 3*sizeof(Real));
+    }
+  }
+  // turbulence driver internal RNG
+  if (pturb != nullptr) {
+    append(&(pturb->rstate), sizeof(RNG_State));
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn IOWrapperSizeT RestartOutput::RestartDataSize()
+//  \brief Returns size in bytes of all cell-centered variables and face-centered fields
+//  stored for each MeshBlock in restart files
+
+IOWrapperSizeT RestartOutput::RestartDataSize(Mesh *pm) {
+  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
+  IOWrapperSizeT nout1 = indcs.nx1 + 2*(indcs.ng);
+  IOWrapperSizeT nout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  IOWrapperSizeT nout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  hydro::Hydro* phydro = pm->pmb_pack->phydro;
+  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
+  radiation::Radiation* prad = pm->pmb_pack->prad;
+  radiation_m1::RadiationM1* prm1 = pm->pmb_pack->prm1;
+  TurbulenceDriver* pturb=pm->pmb_pack->pturb;
+  z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
+  adm::ADM* padm = pm->pmb_pack->padm;
+
+  IOWrapperSizeT data_size = 0;
+  if (phydro != nullptr) {
+    data_size += nout1*nout2*nout3*(phydro->nhydro + phydro->nscalars)*sizeof(Real);
+  }
+  if (pmhd != nullptr) {
+    data_size += nout1*nout2*nout3*(pmhd->nmhd + pmhd->nscalars)*sizeof(Real);
+    data_size += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
+    data_size += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
+    data_size += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+  }
+  if (prad != nullptr) {
+    data_size += nout1*nout2*nout3*(prad->prgeo->nangles)*sizeof(Real);
+  }
+  if (prm1 != nullptr) {
+    data_size += nout1*nout2*nout3*NM1VAR*sizeof(Real);
+  }
+  if (pturb != nullptr) {
+    data_size += nout1*nout2*nout3*3*sizeof(Real);      // forcing
+  }
+  if (pz4c != nullptr) {
+    data_size += nout1*nout2*nout3*(pz4c->nz4c)*sizeof(Real);
+    if (pz4c->mr_nsub > 1) {
+      data_size += nout1*nout2*nout3*(2*(adm::ADM::nadm) + 4)*sizeof(Real);
+    }
+  } else if (padm != nullptr) {
+    data_size += nout1*nout2*nout3*(padm->nadm)*sizeof(Real);
+  }
+  return data_size;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void RestartOutput:::WriteOutputFile(Mesh *pm)
 //  \brief Cycles over all MeshBlocks and writes everything to a single restart file
@@ -139,10 +276,11 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   hydro::Hydro* phydro = pm->pmb_pack->phydro;
   mhd::MHD* pmhd = pm->pmb_pack->pmhd;
   radiation::Radiation* prad = pm->pmb_pack->prad;
+  radiation_m1::RadiationM1* prm1 = pm->pmb_pack->prm1;
   TurbulenceDriver* pturb=pm->pmb_pack->pturb;
   z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
   adm::ADM* padm = pm->pmb_pack->padm;
-  int nhydro=0, nmhd=0, nrad=0, nforce=3, nz4c=0, nadm=0, nco=0;
+  int nhydro=0, nmhd=0, nrad=0, nm1=0, nforce=3, nz4c=0, nadm=0;
   if (phydro != nullptr) {
     nhydro = phydro->nhydro + phydro->nscalars;
   }
@@ -152,9 +290,11 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   if (prad != nullptr) {
     nrad = prad->prgeo->nangles;
   }
+  if (prm1 != nullptr) {
+    nm1 = NM1VAR;
+  }
   if (pz4c != nullptr) {
     nz4c = pz4c->nz4c;
-    nco = pz4c->ptracker.size();
   } else if (padm != nullptr) {
     nadm = padm->nadm;
   }
@@ -185,53 +325,15 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pin->ParameterDump(ost);
   std::string sbuf = ost.str();
 
-  //--- STEP 1.  Root process writes header data (input file, critical variables)
-  // Input file data is read by ParameterInput on restart, and the remaining header
-  // variables are read in Mesh::BuildTreeFromRestart()
+  //--- STEPS 1-3.  Root process writes header data, see PackRestartHeader()
+  std::vector<char> header;
+  PackRestartHeader(pm, sbuf, header);
 
   // open file and  write the header; this part is serial
   IOWrapper resfile;
   resfile.Open(fname.c_str(), IOWrapper::FileMode::write);
   if (global_variable::my_rank == 0) {
-    // output the input parameters (input file)
-    resfile.Write_any_type(sbuf.c_str(),sbuf.size(),"byte");
-
-    // output Mesh information
-    resfile.Write_any_type(&(pm->nmb_total), (sizeof(int)), "byte");
-    resfile.Write_any_type(&(pm->root_level), (sizeof(int)), "byte");
-    resfile.Write_any_type(&(pm->mesh_size), (sizeof(RegionSize)), "byte");
-    resfile.Write_any_type(&(pm->mesh_indcs), (sizeof(RegionIndcs)), "byte");
-    resfile.Write_any_type(&(pm->mb_indcs), (sizeof(RegionIndcs)), "byte");
-    resfile.Write_any_type(&(pm->time), (sizeof(Real)), "byte");
-    resfile.Write_any_type(&(pm->dt), (sizeof(Real)), "byte");
-    resfile.Write_any_type(&(pm->ncycle), (sizeof(int)), "byte");
-  }
-
-  //--- STEP 2.  Root process writes list of logical locations and cost of MeshBlocks
-  // This data read in Mesh::BuildTreeFromRestart()
-
-  if (global_variable::my_rank == 0) {
-    resfile.Write_any_type(&(pm->lloc_eachmb[0]),(pm->nmb_total)*sizeof(LogicalLocation),
-                           "byte");
-    resfile.Write_any_type(&(pm->cost_eachmb[0]), (pm->nmb_total)*sizeof(float),"byte");
-  }
-
-  //--- STEP 3.  Root process writes internal state of objects that require it
-  if (global_variable::my_rank == 0) {
-    // store z4c information
-    if (pz4c != nullptr) {
-      resfile.Write_any_type(&(pz4c->last_output_time), sizeof(Real), "byte");
-    }
-    // output puncture tracker data
-    if (nco > 0) {
-      for (auto & pt : pz4c->ptracker) {
-        resfile.Write_any_type(pt.GetPos(), 3*sizeof(Real), "byte");
-      }
-    }
-    // turbulence driver internal RNG
-    if (pturb != nullptr) {
-      resfile.Write_any_type(&(pturb->rstate), sizeof(RNG_State), "byte");
-    }
+    resfile.Write_any_type(header.data(), header.size(), "byte");
   }
 
   //--- STEP 4.  All ranks write data over all MeshBlocks (5D arrays) in parallel
@@ -239,43 +341,14 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
 
   // total size of all cell-centered variables and face-centered fields to be written by
   // this rank
-  IOWrapperSizeT data_size = 0;
-  if (phydro != nullptr) {
-    data_size += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
-  }
-  if (pmhd != nullptr) {
-    data_size += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
-    data_size += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
-    data_size += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
-    data_size += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
-  }
-  if (prad != nullptr) {
-    data_size += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
-  }
-  if (pturb != nullptr) {
-    data_size += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
-  }
-  if (pz4c != nullptr) {
-    data_size += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
-  } else if (padm != nullptr) {
-    data_size += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
-  }
+  IOWrapperSizeT data_size = RestartDataSize(pm);
   if (global_variable::my_rank == 0) {
     resfile.Write_any_type(&(data_size), sizeof(IOWrapperSizeT), "byte");
   }
 
-  // calculate size of data written in Steps 1-2 above
-  IOWrapperSizeT step1size = sbuf.size()*sizeof(char) + 3*sizeof(int) + 2*sizeof(Real) +
-                             sizeof(RegionSize) + 2*sizeof(RegionIndcs);
-  IOWrapperSizeT step2size = (pm->nmb_total)*(sizeof(LogicalLocation) + sizeof(float));
-
-  IOWrapperSizeT step3size = 3*nco*sizeof(Real);
-  if (pz4c != nullptr) step3size += sizeof(Real);
-  if (pturb != nullptr) step3size += sizeof(RNG_State);
-
   // write cell-centered variables in parallel
-  IOWrapperSizeT offset_myrank  = step1size + step2size + step3size +
-        sizeof(IOWrapperSizeT) + data_size*(pm->gids_eachrank[global_variable::my_rank]);
+  IOWrapperSizeT offset_myrank  = header.size() + sizeof(IOWrapperSizeT) +
+                                  data_size*(pm->gids_eachrank[global_variable::my_rank]);
   IOWrapperSizeT myoffset = offset_myrank;
 
   // write cell-centered variables, one MeshBlock at a time (but parallelized over all
@@ -466,6 +539,41 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     myoffset = offset_myrank;
   }
 
+  if (prm1 != nullptr) {
+    for (int m=0;  m<noutmbs_max; ++m) {
+      // every rank has a MB to write, so write collectively
+      if (m < noutmbs_min) {
+        // get ptr to cell-centered MeshBlock data
+        auto mbptr = Kokkos::subview(outarray_rm1, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        int mbcnt = mbptr.size();
+        if (resfile.Write_any_type_at_all(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "cell-centered M1 rad data not written correctly to rst file, "
+          << "restart file is broken." << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        myoffset += data_size;
+
+      // some ranks are finished writing, so use non-collective write
+      } else if (m < pm->nmb_thisrank) {
+        // get ptr to MeshBlock data
+        auto mbptr = Kokkos::subview(outarray_rm1, m, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL, Kokkos::ALL);
+        int mbcnt = mbptr.size();
+        if (resfile.Write_any_type_at(mbptr.data(),mbcnt,myoffset,"Real") != mbcnt) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "cell-centered M1 rad data not written correctly to rst file, "
+          << "restart file is broken." << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        myoffset += data_size;
+      }
+    }
+    offset_myrank += nout1*nout2*nout3*nm1*sizeof(Real);    // radiation M1 u0
+    myoffset = offset_myrank;
+  }
+
   if (pturb != nullptr) {
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to write, so write collectively
@@ -534,6 +642,41 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
     offset_myrank += nout1*nout2*nout3*nz4c*sizeof(Real); // z4c u0
     myoffset = offset_myrank;
+
+    if (pz4c->mr_nsub > 1) {
+      int nmr = 2*(adm::ADM::nadm) + 4;
+      for (int m=0;  m<noutmbs_max; ++m) {
+        // every rank has a MB to write, so write collectively
+        if (m < noutmbs_min) {
+          auto mbptr = Kokkos::subview(outarray_z4cmr, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at_all(mbptr.data(), mbcnt, myoffset, "Real")
+              != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "z4c multirate data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
+
+        // some ranks are finished writing, so use non-collective write
+        } else if (m < pm->nmb_thisrank) {
+          auto mbptr = Kokkos::subview(outarray_z4cmr, m, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL, Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Write_any_type_at(mbptr.data(), mbcnt, myoffset,"Real") != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+            << std::endl << "z4c multirate data not written correctly to rst file, "
+            << "restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
+        }
+      }
+      offset_myrank += nout1*nout2*nout3*nmr*sizeof(Real); // z4c multirate levels
+      myoffset = offset_myrank;
+    }
   } else if (padm != nullptr) {
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to write, so write collectively
@@ -31,51 +31,53 @@ TrackedParticleOutput::TrackedParticleOutput(ParameterInput *pin, Mesh *pm,
   BaseTypeOutput(pin, pm, op) {
   // create new directory for this output. Comments in binary.cpp constructor explain why
   mkdir("trk",0775);
-  // allocate arrays
-  npout_eachrank.resize(global_variable::nranks);
   ntrack = pin->GetInteger(op.block_name,"nparticles");
-  // TODO(@user) improve guess below?
-  ntrack_thisrank = ntrack;
 }
 
 //----------------------------------------------------------------------------------------
 // TrackedParticleOutput::LoadOutputData()
-// Copies data for tracked particles on this rank to host outpart array
+// Selects tracked particles on this rank (those with tag < ntrack) using a parallel scan
+// on the device, packs their tags and (pos,vel) as floats into contiguous arrays, and
+// copies these to the host.
 
 void TrackedParticleOutput::LoadOutputData(Mesh *pm) {
-  // Load data for tracked particles on this rank into new device array
-  DualArray1D<TrackedParticleData> tracked_prtcl("d_trked",ntrack_thisrank);
   int npart = pm->nprtcl_thisrank;
   auto &pr = pm->pmb_pack->ppart->prtcl_rdata;
   auto &pi = pm->pmb_pack->ppart->prtcl_idata;
-  int counter=0;
-  int *pcounter = &counter;
-  par_for("part_update",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
-    if (pi(PTAG,p) < ntrack) {
-      int index = Kokkos::atomic_fetch_add(pcounter,1);
-      tracked_prtcl.d_view(index).tag = pi(PTAG,p);
-      tracked_prtcl.d_view(index).x   = pr(IPX,p);
-      tracked_prtcl.d_view(index).y   = pr(IPY,p);
-      tracked_prtcl.d_view(index).z   = pr(IPZ,p);
-      tracked_prtcl.d_view(index).vx  = pr(IPVX,p);
-      tracked_prtcl.d_view(index).vy  = pr(IPVY,p);
-      tracked_prtcl.d_view(index).vz  = pr(IPVZ,p);
+  int ntrk = ntrack;
+
+  // index of each tracked particle in output arrays from exclusive scan over particles
+  DvceArray1D<int> d_index("d_index", npart);
+  int nsel = 0;
+  Kokkos::parallel_scan("trk_select",Kokkos::RangePolicy<>(DevExeSpace(),0,npart),
+  KOKKOS_LAMBDA(const int p, int &offset, const bool final) {
+    bool tracked = (pi(PTAG,p) < ntrk);
+    if (final) {d_index(p) = offset;}
+    if (tracked) {offset++;}
+  }, nsel);
+  npout = nsel;
+
+  // pack tracked particle data
+  DvceArray1D<int> d_tag("d_tag", npout);
+  DvceArray1D<float> d_data("d_data", 6*npout);
+  par_for("trk_pack",DevExeSpace(),0,(npart-1), KOKKOS_LAMBDA(const int p) {
+    if (pi(PTAG,p) < ntrk) {
+      int n = d_index(p);
+      d_tag(n) = pi(PTAG,p);
+      d_data(6*n  ) = static_cast<float>(pr(IPX,p));
+      d_data(6*n+1) = static_cast<float>(pr(IPY,p));
+      d_data(6*n+2) = static_cast<float>(pr(IPZ,p));
+      d_data(6*n+3) = static_cast<float>(pr(IPVX,p));
+      d_data(6*n+4) = static_cast<float>(pr(IPVY,p));
+      d_data(6*n+5) = static_cast<float>(pr(IPVZ,p));
     }
   });
-  npout = counter;
-  // share number of tracked particles to be output across all ranks
-  npout_eachrank[global_variable::my_rank] = npout;
-#if MPI_PARALLEL_ENABLED
-  MPI_Allgather(&npout, 1, MPI_INT, npout_eachrank.data(), 1, MPI_INT, MPI_COMM_WORLD);
-#endif
-  tracked_prtcl.resize(npout);
-  // sync tracked particle device array with host
-  tracked_prtcl.template modify<DevExeSpace>();
-  tracked_prtcl.template sync<HostMemSpace>();
-
-  // copy host view into host outpart array
-  Kokkos::realloc(outpart, npout);
-  Kokkos::deep_copy(outpart, tracked_prtcl.h_view);
+
+  // copy packed data to host
+  Kokkos::realloc(outtag, npout);
+  Kokkos::realloc(outdata, 6*npout);
+  Kokkos::deep_copy(outtag, d_tag);
+  Kokkos::deep_copy(outdata, d_data);
 }
 
 //----------------------------------------------------------------------------------------
@@ -115,43 +117,44 @@ void TrackedParticleOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   std::size_t header_offset = partfile.GetPosition();
 //  std::size_t header_offset = 0;
 
-  // allocate 1D vector of floats used to convert and output particle data
-  float *data = new float[6*npout];
-  // Loop over particles, load positions into data[]
+  // Data for each particle is stored at offset computed from its tag, assuming tags run
+  // 0...(ntrack-1).  Sort particles on this rank by tag, and combine particles with
+  // consecutive tags into runs that are written as single contiguous blocks.
+  std::vector<int> order(npout);
+  for (int p=0; p<npout; ++p) {order[p] = p;}
+  std::sort(order.begin(), order.end(),
+            [&](const int a, const int b) {return outtag(a) < outtag(b);});
+  std::vector<float> data(6*npout);
+  std::vector<int> run_start, run_len;
   for (int p=0; p<npout; ++p) {
-    data[ 6*p   ] = static_cast<float>(outpart(p).x);
-    data[(6*p)+1] = static_cast<float>(outpart(p).y);
-    data[(6*p)+2] = static_cast<float>(outpart(p).z);
-    data[(6*p)+3] = static_cast<float>(outpart(p).vx);
-    data[(6*p)+4] = static_cast<float>(outpart(p).vy);
-    data[(6*p)+5] = static_cast<float>(outpart(p).vz);
-  }
-  // calculate local data offset
-  std::vector<int> rank_offset(global_variable::nranks, 0);
-  int npout_min = pm->nprtcl_eachrank[0];
-  for (int n=1; n<global_variable::nranks; ++n) {
-    rank_offset[n] = rank_offset[n-1] + npout_eachrank[n-1];
-    npout_min = std::min(npout_min, npout_eachrank[n]);
+    int q = order[p];
+    for (int n=0; n<6; ++n) {data[6*p+n] = outdata(6*q+n);}
+    if (p > 0 && outtag(q) == outtag(order[p-1]) + 1) {
+      run_len.back()++;
+    } else {
+      run_start.push_back(p);
+      run_len.push_back(1);
+    }
   }
 
-  // Write tracked particle data collectively over minimum shared number of prtcls
-  for (int p=0; p<npout_min; ++p) {
-    // offset computed assuming tags run 0...(ntrack-1) sequentially
-    std::size_t myoffset = header_offset + 6*outpart(p).tag;
-    // Write particle positions collectively for minimum number of particles across ranks
-    if (partfile.Write_any_type_at_all(&(data[0]),6,myoffset,"float") != 6) {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "particle data not written correctly to tracked particle file"
-          << std::endl;
-      exit(EXIT_FAILURE);
+  // Write each run collectively.  Ranks with fewer runs than maximum participate in
+  // remaining collective calls with empty writes.
+  int nrun = run_start.size();
+  int nrun_max = nrun;
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(&nrun, &nrun_max, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  std::size_t datasize = sizeof(float);
+  for (int r=0; r<nrun_max; ++r) {
+    std::size_t myoffset = header_offset;
+    std::size_t ndata = 0;
+    float *pdata = data.data();
+    if (r < nrun) {
+      myoffset += 6*static_cast<std::size_t>(outtag(order[run_start[r]]))*datasize;
+      ndata = 6*run_len[r];
+      pdata = &(data[6*run_start[r]]);
     }
-  }
-  // Write particle positions individually for remaining particles on each rank
-  for (int p=npout_min; p<npout; ++p) {
-    // offset computed assuming tags run 0...(ntrack-1) sequentially
-    std::size_t myoffset = header_offset + 6*outpart(p).tag;
-    // Write particle positions collectively for minimum number of particles across ranks
-    if (partfile.Write_any_type_at(&(data[0]),6,myoffset,"float") != 6) {
+    if (partfile.Write_any_type_at_all(pdata,ndata,myoffset,"float") != ndata) {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
           << std::endl << "particle data not written correctly to tracked particle file"
           << std::endl;
@@ -159,9 +162,8 @@ void TrackedParticleOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
   }
 
-  // close the output file and clean up
+  // close the output file
   partfile.Close();
-  delete[] data;
 
   // increment counters
   if (out_params.last_time < 0.0) {
@@ -38,26 +38,47 @@ ParticleVTKOutput::ParticleVTKOutput(ParameterInput *pin, Mesh *pm, OutputParame
 
 //----------------------------------------------------------------------------------------
 // ParticleVTKOutput::LoadOutputData()
-// Copies real and integer particle data to host for outputs
+// Converts particle positions and integer data to floats and packs them into a single
+// contiguous array on the device, which is then copied to the host in one transfer.
+// Positions are stored as (x,y,z) triplets for all particles, followed by each integer
+// variable for all particles, i.e. in the order they are written to the file.
 
 void ParticleVTKOutput::LoadOutputData(Mesh *pm) {
   particles::Particles *pp = pm->pmb_pack->ppart;
   npout_thisrank = pm->nprtcl_thisrank;
-  npout_total = pm->nprtcl_total;
-  Kokkos::realloc(outpart_rdata, pp->nrdata, npout_thisrank);
-  Kokkos::realloc(outpart_idata, pp->nidata, npout_thisrank);
+  int npout = npout_thisrank;
+  int nidata = pp->nidata;
+
+  // offset of particles on this rank in file, and total number of particles
+  std::int64_t npout_local = npout_thisrank;
+  npout_offset = 0;
+  npout_total = npout_local;
+#if MPI_PARALLEL_ENABLED
+  MPI_Exscan(&npout_local, &npout_offset, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+  if (global_variable::my_rank == 0) {npout_offset = 0;}
+  MPI_Allreduce(&npout_local, &npout_total, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  // pack output data on device
+  DvceArray1D<float> d_outdata("d_outdata", (3 + nidata)*npout);
+  auto &pr = pp->prtcl_rdata;
+  auto &pi = pp->prtcl_idata;
+  bool multi_d = pm->multi_d;
+  bool three_d = pm->three_d;
+  float x2min = static_cast<float>(pm->mesh_size.x2min);
+  float x3min = static_cast<float>(pm->mesh_size.x3min);
+  par_for("pvtk_pack",DevExeSpace(),0,(npout-1), KOKKOS_LAMBDA(const int p) {
+    d_outdata(3*p) = static_cast<float>(pr(IPX,p));
+    d_outdata(3*p+1) = (multi_d)? static_cast<float>(pr(IPY,p)) : x2min;
+    d_outdata(3*p+2) = (three_d)? static_cast<float>(pr(IPZ,p)) : x3min;
+    for (int n=0; n<nidata; ++n) {
+      d_outdata((3+n)*npout + p) = static_cast<float>(pi(n,p));
+    }
+  });
 
-  // Create mirror view on device of host view of output particle real/int data
-  auto d_outpart_rdata = Kokkos::create_mirror_view(Kokkos::DefaultHostExecutionSpace(),
-                                                    outpart_rdata);
-  auto d_outpart_idata = Kokkos::create_mirror_view(Kokkos::DefaultHostExecutionSpace(),
-                                                    outpart_idata);
-  // Copy particle positions into device mirrors
-  Kokkos::deep_copy(d_outpart_rdata, pp->prtcl_rdata);
-  Kokkos::deep_copy(d_outpart_idata, pp->prtcl_idata);
-  // Copy particle positions from device mirror to host output array
-  Kokkos::deep_copy(outpart_rdata, d_outpart_rdata);
-  Kokkos::deep_copy(outpart_idata, d_outpart_idata);
+  // copy packed data to host
+  Kokkos::realloc(outdata, (3 + nidata)*npout);
+  Kokkos::deep_copy(outdata, d_outdata);
 }
 
 //----------------------------------------------------------------------------------------
@@ -126,59 +147,27 @@ void ParticleVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     }
     header_offset += msg.str().size();
   }
-  // allocate 1D vector of floats used to convert and output particle data
-  float *data = new float[3*npout_thisrank];
-  // Loop over particles, load positions into data[]
-  for (int p=0; p<npout_thisrank; ++p) {
-    data[3*p] = static_cast<float>(outpart_rdata(IPX,p));
-    if (pm->multi_d) {
-      data[(3*p)+1] = static_cast<float>(outpart_rdata(IPY,p));
-    } else {
-      data[(3*p)+1] = static_cast<float>(pm->mesh_size.x2min);
-    }
-    if (pm->three_d) {
-      data[(3*p)+2] = static_cast<float>(outpart_rdata(IPZ,p));
-    } else {
-      data[(3*p)+2] = static_cast<float>(pm->mesh_size.x3min);
-    }
-  }
-  // swap data for this variable into big endian order
+  // swap data into big endian order
+  float *data = outdata.data();
+  std::size_t ndata = outdata.extent(0);
   if (!big_end) {
-    for (int i=0; i<(3*npout_thisrank); ++i) { Swap4Bytes(&data[i]); }
-  }
-  // calculate local data offset
-  std::vector<int> rank_offset(global_variable::nranks, 0);
-  int npout_min = pm->nprtcl_eachrank[0];
-  for (int n=1; n<global_variable::nranks; ++n) {
-    rank_offset[n] = rank_offset[n-1] + pm->nprtcl_eachrank[n-1];
-    npout_min = std::min(npout_min, pm->nprtcl_eachrank[n]);
+    for (std::size_t i=0; i<ndata; ++i) { Swap4Bytes(&data[i]); }
   }
 
-  // Write particle positions
+  // Write particle positions.  Each rank writes a single contiguous block starting at
+  // offset computed from number of particles on lower ranks.  Collective write is used
+  // even though number of particles differs across ranks, so MPI-IO can aggregate data.
   {
     std::size_t datasize = sizeof(float);
-    std::size_t myoffset=header_offset + 3*rank_offset[global_variable::my_rank]*datasize;
-    // collective writes for minimum number of particles across ranks
-    if (partfile.Write_any_type_at_all(&(data[0]),3*npout_min,myoffset,"float")
-          != 3*npout_min) {
+    std::size_t myoffset = header_offset + 3*npout_offset*datasize;
+    if (partfile.Write_any_type_at_all(&(data[0]),3*npout_thisrank,myoffset,"float")
+          != static_cast<std::size_t>(3*npout_thisrank)) {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
           << std::endl << "particle data not written correctly to vtk particle file, "
           << "vtk file is broken." << std::endl;
       exit(EXIT_FAILURE);
     }
-    // individual writes for remaining particles on each rank
-    myoffset += datasize*3*npout_min;
-    int nremain = pm->nprtcl_thisrank - npout_min;
-    if (nremain > 0) {
-      if (partfile.Write_any_type_at(&(data[3*npout_min]),3*nremain,myoffset,"float")
-            != 3*nremain) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-            << std::endl << "particle data not written correctly to vtk particle file, "
-            << "vtk file is broken." << std::endl;
-        exit(EXIT_FAILURE);
-      }
-    }
-    header_offset += 3*pm->nprtcl_total*datasize;
+    header_offset += 3*npout_total*datasize;
   }
 
   // Write Part 6: scalar particle data
@@ -207,48 +196,26 @@ void ParticleVTKOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
 
     header_offset += msg.str().size();
 
-    // Loop over particles, load gid into data[]
-    for (int p=0; p<npout_thisrank; ++p) {
-      data[p] = static_cast<float>(outpart_idata(n,p));
-    }
-    // swap data for this variable into big endian order
-    if (!big_end) {
-      for (int i=0; i<npout_thisrank; ++i) { Swap4Bytes(&data[i]); }
-    }
-
-    // calculate local data offset and write gid
+    // write data for this variable (packed in LoadOutputData, byte-swapped above)
     std::size_t datasize = sizeof(float);
-    std::size_t myoffset=header_offset + rank_offset[global_variable::my_rank]*datasize;
-    // collective writes for minimum number of particles across ranks
-    if (partfile.Write_any_type_at_all(&(data[0]),npout_min,myoffset,"float")
-          != npout_min) {
+    std::size_t myoffset = header_offset + npout_offset*datasize;
+    if (partfile.Write_any_type_at_all(&(data[(3+n)*npout_thisrank]),npout_thisrank,
+                                       myoffset,"float")
+          != static_cast<std::size_t>(npout_thisrank)) {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
           << std::endl << "particle data not written correctly to vtk particle file, "
           << "vtk file is broken." << std::endl;
       exit(EXIT_FAILURE);
     }
-    // individual writes for remaining particles on each rank
-    myoffset += datasize*npout_min;
-    int nremain = pm->nprtcl_thisrank - npout_min;
-    if (nremain > 0) {
-      if (partfile.Write_any_type_at(&(data[npout_min]),nremain,myoffset,"float")
-            != nremain) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-            << std::endl << "particle data not written correctly to vtk particle file, "
-            << "vtk file is broken." << std::endl;
-        exit(EXIT_FAILURE);
-      }
-    }
-    header_offset += pm->nprtcl_total*datasize;
+    header_offset += npout_total*datasize;
   }
 
   // Add output of vectors here with header:
   // VECTORS vectors float
   // [then binary vx,vy,vz data .... ]
 
-  // close the output file and clean up
+  // close the output file
   partfile.Close();
-  delete[] data;
 
   // increment counters
   out_params.file_number++;
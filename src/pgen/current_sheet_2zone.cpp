@@ -230,7 +230,7 @@ void CurrentSheet2ZoneBoundary(Mesh *pm) {
   // ── x1 boundaries ───────────────────────────────────────────────────────────
   // bc_mode 1: diode (outflow copy + clip inward momentum)
   // bc_mode 2 or 3: IC-matching (fill with analytical equilibrium)
-  par_for("current_sheet_2zone_bc_x1", DevExeSpace(), 0,(nmb-1),0,(n3-1),0,(n2-1),
+  par_for("current_sheet_2zone_bc_x1", TaskExeSpace(), 0,(nmb-1),0,(n3-1),0,(n2-1),
   KOKKOS_LAMBDA(int m, int k, int j) {
     int nx1 = indcs.nx1;
     Real &x1min = size.d_view(m).x1min;
@@ -322,7 +322,7 @@ void CurrentSheet2ZoneBoundary(Mesh *pm) {
   // ── x2 boundaries ───────────────────────────────────────────────────────────
   // bc_mode 1 or 3: diode (outflow copy + clip inward y-momentum)
   // bc_mode 2: IC-matching (fill with analytical equilibrium at x1 position)
-  par_for("current_sheet_2zone_bc_x2", DevExeSpace(), 0,(nmb-1),0,(n3-1),0,(n1-1),
+  par_for("current_sheet_2zone_bc_x2", TaskExeSpace(), 0,(nmb-1),0,(n3-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int k, int i) {
     // inner x2 boundary
     if (mb_bcs.d_view(m,BoundaryFace::inner_x2) != BoundaryFlag::block) {
@@ -1128,7 +1128,7 @@ void VacuumBC(Mesh *pm) {
 
   // X1-Boundary
   // Set X1-BCs on b0 if Meshblock face is at the edge of the computational domain.
-  par_for("noinflow_x1", DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),
+  par_for("noinflow_x1", TaskExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),
   KOKKOS_LAMBDA(int m, int k, int j) {
     if (mb_bcs.d_view(m,BoundaryFace::inner_x1) == BoundaryFlag::user) {
       for (int i=0; i<ng; ++i) {
@@ -1176,7 +1176,7 @@ void VacuumBC(Mesh *pm) {
 
   // X2-Boundary
   // Set X2-BCs on b0 if Meshblock face is at the edge of computational domain
-  par_for("noinflow_field_x2", DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n1-1),
+  par_for("noinflow_field_x2", TaskExeSpace(),0,(nmb-1),0,(n3-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int k, int i) {
     if (mb_bcs.d_view(m,BoundaryFace::inner_x2) == BoundaryFlag::user) {
       for (int j=0; j<ng; ++j) {
@@ -1224,7 +1224,7 @@ void VacuumBC(Mesh *pm) {
 
   // X3-Boundary
   // Set X3-BCs on b0 if Meshblock face is at the edge of computational domain
-  par_for("noinflow_field_x3", DevExeSpace(),0,(nmb-1),0,(n2-1),0,(n1-1),
+  par_for("noinflow_field_x3", TaskExeSpace(),0,(nmb-1),0,(n2-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int j, int i) {
     if (mb_bcs.d_view(m,BoundaryFace::inner_x3) == BoundaryFlag::user) {
       for (int k=0; k<ng; ++k) {
@@ -1490,7 +1490,7 @@ void NoInflowTorus(Mesh *pm) {
   // Set X1-BCs on b0 if Meshblock face is at the edge of computational domain
   if (pm->pmb_pack->pmhd != nullptr) {
     auto &b0 = pm->pmb_pack->pmhd->b0;
-    par_for("noinflow_field_x1", DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),
+    par_for("noinflow_field_x1", TaskExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),
     KOKKOS_LAMBDA(int m, int k, int j) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x1) == BoundaryFlag::user) {
         for (int i=0; i<ng; ++i) {
@@ -1524,7 +1524,7 @@ void NoInflowTorus(Mesh *pm) {
     pm->pmb_pack->pmhd->peos->ConsToPrim(u0_,b0,w0_,bcc,false,ie,ie+ng,0,(n2-1),0,(n3-1));
   }
   // Set X1-BCs on w0 if Meshblock face is at the edge of computational domain
-  par_for("noinflow_hydro_x1", DevExeSpace(),0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n2-1),
+  par_for("noinflow_hydro_x1", TaskExeSpace(),0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n2-1),
   KOKKOS_LAMBDA(int m, int n, int k, int j) {
     if (mb_bcs.d_view(m,BoundaryFace::inner_x1) == BoundaryFlag::user) {
       for (int i=0; i<ng; ++i) {
@@ -1547,7 +1547,7 @@ void NoInflowTorus(Mesh *pm) {
   });
   if (is_radiation_enabled) {
     // Set X1-BCs on i0 if Meshblock face is at the edge of computational domain
-    par_for("noinflow_rad_x1", DevExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n2-1),
+    par_for("noinflow_rad_x1", TaskExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n2-1),
     KOKKOS_LAMBDA(int m, int n, int k, int j) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x1) == BoundaryFlag::user) {
         for (int i=0; i<ng; ++i) {
@@ -1575,7 +1575,7 @@ void NoInflowTorus(Mesh *pm) {
   // Set X2-BCs on b0 if Meshblock face is at the edge of computational domain
   if (pm->pmb_pack->pmhd != nullptr) {
     auto &b0 = pm->pmb_pack->pmhd->b0;
-    par_for("noinflow_field_x2", DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n1-1),
+    par_for("noinflow_field_x2", TaskExeSpace(),0,(nmb-1),0,(n3-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int k, int i) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x2) == BoundaryFlag::user) {
         for (int j=0; j<ng; ++j) {
@@ -1609,7 +1609,7 @@ void NoInflowTorus(Mesh *pm) {
     pm->pmb_pack->pmhd->peos->ConsToPrim(u0_,b0,w0_,bcc,false,0,(n1-1),je,je+ng,0,(n3-1));
   }
   // Set X2-BCs on w0 if Meshblock face is at the edge of computational domain
-  par_for("noinflow_hydro_x2", DevExeSpace(),0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n1-1),
+  par_for("noinflow_hydro_x2", TaskExeSpace(),0,(nmb-1),0,(nvar-1),0,(n3-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int n, int k, int i) {
     if (mb_bcs.d_view(m,BoundaryFace::inner_x2) == BoundaryFlag::user) {
       for (int j=0; j<ng; ++j) {
@@ -1632,7 +1632,7 @@ void NoInflowTorus(Mesh *pm) {
   });
   if (is_radiation_enabled) {
     // Set X2-BCs on i0 if Meshblock face is at the edge of computational domain
-    par_for("noinflow_rad_x2", DevExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n1-1),
+    par_for("noinflow_rad_x2", TaskExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int n, int k, int i) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x2) == BoundaryFlag::user) {
         for (int j=0; j<ng; ++j) {
@@ -1660,7 +1660,7 @@ void NoInflowTorus(Mesh *pm) {
   // Set X3-BCs on b0 if Meshblock face is at the edge of computational domain
   if (pm->pmb_pack->pmhd != nullptr) {
     auto &b0 = pm->pmb_pack->pmhd->b0;
-    par_for("noinflow_field_x3", DevExeSpace(),0,(nmb-1),0,(n2-1),0,(n1-1),
+    par_for("noinflow_field_x3", TaskExeSpace(),0,(nmb-1),0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int j, int i) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x3) == BoundaryFlag::user) {
         for (int k=0; k<ng; ++k) {
@@ -1694,7 +1694,7 @@ void NoInflowTorus(Mesh *pm) {
     pm->pmb_pack->pmhd->peos->ConsToPrim(u0_,b0,w0_,bcc,false,0,(n1-1),0,(n2-1),ke,ke+ng);
   }
   // Set X3-BCs on w0 if Meshblock face is at the edge of computational domain
-  par_for("noinflow_hydro_x3", DevExeSpace(),0,(nmb-1),0,(nvar-1),0,(n2-1),0,(n1-1),
+  par_for("noinflow_hydro_x3", TaskExeSpace(),0,(nmb-1),0,(nvar-1),0,(n2-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int n, int j, int i) {
     if (mb_bcs.d_view(m,BoundaryFace::inner_x3) == BoundaryFlag::user) {
       for (int k=0; k<ng; ++k) {
@@ -1717,7 +1717,7 @@ void NoInflowTorus(Mesh *pm) {
   });
   if (is_radiation_enabled) {
     // Set X3-BCs on i0 if Meshblock face is at the edge of computational domain
-    par_for("noinflow_rad_x3", DevExeSpace(),0,(nmb-1),0,nang1,0,(n2-1),0,(n1-1),
+    par_for("noinflow_rad_x3", TaskExeSpace(),0,(nmb-1),0,nang1,0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int n, int j, int i) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x3) == BoundaryFlag::user) {
         for (int k=0; k<ng; ++k) {
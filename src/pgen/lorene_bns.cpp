@@ -154,10 +154,10 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   // TODO(JMF): This needs to be tested on CPUs to ensure that it functions properly;
   // In theory, create_mirror_view shouldn't copy the data unless it's in a different
   // memory space.
-  HostArray5D<Real>::HostMirror host_u_adm = create_mirror_view(u_adm);
-  HostArray5D<Real>::HostMirror host_w0 = create_mirror_view(w0);
-  //HostArray5D<Real>::HostMirror host_u_z4c = create_mirror_view(u_z4c);
-  HostArray5D<Real>::HostMirror host_u_z4c;
+  DvceArray5D<Real>::HostMirror host_u_adm = create_mirror_view(u_adm);
+  DvceArray5D<Real>::HostMirror host_w0 = create_mirror_view(w0);
+  //DvceArray5D<Real>::HostMirror host_u_z4c = create_mirror_view(u_z4c);
+  DvceArray5D<Real>::HostMirror host_u_z4c;
   adm::ADM::ADMhost_vars host_adm;
   if (pmbp->pz4c != nullptr) {
     host_u_z4c = create_mirror_view(pmbp->pz4c->u0);
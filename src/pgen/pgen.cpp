@@ -9,8 +9,11 @@
 //! reads data from restart file, as well as re-initializing problem-specific data.
 
 #include <iostream>
+#include <map>
 #include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 #include <algorithm>
 
 #include "athena.hpp"
@@ -24,6 +27,7 @@
 #include "z4c/compact_object_tracker.hpp"
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
+#include "radiation_m1/radiation_m1.hpp"
 #include "srcterms/turb_driver.hpp"
 #include "pgen.hpp"
 
@@ -60,6 +64,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
     BondiAccretion(pin, false);
   } else if (pgen_fun_name.compare("tetrad") == 0) {
     CheckOrthonormalTetrad(pin, false);
+  } else if (pgen_fun_name.compare("opacity_table") == 0) {
+    CheckOpacityTable(pin, false);
   } else if (pgen_fun_name.compare("hohlraum") == 0) {
     Hohlraum(pin, false);
   } else if (pgen_fun_name.compare("linear_wave") == 0) {
@@ -72,6 +78,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm) :
     OrszagTang(pin, false);
   } else if (pgen_fun_name.compare("rad_linear_wave") == 0) {
     RadiationLinearWave(pin, false);
+  } else if (pgen_fun_name.compare("rad_m1_test") == 0) {
+    RadiationM1Test(pin, false);
   } else if (pgen_fun_name.compare("biermann_gradient") == 0) {
     BiermannGradient(pin, false);
   } else if (pgen_fun_name.compare("shock_tube") == 0) {
@@ -160,8 +168,10 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
   adm::ADM* padm = pm->pmb_pack->padm;
   z4c::Z4c* pz4c = pm->pmb_pack->pz4c;
   radiation::Radiation* prad=pm->pmb_pack->prad;
+  radiation_m1::RadiationM1* prm1=pm->pmb_pack->prm1;
   TurbulenceDriver* pturb=pm->pmb_pack->pturb;
-  int nrad = 0, nhydro = 0, nmhd = 0, nforce = 3, nadm = 0, nz4c = 0;
+  int nrad = 0, nm1 = 0, nhydro = 0, nmhd = 0, nforce = 3, nadm = 0, nz4c = 0;
+  int nmr = 0;
   if (phydro != nullptr) {
     nhydro = phydro->nhydro + phydro->nscalars;
   }
@@ -171,8 +181,14 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
   if (prad != nullptr) {
     nrad = prad->prgeo->nangles;
   }
+  if (prm1 != nullptr) {
+    nm1 = NM1VAR;
+  }
   if (pz4c != nullptr) {
     nz4c = pz4c->nz4c;
+    if (pz4c->mr_nsub > 1) {
+      nmr = 2*(adm::ADM::nadm) + 4;
+    }
   } else if (padm != nullptr) {
     nadm = padm->nadm;
   }
@@ -208,6 +224,25 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
 #endif
       pt.SetPos(&pos[0]);
     }
+
+    // times of the spacetime levels stored for multirate coupling
+    if (pz4c->mr_nsub > 1) {
+      Real mr_state[3];
+      if (global_variable::my_rank == 0) {
+        if (resfile.Read_Reals(&mr_state[0], 3) != 3) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "z4c multirate data size read from restart "
+                    << "file is incorrect, restart file is broken." << std::endl;
+          exit(EXIT_FAILURE);
+        }
+      }
+#if MPI_PARALLEL_ENABLED
+      MPI_Bcast(&mr_state[0], 3*sizeof(Real), MPI_CHAR, 0, MPI_COMM_WORLD);
+#endif
+      pz4c->mr_told = mr_state[0];
+      pz4c->mr_tnew = mr_state[1];
+      pz4c->mr_init = (mr_state[2] != 0.0);
+    }
   }
 
   if (pturb != nullptr) {
@@ -259,36 +294,58 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
   MPI_Bcast(&headeroffset, sizeof(IOWrapperSizeT), MPI_CHAR, 0, MPI_COMM_WORLD);
 #endif
 
+  // with re-blocking, data in restart file is stored for MeshBlocks of different size
+  bool reblock = (pm->rst_reblock != 0);
+  auto &findcs = (reblock)? pm->rst_mb_indcs : indcs;
+  int nfile1 = findcs.nx1 + 2*(findcs.ng);
+  int nfile2 = (findcs.nx2 > 1)? (findcs.nx2 + 2*(findcs.ng)) : 1;
+  int nfile3 = (findcs.nx3 > 1)? (findcs.nx3 + 2*(findcs.ng)) : 1;
   IOWrapperSizeT data_size_ = 0;
   if (phydro != nullptr) {
-    data_size_ += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
+    data_size_ += nfile1*nfile2*nfile3*nhydro*sizeof(Real); // hydro u0
   }
   if (pmhd != nullptr) {
-    data_size_ += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
-    data_size_ += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
-    data_size_ += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
-    data_size_ += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
+    data_size_ += nfile1*nfile2*nfile3*nmhd*sizeof(Real);   // mhd u0
+    data_size_ += (nfile1+1)*nfile2*nfile3*sizeof(Real);    // mhd b0.x1f
+    data_size_ += nfile1*(nfile2+1)*nfile3*sizeof(Real);    // mhd b0.x2f
+    data_size_ += nfile1*nfile2*(nfile3+1)*sizeof(Real);    // mhd b0.x3f
   }
   if (prad != nullptr) {
-    data_size_ += nout1*nout2*nout3*nrad*sizeof(Real);   // rad i0
+    data_size_ += nfile1*nfile2*nfile3*nrad*sizeof(Real);   // rad i0
+  }
+  if (prm1 != nullptr) {
+    data_size_ += nfile1*nfile2*nfile3*nm1*sizeof(Real);    // M1 rad u0
   }
   if (pturb != nullptr) {
-    data_size_ += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
+    data_size_ += nfile1*nfile2*nfile3*nforce*sizeof(Real); // forcing
   }
   if (pz4c != nullptr) {
-    data_size_ += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
+    data_size_ += nfile1*nfile2*nfile3*nz4c*sizeof(Real);   // z4c u0
+    if (pz4c->mr_nsub > 1) {
+      data_size_ += nfile1*nfile2*nfile3*nmr*sizeof(Real);  // z4c multirate levels
+    }
   } else if (padm != nullptr) {
-    data_size_ += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
+    data_size_ += nfile1*nfile2*nfile3*nadm*sizeof(Real);   // adm u_adm
   }
 
   if (data_size_ != data_size) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
               << std::endl << "CC data size read from restart file not equal to size "
-              << "of Hydro, MHD, Rad, and/or Z4c arrays, restart file is broken."
+              << "of Hydro, MHD, Rad, M1, and/or Z4c arrays, restart file is broken."
               << std::endl;
     exit(EXIT_FAILURE);
   }
 
+  if (reblock) {
+    if (pz4c != nullptr || padm != nullptr) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "MeshBlock size cannot be changed on restart with ADM/Z4c"
+                << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    ReadReblockedRestart(resfile, headeroffset, data_size);
+  }
+
   // read CC data into host array
   int mygids = pm->gids_eachrank[global_variable::my_rank];
   IOWrapperSizeT offset_myrank = headeroffset + data_size_*mygids;
@@ -305,7 +362,7 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     noutmbs_min = std::min(noutmbs_min,pm->nmb_eachrank[i]);
   }
 
-  if (phydro != nullptr) {
+  if (phydro != nullptr && !(reblock)) {
     Kokkos::realloc(ccin, nmb, nhydro, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -337,13 +394,13 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(phydro->u0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    deep_copy_layout(Kokkos::subview(phydro->u0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
     offset_myrank += nout1*nout2*nout3*nhydro*sizeof(Real); // hydro u0
     myoffset = offset_myrank;
   }
 
-  if (pmhd != nullptr) {
+  if (pmhd != nullptr && !(reblock)) {
     Kokkos::realloc(ccin, nmb, nmhd, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -374,8 +431,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pmhd->u0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    deep_copy_layout(Kokkos::subview(pmhd->u0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
     offset_myrank += nout1*nout2*nout3*nmhd*sizeof(Real);   // mhd u0
     myoffset = offset_myrank;
 
@@ -463,19 +520,19 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size-(x1fptr.size()+x2fptr.size()+x3fptr.size())*sizeof(Real);
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL), fcin.x1f);
-    Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL), fcin.x2f);
-    Kokkos::deep_copy(Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL), fcin.x3f);
+    deep_copy_layout(Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL), fcin.x1f);
+    deep_copy_layout(Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL), fcin.x2f);
+    deep_copy_layout(Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL), fcin.x3f);
     offset_myrank += (nout1+1)*nout2*nout3*sizeof(Real);    // mhd b0.x1f
     offset_myrank += nout1*(nout2+1)*nout3*sizeof(Real);    // mhd b0.x2f
     offset_myrank += nout1*nout2*(nout3+1)*sizeof(Real);    // mhd b0.x3f
     myoffset = offset_myrank;
   }
 
-  if (prad != nullptr) {
+  if (prad != nullptr && !(reblock)) {
     Kokkos::realloc(ccin, nmb, nrad, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -507,13 +564,51 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(prad->i0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    deep_copy_layout(Kokkos::subview(prad->i0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
     offset_myrank += nout1*nout2*nout3*nrad*sizeof(Real);   // radiation i0
     myoffset = offset_myrank;
   }
 
-  if (pturb != nullptr) {
+  if (prm1 != nullptr && !(reblock)) {
+    Kokkos::realloc(ccin, nmb, nm1, nout3, nout2, nout1);
+    for (int m=0;  m<noutmbs_max; ++m) {
+      // every rank has a MB to read, so read collectively
+      if (m < noutmbs_min) {
+        // get ptr to cell-centered MeshBlock data
+        auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL);
+        int mbcnt = mbptr.size();
+        if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "CC M1 rad data not read correctly from rst file, "
+                    << "restart file is broken." << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        myoffset += data_size;
+
+      // some ranks are finished writing, so use non-collective write
+      } else if (m < pm->nmb_thisrank) {
+        // get ptr to MeshBlock data
+        auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
+                                     Kokkos::ALL);
+        int mbcnt = mbptr.size();
+        if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "CC M1 rad data not read correctly from rst file, "
+                    << "restart file is broken." << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        myoffset += data_size;
+      }
+    }
+    deep_copy_layout(Kokkos::subview(prm1->u0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    offset_myrank += nout1*nout2*nout3*nm1*sizeof(Real);    // radiation M1 u0
+    myoffset = offset_myrank;
+  }
+
+  if (pturb != nullptr && !(reblock)) {
     Kokkos::realloc(ccin, nmb, nforce, nout3, nout2, nout1);
     for (int m=0;  m<noutmbs_max; ++m) {
       // every rank has a MB to read, so read collectively
@@ -545,8 +640,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pturb->force, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    deep_copy_layout(Kokkos::subview(pturb->force, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
     offset_myrank += nout1*nout2*nout3*nforce*sizeof(Real); // forcing
     myoffset = offset_myrank;
   }
@@ -583,11 +678,63 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(pz4c->u0, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    deep_copy_layout(Kokkos::subview(pz4c->u0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
     offset_myrank += nout1*nout2*nout3*nz4c*sizeof(Real);   // z4c u0
     myoffset = offset_myrank;
 
+    if (pz4c->mr_nsub > 1) {
+      Kokkos::realloc(ccin, nmb, nmr, nout3, nout2, nout1);
+      for (int m=0;  m<noutmbs_max; ++m) {
+        // every rank has a MB to read, so read collectively
+        if (m < noutmbs_min) {
+          auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Read_Reals_at_all(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "CC z4c multirate data not read correctly from rst "
+                      << "file, restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
+
+        // some ranks are finished reading, so use non-collective read
+        } else if (m < pm->nmb_thisrank) {
+          auto mbptr = Kokkos::subview(ccin, m, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL,
+                                       Kokkos::ALL);
+          int mbcnt = mbptr.size();
+          if (resfile.Read_Reals_at(mbptr.data(), mbcnt, myoffset) != mbcnt) {
+            std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                      << std::endl << "CC z4c multirate data not read correctly from rst "
+                      << "file, restart file is broken." << std::endl;
+            exit(EXIT_FAILURE);
+          }
+          myoffset += data_size;
+        }
+      }
+      // copy to device, then split into both spacetime levels and the evolved gauge
+      int nadm_ = adm::ADM::nadm;
+      DvceArray5D<Real> mrtmp("rst-mr", nmb, nmr, nout3, nout2, nout1);
+      deep_copy_layout(mrtmp, ccin);
+      Kokkos::deep_copy(Kokkos::subview(pz4c->mr_adm_old, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(mrtmp, Kokkos::ALL, std::make_pair(0,nadm_),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
+      Kokkos::deep_copy(Kokkos::subview(pz4c->mr_adm_new, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(mrtmp, Kokkos::ALL,
+                        std::make_pair(nadm_,2*nadm_), Kokkos::ALL, Kokkos::ALL,
+                        Kokkos::ALL));
+      Kokkos::deep_copy(Kokkos::subview(pz4c->mr_gauge, std::make_pair(0,nmb),
+                        Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL),
+                        Kokkos::subview(mrtmp, Kokkos::ALL,
+                        std::make_pair(2*nadm_,nmr), Kokkos::ALL, Kokkos::ALL,
+                        Kokkos::ALL));
+      offset_myrank += nout1*nout2*nout3*nmr*sizeof(Real);  // z4c multirate levels
+      myoffset = offset_myrank;
+    }
+
     // We also need to reinitialize the ADM data.
     pz4c->Z4cToADM(pmy_mesh_->pmb_pack);
   } else if (padm != nullptr) {
@@ -622,8 +769,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
         myoffset += data_size;
       }
     }
-    Kokkos::deep_copy(Kokkos::subview(padm->u_adm, std::make_pair(0,nmb), Kokkos::ALL,
-                      Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
+    deep_copy_layout(Kokkos::subview(padm->u_adm, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), ccin);
     offset_myrank += nout1*nout2*nout3*nadm*sizeof(Real);   // adm u_adm
     myoffset = offset_myrank;
   }
@@ -642,6 +789,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     BondiAccretion(pin, true);
   } else if (pgen_fun_name.compare("tetrad") == 0) {
     CheckOrthonormalTetrad(pin, true);
+  } else if (pgen_fun_name.compare("opacity_table") == 0) {
+    CheckOpacityTable(pin, true);
   } else if (pgen_fun_name.compare("hohlraum") == 0) {
     Hohlraum(pin, true);
   } else if (pgen_fun_name.compare("linear_wave") == 0) {
@@ -654,6 +803,8 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     OrszagTang(pin, true);
   } else if (pgen_fun_name.compare("rad_linear_wave") == 0) {
     RadiationLinearWave(pin, true);
+  } else if (pgen_fun_name.compare("rad_m1_test") == 0) {
+    RadiationM1Test(pin, true);
   } else if (pgen_fun_name.compare("biermann_gradient") == 0) {
     BiermannGradient(pin, true);
   } else if (pgen_fun_name.compare("shock_tube") == 0) {
@@ -704,3 +855,197 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     }
   }
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void ProblemGenerator::ReadReblockedRestart()
+//! \brief Reads data from restart file when MeshBlocks have been split or merged on
+//! restart (see Mesh::BuildTreeFromRestart()).  Each new MeshBlock on this rank reads the
+//! complete record of every MeshBlock in the file it overlaps, and copies the overlapping
+//! active cells and faces into place.  Ghost zones are filled when the Driver initializes
+//! boundary values.
+
+void ProblemGenerator::ReadReblockedRestart(IOWrapper &resfile,
+                                            IOWrapperSizeT headeroffset,
+                                            IOWrapperSizeT data_size) {
+  Mesh *pm = pmy_mesh_;
+  auto &indcs = pm->mb_indcs;
+  auto &findcs = pm->rst_mb_indcs;
+  int nout1 = indcs.nx1 + 2*(indcs.ng);
+  int nout2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int nout3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nfile1 = findcs.nx1 + 2*(findcs.ng);
+  int nfile2 = (findcs.nx2 > 1)? (findcs.nx2 + 2*(findcs.ng)) : 1;
+  int nfile3 = (findcs.nx3 > 1)? (findcs.nx3 + 2*(findcs.ng)) : 1;
+  int nmb = pm->pmb_pack->nmb_thispack;
+
+  hydro::Hydro* phydro = pm->pmb_pack->phydro;
+  mhd::MHD* pmhd = pm->pmb_pack->pmhd;
+  radiation::Radiation* prad=pm->pmb_pack->prad;
+  radiation_m1::RadiationM1* prm1=pm->pmb_pack->prm1;
+  TurbulenceDriver* pturb=pm->pmb_pack->pturb;
+  int nrad = 0, nm1 = 0, nhydro = 0, nmhd = 0, nforce = 3;
+
+  // host arrays for data on new MeshBlocks
+  HostArray5D<Real> hydin("rst-hyd-in", 1, 1, 1, 1, 1);
+  HostArray5D<Real> mhdin("rst-mhd-in", 1, 1, 1, 1, 1);
+  HostArray5D<Real> radin("rst-rad-in", 1, 1, 1, 1, 1);
+  HostArray5D<Real> rm1in("rst-rm1-in", 1, 1, 1, 1, 1);
+  HostArray5D<Real> frcin("rst-frc-in", 1, 1, 1, 1, 1);
+  HostFaceFld4D<Real> fcin("rst-fc-in", 1, 1, 1, 1);
+  if (phydro != nullptr) {
+    nhydro = phydro->nhydro + phydro->nscalars;
+    Kokkos::realloc(hydin, nmb, nhydro, nout3, nout2, nout1);
+  }
+  if (pmhd != nullptr) {
+    nmhd = pmhd->nmhd + pmhd->nscalars;
+    Kokkos::realloc(mhdin, nmb, nmhd, nout3, nout2, nout1);
+    Kokkos::realloc(fcin.x1f, nmb, nout3, nout2, nout1+1);
+    Kokkos::realloc(fcin.x2f, nmb, nout3, nout2+1, nout1);
+    Kokkos::realloc(fcin.x3f, nmb, nout3+1, nout2, nout1);
+  }
+  if (prad != nullptr) {
+    nrad = prad->prgeo->nangles;
+    Kokkos::realloc(radin, nmb, nrad, nout3, nout2, nout1);
+  }
+  if (prm1 != nullptr) {
+    nm1 = NM1VAR;
+    Kokkos::realloc(rm1in, nmb, nm1, nout3, nout2, nout1);
+  }
+  if (pturb != nullptr) {
+    Kokkos::realloc(frcin, nmb, nforce, nout3, nout2, nout1);
+  }
+
+  // map from LogicalLocation of MeshBlocks in restart file to their gid in file
+  std::map<std::tuple<int,int,int,int>, int> file_gid;
+  for (int g=0; g<static_cast<int>(pm->rst_lloc_eachmb.size()); ++g) {
+    auto &ll = pm->rst_lloc_eachmb[g];
+    file_gid[std::make_tuple(ll.level, ll.lx3, ll.lx2, ll.lx1)] = g;
+  }
+
+  // buffer for complete record of one MeshBlock in restart file
+  IOWrapperSizeT nreal = data_size/sizeof(Real);
+  std::vector<Real> rbuf(nreal);
+  int last_gid = -1;
+
+  int r = pm->rst_reblock;
+  int nsrc1 = (r < 0)? (1 << (-r)) : 1;  // number of MBs in file merged in each dir
+  int nsrc2 = (pm->multi_d)? nsrc1 : 1;
+  int nsrc3 = (pm->three_d)? nsrc1 : 1;
+  int gids = pm->gids_eachrank[global_variable::my_rank];
+  for (int m=0; m<nmb; ++m) {
+    LogicalLocation &lloc = pm->lloc_eachmb[gids + m];
+    for (int q=0; q<nsrc1*nsrc2*nsrc3; ++q) {
+      int q1 = q%nsrc1;
+      int q2 = (q/nsrc1)%nsrc2;
+      int q3 = q/(nsrc1*nsrc2);
+      // find MB in file, range of its active cells to copy (counted from first active
+      // cell), and offset of those cells in new MB
+      LogicalLocation floc;
+      int il, iu, jl, ju, kl, ku, off1, off2, off3;
+      if (r > 0) {
+        int sub = (1 << r) - 1;
+        floc.lx1 = lloc.lx1 >> r;
+        floc.lx2 = lloc.lx2 >> r;
+        floc.lx3 = lloc.lx3 >> r;
+        floc.level = lloc.level - r;
+        il = (lloc.lx1 & sub)*indcs.nx1;  iu = il + indcs.nx1 - 1;
+        jl = (lloc.lx2 & sub)*indcs.nx2;  ju = jl + indcs.nx2 - 1;
+        kl = (lloc.lx3 & sub)*indcs.nx3;  ku = kl + indcs.nx3 - 1;
+        off1 = -il;
+        off2 = -jl;
+        off3 = -kl;
+      } else {
+        int s = -r;
+        floc.lx1 = (lloc.lx1 << s) + q1;
+        floc.lx2 = (lloc.lx2 << s) + q2;
+        floc.lx3 = (lloc.lx3 << s) + q3;
+        floc.level = lloc.level + s;
+        il = 0;  iu = findcs.nx1 - 1;
+        jl = 0;  ju = findcs.nx2 - 1;
+        kl = 0;  ku = findcs.nx3 - 1;
+        off1 = q1*findcs.nx1;
+        off2 = q2*findcs.nx2;
+        off3 = q3*findcs.nx3;
+      }
+      int g = file_gid.at(std::make_tuple(floc.level, floc.lx3, floc.lx2, floc.lx1));
+      if (g != last_gid) {
+        IOWrapperSizeT offset = headeroffset + g*data_size;
+        if (resfile.Read_Reals_at(rbuf.data(), nreal, offset) != nreal) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "MeshBlock data not read correctly from rst file, "
+                    << "restart file is broken." << std::endl;
+          exit(EXIT_FAILURE);
+        }
+        last_gid = g;
+      }
+
+      // copy data in same order as stored in restart file
+      std::size_t pos = 0;
+      auto copy_cc = [&](HostArray5D<Real> &a, int nvar) {
+        for (int n=0; n<nvar; ++n) {
+          for (int k=kl; k<=ku; ++k) {
+            for (int j=jl; j<=ju; ++j) {
+              for (int i=il; i<=iu; ++i) {
+                a(m,n,indcs.ks+k+off3,indcs.js+j+off2,indcs.is+i+off1) =
+                  rbuf[pos + ((n*nfile3 + findcs.ks+k)*nfile2 + findcs.js+j)*nfile1
+                           + findcs.is+i];
+              }
+            }
+          }
+        }
+        pos += static_cast<std::size_t>(nvar)*nfile3*nfile2*nfile1;
+      };
+      auto copy_fc = [&](HostArray4D<Real> &a, int e1, int e2, int e3) {
+        for (int k=kl; k<=ku+e3; ++k) {
+          for (int j=jl; j<=ju+e2; ++j) {
+            for (int i=il; i<=iu+e1; ++i) {
+              a(m,indcs.ks+k+off3,indcs.js+j+off2,indcs.is+i+off1) =
+                rbuf[pos + ((findcs.ks+k)*(nfile2+e2) + findcs.js+j)*(nfile1+e1)
+                         + findcs.is+i];
+            }
+          }
+        }
+        pos += static_cast<std::size_t>(nfile3+e3)*(nfile2+e2)*(nfile1+e1);
+      };
+      if (phydro != nullptr) {copy_cc(hydin, nhydro);}
+      if (pmhd != nullptr) {
+        copy_cc(mhdin, nmhd);
+        copy_fc(fcin.x1f, 1, 0, 0);
+        copy_fc(fcin.x2f, 0, 1, 0);
+        copy_fc(fcin.x3f, 0, 0, 1);
+      }
+      if (prad != nullptr) {copy_cc(radin, nrad);}
+      if (prm1 != nullptr) {copy_cc(rm1in, nm1);}
+      if (pturb != nullptr) {copy_cc(frcin, nforce);}
+    }
+  }
+
+  // copy host arrays to device
+  if (phydro != nullptr) {
+    deep_copy_layout(Kokkos::subview(phydro->u0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), hydin);
+  }
+  if (pmhd != nullptr) {
+    deep_copy_layout(Kokkos::subview(pmhd->u0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), mhdin);
+    deep_copy_layout(Kokkos::subview(pmhd->b0.x1f, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL), fcin.x1f);
+    deep_copy_layout(Kokkos::subview(pmhd->b0.x2f, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL), fcin.x2f);
+    deep_copy_layout(Kokkos::subview(pmhd->b0.x3f, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL), fcin.x3f);
+  }
+  if (prad != nullptr) {
+    deep_copy_layout(Kokkos::subview(prad->i0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), radin);
+  }
+  if (prm1 != nullptr) {
+    deep_copy_layout(Kokkos::subview(prm1->u0, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), rm1in);
+  }
+  if (pturb != nullptr) {
+    deep_copy_layout(Kokkos::subview(pturb->force, std::make_pair(0,nmb), Kokkos::ALL,
+                     Kokkos::ALL, Kokkos::ALL, Kokkos::ALL), frcin);
+  }
+  return;
+}
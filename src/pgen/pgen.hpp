@@ -19,6 +19,7 @@ using ProblemFinalizeFnPtr = void (*)(ParameterInput *pin, Mesh *pm);
 using UserBoundaryFnPtr = void (*)(Mesh* pm);
 using UserSrctermFnPtr = void (*)(Mesh* pm, const Real bdt);
 using UserRefinementFnPtr = void (*)(MeshBlockPack* pmbp);
+using UserActivityFnPtr = void (*)(MeshBlockPack* pmbp);
 using UserHistoryFnPtr = void (*)(HistoryData *pdata, Mesh *pm);
 
 //----------------------------------------------------------------------------------------
@@ -51,6 +52,10 @@ class ProblemGenerator {
   UserBoundaryFnPtr user_bcs_func=nullptr;
   UserSrctermFnPtr user_srcs_func=nullptr;
   UserRefinementFnPtr user_ref_func=nullptr;
+  // function pointer for user-enrolled criteria to freeze MeshBlocks.  Called by
+  // MeshActivity::UpdateActivity() with all MBs active, and sets mb_activity.d_view(m)=0
+  // for MeshBlocks to be frozen
+  UserActivityFnPtr user_activity_func=nullptr;
   UserHistoryFnPtr user_hist_func=nullptr;
 
   // predefined problem generator functions (default test suite)
@@ -58,6 +63,7 @@ class ProblemGenerator {
   void AlfvenWave(ParameterInput *pin, const bool restart);
   void BondiAccretion(ParameterInput *pin, const bool restart);
   void CheckOrthonormalTetrad(ParameterInput *pin, const bool restart);
+  void CheckOpacityTable(ParameterInput *pin, const bool restart);
   void Hohlraum(ParameterInput *pin, const bool restart);
   void LinearWave(ParameterInput *pin, const bool restart);
   void LWImplode(ParameterInput *pin, const bool restart);
@@ -65,6 +71,7 @@ class ProblemGenerator {
   void OrszagTang(ParameterInput *pin, const bool restart);
   void ShockTube(ParameterInput *pin, const bool restart);
   void RadiationLinearWave(ParameterInput *pin, const bool restart);
+  void RadiationM1Test(ParameterInput *pin, const bool restart);
   void BiermannGradient(ParameterInput *pin, const bool restart);
   void Z4cLinearWave(ParameterInput *pin, const bool restart);
   void SphericalCollapse(ParameterInput *pin, const bool restart);
@@ -76,6 +83,8 @@ class ProblemGenerator {
 
  private:
   Mesh* pmy_mesh_;
+  void ReadReblockedRestart(IOWrapper &resfile, IOWrapperSizeT headeroffset,
+                            IOWrapperSizeT data_size);
 };
 
 #endif // PGEN_PGEN_HPP_
@@ -159,7 +159,7 @@ void ZeroIntensity(Mesh *pm) {
   // X1-Boundary
   if (is_radiation_enabled_) {
     // Set X1-BCs on i0 if Meshblock face is at the edge of computational domain
-    par_for("noinflow_rad_x1", DevExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n2-1),
+    par_for("noinflow_rad_x1", TaskExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n2-1),
     KOKKOS_LAMBDA(int m, int n, int k, int j) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x1) == BoundaryFlag::user) {
         for (int i=0; i<ng; ++i) {
@@ -177,7 +177,7 @@ void ZeroIntensity(Mesh *pm) {
   // X2-Boundary
   if (is_radiation_enabled_) {
     // Set X2-BCs on i0 if Meshblock face is at the edge of computational domain
-    par_for("noinflow_rad_x2", DevExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n1-1),
+    par_for("noinflow_rad_x2", TaskExeSpace(),0,(nmb-1),0,nang1,0,(n3-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int n, int k, int i) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x2) == BoundaryFlag::user) {
         for (int j=0; j<ng; ++j) {
@@ -195,7 +195,7 @@ void ZeroIntensity(Mesh *pm) {
   // x3-Boundary
   if (is_radiation_enabled_) {
     // Set x3-BCs on i0 if Meshblock face is at the edge of computational domain
-    par_for("noinflow_rad_x3", DevExeSpace(),0,(nmb-1),0,nang1,0,(n2-1),0,(n1-1),
+    par_for("noinflow_rad_x3", TaskExeSpace(),0,(nmb-1),0,nang1,0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int n, int j, int i) {
       if (mb_bcs.d_view(m,BoundaryFace::inner_x3) == BoundaryFlag::user) {
         for (int k=0; k<ng; ++k) {
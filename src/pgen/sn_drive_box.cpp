@@ -73,7 +73,7 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   Real ekin = 0.5*rho0*(SQR(vx0) + SQR(vy0) + SQR(vz0));
   Real etot = eint + ekin;
 
-  par_for("pgen_sn_drive_box", DevExeSpace(), 0, (pmbp->nmb_thispack - 1), ks, ke, js, je,
+  par_for("pgen_sn_drive_box", DevExeSpace(), 0, (pmbp->nmb_thispack-1), ks, ke, js, je,
   is, ie, KOKKOS_LAMBDA(int m, int k, int j, int i) {
     u0(m, IDN, k, j, i) = rho0;
     u0(m, IM1, k, j, i) = m1;
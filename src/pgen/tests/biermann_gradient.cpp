@@ -45,7 +45,7 @@ void BiermannGradientSourceTerms(Mesh *pm, const Real bdt) {
   Real fx1 = g_biermann_force_x1;
   Real fx2 = g_biermann_force_x2;
 
-  par_for("biermann_balance_src", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  par_for("biermann_balance_src", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     u0(m,IM1,k,j,i) += bdt*fx1;
     u0(m,IM2,k,j,i) += bdt*fx2;
@@ -290,7 +290,7 @@ void GaussianProfile(Mesh *pm) {
   auto d0_=dv.d0, amp_=dv.amp, x10_=dv.x10;
   Real t1 = dv.t0 + pm->time;
 
-  par_for("diffusion_x1", DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),
+  par_for("diffusion_x1", TaskExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),
   KOKKOS_LAMBDA(int m, int k, int j) {
     if (mb_bcs.d_view(m,BoundaryFace::inner_x1) == BoundaryFlag::user) {
       for (int i=0; i<ng; ++i) {
@@ -0,0 +1,91 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file rad_check_opacity.cpp
+//  \brief Unit test of loading and interpolation of tabulated opacities
+
+// C++ headers
+#include <iomanip>
+#include <iostream>
+
+// Athena++ headers
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "radiation/radiation.hpp"
+#include "radiation/radiation_opacities.hpp"
+#include "pgen/pgen.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn void ProblemGenerator::CheckOpacityTable()
+//  \brief Interpolates the opacity table loaded by Radiation on the device, at every
+//  table entry, halfway between entries, and up to one entry beyond the edges of the
+//  table.  Values are printed on rank 0 in lines of the form
+//    opacity_check n log10(rho) log10(T) log10(kappa_n)
+//  for comparison with the table by the regression test.  Sets a uniform fluid at rest.
+
+void ProblemGenerator::CheckOpacityTable(ParameterInput *pin, const bool restart) {
+  if (restart) return;
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  if (pmbp->prad == nullptr || !(pmbp->prad->table_opacity)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Opacity table test requires <radiation> block with "
+              << "opacity_table" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // interpolate table at half-spacing, extending one entry beyond each edge
+  auto &tab = pmbp->prad->opacity_tab;
+  int nr = 2*tab.nrho + 3;
+  int nt = 2*tab.ntemp + 3;
+  DvceArray3D<Real> logk("opacity_check", 3, nt, nr);
+  par_for("check_opacity",DevExeSpace(),0,2,0,(nt-1),0,(nr-1),
+  KOKKOS_LAMBDA(int n, int j, int i) {
+    Real logrho = tab.logrho_min + 0.5*static_cast<Real>(i - 2)*tab.dlogrho;
+    Real logt = tab.logt_min + 0.5*static_cast<Real>(j - 2)*tab.dlogt;
+    logk(n,j,i) = InterpolateOpacityTable(tab, n, logrho, logt);
+  });
+  auto logk_h = Kokkos::create_mirror_view_and_copy(HostMemSpace(), logk);
+
+  if (global_variable::my_rank == 0) {
+    std::cout << std::setprecision(17);
+    for (int n=0; n<3; ++n) {
+      for (int j=0; j<nt; ++j) {
+        for (int i=0; i<nr; ++i) {
+          std::cout << "opacity_check " << n << " "
+                    << tab.logrho_min + 0.5*static_cast<Real>(i - 2)*tab.dlogrho << " "
+                    << tab.logt_min + 0.5*static_cast<Real>(j - 2)*tab.dlogt << " "
+                    << logk_h(n,j,i) << std::endl;
+        }
+      }
+    }
+    std::cout << std::setprecision(6);
+  }
+
+  // uniform fluid at rest, with no radiation
+  auto &indcs = pmy_mesh_->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1) ? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1) ? (indcs.nx3 + 2*ng) : 1;
+  int nmb1 = (pmbp->nmb_thispack-1);
+  auto &w0 = pmbp->phydro->w0;
+  par_for("pgen_opacity",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    w0(m,IDN,k,j,i) = 1.0;
+    w0(m,IVX,k,j,i) = 0.0;
+    w0(m,IVY,k,j,i) = 0.0;
+    w0(m,IVZ,k,j,i) = 0.0;
+    w0(m,IEN,k,j,i) = 1.0;
+  });
+  auto &u0 = pmbp->phydro->u0;
+  pmbp->phydro->peos->PrimToCons(w0, u0, 0, (n1-1), 0, (n2-1), 0, (n3-1));
+  Kokkos::deep_copy(pmbp->prad->i0, 0.0);
+
+  return;
+}
@@ -0,0 +1,280 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file rad_m1.cpp
+//! \brief Problem generator for 1D tests of the grey M1 radiation module in the two
+//! limits of the moment equations.  With test=streaming a Gaussian pulse of radiation
+//! with F=E (f=1) propagates in the x1-direction at the speed of light (c=1) through
+//! vacuum.  With test=diffusion a Gaussian pulse diffuses through a static, purely
+//! scattering medium with diffusion coefficient D=1/(3 rho kappa_s).  Both problems have
+//! analytic solutions, and L1 errors are computed in Driver::Finalize().
+
+// C++ headers
+#include <cmath>      // sqrt()
+#include <cstdio>     // fopen(), fprintf(), freopen()
+#include <iostream>   // endl
+#include <sstream>    // stringstream
+#include <string>     // c_str()
+
+// Athena++ headers
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+#include "pgen/pgen.hpp"
+
+// function to compute errors in solution at end of run
+void RadiationM1Errors(ParameterInput *pin, Mesh *pm);
+
+namespace {
+// global variable to control computation of initial conditions versus errors
+bool set_initial_conditions = true;
+
+//----------------------------------------------------------------------------------------
+//! \struct RadM1TestVariables
+//  \brief container for variables shared with error function
+
+struct RadM1TestVariables {
+  bool diffusion;       // true for diffusion test, false for streaming test
+  Real amp, e_bg;       // amplitude of pulse, background radiation energy density
+  Real width, x10;      // initial width and center of pulse
+  Real d0, p0;          // density and pressure of gas (diffusion test only)
+  Real diff, t0;        // diffusion coefficient, time pulse has diffused for at t=0
+};
+
+RadM1TestVariables rm1;
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void ProblemGenerator::RadiationM1Test()
+//! \brief Sets initial conditions for M1 streaming and diffusion tests
+
+void ProblemGenerator::RadiationM1Test(ParameterInput *pin, const bool restart) {
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  if (pmbp->prm1 == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "M1 radiation test requires a <radiation_m1> block in input file"
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // Read problem parameters.  Needed on restarts to compute errors at end of run.
+  std::string test = pin->GetOrAddString("problem", "test", "streaming");
+  if (test.compare("streaming") == 0) {
+    rm1.diffusion = false;
+  } else if (test.compare("diffusion") == 0) {
+    rm1.diffusion = true;
+  } else {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<problem> test = '" << test << "' not implemented" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  rm1.amp = pin->GetOrAddReal("problem", "amp", 1.0);
+  rm1.e_bg = pin->GetOrAddReal("problem", "e_bg", 1.0e-4);
+  rm1.width = pin->GetOrAddReal("problem", "width", 0.1);
+  rm1.x10 = pin->GetOrAddReal("problem", "x10", 0.0);
+  rm1.d0 = 1.0;
+  rm1.p0 = 1.0;
+  rm1.diff = 0.0;
+  rm1.t0 = 0.0;
+  if (rm1.diffusion) {
+    if (pmbp->phydro == nullptr || !(pmbp->prm1->fixed_fluid) ||
+        pmbp->prm1->kappa_s <= 0.0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "M1 diffusion test requires <hydro> with "
+                << "fixed_fluid=true and kappa_s>0 in <radiation_m1>" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    rm1.d0 = pin->GetOrAddReal("problem", "d0", 1.0);
+    rm1.p0 = pin->GetOrAddReal("problem", "p0", 1.0);
+    rm1.diff = 1.0/(3.0*rm1.d0*pmbp->prm1->kappa_s);
+    // Gaussian of width w is a diffusion profile at time t0 = w^2/(2D) after a delta fn
+    rm1.t0 = SQR(rm1.width)/(2.0*rm1.diff);
+  }
+
+  pgen_final_func = RadiationM1Errors;
+  if (restart) return;
+
+  // capture variables for the kernel
+  auto &indcs = pmy_mesh_->mb_indcs;
+  int &is = indcs.is; int &ie = indcs.ie;
+  int &js = indcs.js; int &je = indcs.je;
+  int &ks = indcs.ks; int &ke = indcs.ke;
+  int nx1 = indcs.nx1;
+  auto &size = pmbp->pmb->mb_size;
+  Real lx1 = pmy_mesh_->mesh_size.x1max - pmy_mesh_->mesh_size.x1min;
+  Real tcur = (set_initial_conditions)? 0.0 : pmy_mesh_->time;
+  auto rm1_ = rm1;
+
+  // compute solution in u1 register. For initial conditions, set u1 -> u0.
+  auto &r1 = (set_initial_conditions)? pmbp->prm1->u0 : pmbp->prm1->u1;
+  par_for("pgen_m1", DevExeSpace(), 0, (pmbp->nmb_thispack-1), ks, ke, js, je, is, ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    Real x1v = CellCenterX(i-is, nx1, x1min, x1max);
+
+    if (rm1_.diffusion) {
+      Real t1 = rm1_.t0 + tcur;
+      Real x = x1v - rm1_.x10;
+      Real g = rm1_.amp*sqrt(rm1_.t0/t1)*exp(-SQR(x)/(4.0*rm1_.diff*t1));
+      r1(m,IER,k,j,i) = rm1_.e_bg + g;
+      r1(m,IFX,k,j,i) = x*g/(2.0*t1);    // F = -D dE/dx
+    } else {
+      // distance from center of pulse, wrapped into periodic domain
+      Real x = x1v - rm1_.x10 - tcur;
+      x -= lx1*round(x/lx1);
+      Real e = rm1_.e_bg + rm1_.amp*exp(-SQR(x)/(2.0*SQR(rm1_.width)));
+      r1(m,IER,k,j,i) = e;
+      r1(m,IFX,k,j,i) = e;
+    }
+    r1(m,IFY,k,j,i) = 0.0;
+    r1(m,IFZ,k,j,i) = 0.0;
+  });
+
+  // static background gas for diffusion test
+  if (pmbp->phydro != nullptr && set_initial_conditions) {
+    Real gm1 = pmbp->phydro->peos->eos_data.gamma - 1.0;
+    auto &u0 = pmbp->phydro->u0;
+    par_for("pgen_m1_gas", DevExeSpace(), 0, (pmbp->nmb_thispack-1), ks, ke, js, je,
+    is, ie, KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      u0(m,IDN,k,j,i) = rm1_.d0;
+      u0(m,IM1,k,j,i) = 0.0;
+      u0(m,IM2,k,j,i) = 0.0;
+      u0(m,IM3,k,j,i) = 0.0;
+      u0(m,IEN,k,j,i) = rm1_.p0/gm1;
+    });
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RadiationM1Errors()
+//! \brief Computes L1 errors in radiation energy density and flux by calling the problem
+//! generator again to compute the analytic solution at the current time in the second
+//! register, and outputs errors to file.
+
+void RadiationM1Errors(ParameterInput *pin, Mesh *pm) {
+  set_initial_conditions = false;
+  pm->pgen->RadiationM1Test(pin, false);
+
+  Real l1_err[NM1VAR];
+  Real linfty_err=0.0;
+  int nvars = NM1VAR;
+
+  // capture class variables for kernel
+  auto &indcs = pm->mb_indcs;
+  int &nx1 = indcs.nx1;
+  int &nx2 = indcs.nx2;
+  int &nx3 = indcs.nx3;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
+  MeshBlockPack *pmbp = pm->pmb_pack;
+  auto &size = pmbp->pmb->mb_size;
+  auto &u0_ = pmbp->prm1->u0;
+  auto &u1_ = pmbp->prm1->u1;
+
+  const int nmkji = (pmbp->nmb_thispack)*nx3*nx2*nx1;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
+  array_sum::GlobalSum sum_this_mb;
+  Kokkos::parallel_reduce("M1-err",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, array_sum::GlobalSum &mb_sum, Real &max_err) {
+    // compute n,k,j,i indices of thread
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/nx1;
+    int i = (idx - m*nkji - k*nji - j*nx1) + is;
+    k += ks;
+    j += js;
+
+    Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
+
+    array_sum::GlobalSum evars;
+    for (int n=0; n<nvars; ++n) {
+      evars.the_array[n] = vol*fabs(u0_(m,n,k,j,i) - u1_(m,n,k,j,i));
+      max_err = fmax(max_err, evars.the_array[n]);
+    }
+
+    // fill rest of the_array with zeros, if narray < NREDUCTION_VARIABLES
+    for (int n=nvars; n<NREDUCTION_VARIABLES; ++n) {
+      evars.the_array[n] = 0.0;
+    }
+
+    // sum into parallel reduce
+    mb_sum += evars;
+  }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_mb), Kokkos::Max<Real>(linfty_err));
+
+  // store data into l1_err array
+  for (int n=0; n<nvars; ++n) {
+    l1_err[n] = sum_this_mb.the_array[n];
+  }
+
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &l1_err, nvars, MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &linfty_err, 1, MPI_ATHENA_REAL, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  // normalize errors by volume of domain
+  Real vol=  (pmbp->pmesh->mesh_size.x1max - pmbp->pmesh->mesh_size.x1min)
+            *(pmbp->pmesh->mesh_size.x2max - pmbp->pmesh->mesh_size.x2min)
+            *(pmbp->pmesh->mesh_size.x3max - pmbp->pmesh->mesh_size.x3min);
+  for (int i=0; i<nvars; ++i) l1_err[i] = l1_err[i]/vol;
+  linfty_err /= vol;
+
+  // compute rms error
+  Real rms_err = 0.0;
+  for (int i=0; i<nvars; ++i) {
+    rms_err += SQR(l1_err[i]);
+  }
+  rms_err = std::sqrt(rms_err);
+
+  // root process opens output file and writes out errors
+  if (global_variable::my_rank == 0) {
+    std::string fname;
+    fname.assign(pin->GetString("job","basename"));
+    fname.append("-errs.dat");
+    FILE *pfile;
+
+    // The file exists -- reopen the file in append mode
+    if ((pfile = std::fopen(fname.c_str(), "r")) != nullptr) {
+      if ((pfile = std::freopen(fname.c_str(), "a", pfile)) == nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Error output file could not be opened" <<std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+
+    // The file does not exist -- open the file in write mode and add headers
+    } else {
+      if ((pfile = std::fopen(fname.c_str(), "w")) == nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Error output file could not be opened" <<std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      std::fprintf(pfile, "# Nx1  Nx2  Nx3   Ncycle  RMS-L1    L-infty       ");
+      std::fprintf(pfile,"E_L1         F1_L1         F2_L1         F3_L1");
+      std::fprintf(pfile, "\n");
+    }
+
+    // write errors
+    std::fprintf(pfile, "%04d", pmbp->pmesh->mesh_indcs.nx1);
+    std::fprintf(pfile, "  %04d", pmbp->pmesh->mesh_indcs.nx2);
+    std::fprintf(pfile, "  %04d", pmbp->pmesh->mesh_indcs.nx3);
+    std::fprintf(pfile, "  %05d  %e %e", pmbp->pmesh->ncycle, rms_err, linfty_err);
+    for (int i=0; i<nvars; ++i) {
+      std::fprintf(pfile, "  %e", l1_err[i]);
+    }
+    std::fprintf(pfile, "\n");
+    std::fclose(pfile);
+  }
+
+  return;
+}
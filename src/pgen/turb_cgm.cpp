@@ -293,7 +293,7 @@ void TcgPreparePlaneAverages(Mesh *pm) {
 
   Kokkos::deep_copy(plane_sums, 0.0);
   Kokkos::parallel_for("turb_cgm_plane_sums",
-      Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+      Kokkos::RangePolicy<>(TaskExeSpace(),0,nmkji),
   KOKKOS_LAMBDA(const int &idx) {
     int m = idx/nkji;
     int k = (idx - m*nkji)/nji;
@@ -398,7 +398,7 @@ void TcgSourceTerms(Mesh *pm, const Real bdt) {
   auto plane_balance = tcg_plane_balance->d_view;
 
   array_sum::GlobalSum applied_sum;
-  Kokkos::parallel_reduce("turb_cgm_src", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("turb_cgm_src", Kokkos::RangePolicy<>(TaskExeSpace(),0,nmkji),
   KOKKOS_LAMBDA(const int &idx, array_sum::GlobalSum &mb_sum) {
     int m = idx/nkji;
     int k = (idx - m*nkji)/nji;
@@ -550,7 +550,7 @@ void TcgHistory(HistoryData *pdata, Mesh *pm) {
   const Real dx3_mesh = pm->mesh_size.dx3;
   auto plane_balance = tcg_plane_balance->d_view;
   array_sum::GlobalSum sum;
-  Kokkos::parallel_reduce("turb_cgm_hist", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("turb_cgm_hist", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
   KOKKOS_LAMBDA(const int &idx, array_sum::GlobalSum &mb_sum) {
     int m = idx/nkji;
     int k = (idx - m*nkji)/nji;
@@ -655,7 +655,7 @@ void TcgHistory(HistoryData *pdata, Mesh *pm) {
   }
 
   TcgDiagData diag;
-  Kokkos::parallel_reduce("turb_cgm_diag", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("turb_cgm_diag", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
   KOKKOS_LAMBDA(const int &idx, TcgDiagData &mb_diag) {
     int m = idx/nkji;
     int k = (idx - m*nkji)/nji;
@@ -1097,7 +1097,7 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
     const int nkji = nx3*nx2*nx1;
     const int nji = nx2*nx1;
     Kokkos::parallel_for("pgen_turb_cgm_bcc",
-        Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+        Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
     KOKKOS_LAMBDA(const int &idx) {
       int m = idx/nkji;
       int k = (idx - m*nkji)/nji;
@@ -213,7 +213,7 @@ void ADMTwoPunctures(MeshBlockPack *pmbp, ini_data *data) {
   // capture variables for the kernel
   auto &u_adm = pmbp->padm->u_adm;
 
-  HostArray5D<Real>::HostMirror host_u_adm = create_mirror(u_adm);
+  DvceArray5D<Real>::HostMirror host_u_adm = create_mirror(u_adm);
   z4c::Z4c::ADMhost_vars host_adm;
   host_adm.psi4.InitWithShallowSlice(host_u_adm, adm::ADM::I_ADM_PSI4);
   host_adm.g_dd.InitWithShallowSlice(
@@ -41,7 +41,16 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     tet_d3_x3f("tet_d3_x3f",1,1,1,1,1),
     na("na",1,1,1,1,1,1),
     norm_to_tet("norm_to_tet",1,1,1,1,1,1),
-    beam_mask("beam_mask",1,1,1,1,1) {
+    beam_mask("beam_mask",1,1,1,1,1),
+    irhs("irhs",1,1,1,1,1),
+    idmax("idmax",1,1),
+    ang_reduced("ang_reduced",1),
+    ang_group("ang_group",1),
+    ang_is_rep("ang_is_rep",1),
+    ang_rep("ang_rep",1),
+    grp_start("grp_start",1),
+    grp_member("grp_member",1),
+    grp_solid_angles("grp_solid_angles",1) {
   // Check for general relativity
   if (!(pmy_pack->pcoord->is_general_relativistic)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -80,11 +89,24 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   // Set radiation coupling parameters including scattering and absorption opacities,
   // radiation constant, and source term behavior.
   if (rad_source) {
-    kappa_s = pin->GetReal("radiation","kappa_s");
-    power_opacity = pin->GetOrAddBoolean("radiation","power_opacity",false);
-    if (!(power_opacity)) {
-      kappa_a = pin->GetReal("radiation","kappa_a");
-      kappa_p = pin->GetReal("radiation","kappa_p");
+    // tabulated opacities (in cgs units) replace constant and power law opacities
+    table_opacity = pin->DoesParameterExist("radiation","opacity_table");
+    if (table_opacity) {
+      if (!(are_units_enabled)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Tabulated opacities require enabling units" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      power_opacity = false;
+      LoadOpacityTable(pin->GetString("radiation","opacity_table"),
+                       pin->GetOrAddBoolean("radiation","opacity_table_cubic",false));
+    } else {
+      kappa_s = pin->GetReal("radiation","kappa_s");
+      power_opacity = pin->GetOrAddBoolean("radiation","power_opacity",false);
+      if (!(power_opacity)) {
+        kappa_a = pin->GetReal("radiation","kappa_a");
+        kappa_p = pin->GetReal("radiation","kappa_p");
+      }
     }
     is_compton_enabled = pin->GetOrAddBoolean("radiation","compton",false);
     if (is_compton_enabled && !(are_units_enabled)) {
@@ -102,6 +124,17 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     affect_fluid = pin->GetOrAddBoolean("radiation","affect_fluid",true);
   }
 
+  // Reduced speed of light approximation: transport, emission, and absorption of the
+  // radiation field proceed at reduced_c (in units of c), while the feedback on the fluid
+  // is rescaled so that the fluid still sees the full speed of light.
+  reduced_c = pin->GetOrAddReal("radiation","reduced_c",1.0);
+  if (reduced_c <= 0.0 || reduced_c > 1.0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "<radiation>/reduced_c must be in (0,1], but reduced_c="
+      << reduced_c << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // Check for fluid evolution
   fixed_fluid = pin->GetOrAddBoolean("radiation","fixed_fluid",false);
 
@@ -116,6 +149,33 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   n_0_floor = pin->GetOrAddReal("radiation","n_0_floor",0.1);
   prgeo = new GeodesicGrid(nlevel, rotate_geo, angular_fluxes);
 
+  // Setup (optional) reduced angular resolution on selected MeshBlocks
+  InitAngularResolution(pin);
+
+  // Implicit transport removes the light-crossing limit on the timestep, which is then
+  // set to implicit_dt_factor times the light-crossing time of the smallest cell
+  implicit_transport = pin->GetOrAddBoolean("radiation","implicit_transport",false);
+  if (implicit_transport) {
+    implicit_max_iter = pin->GetOrAddInteger("radiation","implicit_max_iter",50);
+    implicit_tol = pin->GetOrAddReal("radiation","implicit_tol",1.0e-8);
+    implicit_dt_factor = pin->GetOrAddReal("radiation","implicit_dt_factor",10.0);
+    implicit_iter = 0;
+    implicit_phase = 0;
+    // TODO(@user): extend implicit transport to SMR and reduced angular resolution
+    if (pmy_pack->pmesh->multilevel || angular_adapt) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "<radiation>/implicit_transport does not yet work with SMR/AMR "
+        << "or angular_adapt" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (implicit_max_iter < 1 || implicit_dt_factor <= 0.0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "<radiation>/implicit_max_iter must be >= 1 and "
+        << "implicit_dt_factor must be > 0" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
   int nmb = ppack->nmb_thispack;
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   {
@@ -133,6 +193,7 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   if (is_hydro_enabled || is_mhd_enabled) {
     Kokkos::realloc(norm_to_tet,nmb,4,4,ncells3,ncells2,ncells1);
   }
+  if (rad_source) {Kokkos::realloc(sigma,nmb,3,ncells3,ncells2,ncells1);}
   }
   SetOrthonormalTetrad();
 
@@ -205,6 +266,10 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     if (angular_fluxes) {
       Kokkos::realloc(divfa,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
     }
+    if (implicit_transport) {
+      Kokkos::realloc(irhs,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+      Kokkos::realloc(idmax,nmb,prgeo->nangles);
+    }
     if (beam_source) {
       Kokkos::realloc(beam_mask,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
     }
@@ -217,6 +282,7 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
 Radiation::~Radiation() {
   delete pbval_i;
   delete prgeo;
+  if (prgeo_reduced != nullptr) {delete prgeo_reduced;}
   if (psrc != nullptr) {delete psrc;}
 }
 
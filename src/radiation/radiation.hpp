@@ -16,6 +16,7 @@
 #include "parameter_input.hpp"
 #include "tasklist/task_list.hpp"
 #include "bvals/bvals.hpp"
+#include "radiation/radiation_opacities.hpp"
 
 // forward declarations
 class EquationOfState;
@@ -74,6 +75,7 @@ struct RadiationTaskIDs {
   TaskID rad_crecv;
   TaskID mhd_crecv;
   TaskID hyd_crecv;
+  TaskID rad_angres;
 };
 
 namespace radiation {
@@ -100,8 +102,21 @@ class Radiation {
   Real kappa_s;             // constant scattering coefficient
   Real kappa_p;             // Planck - Rosseland mean coefficient
   bool power_opacity;       // flag to enable Kramer's law opacity for kappa_a
+  bool table_opacity=false; // flag to enable tabulated opacities
+  OpacityTable opacity_tab; // tabulated opacities (only used if table_opacity)
   bool is_compton_enabled;  // flag to enable/disable compton
 
+  // Reduced speed of light approximation
+  Real reduced_c;           // reduced speed of light (as a fraction of c), <= 1
+
+  // Implicit (backward Euler) transport, see radiation_implicit.cpp
+  bool implicit_transport;  // flag to enable implicit transport
+  int implicit_max_iter;    // maximum number of iterations per stage
+  Real implicit_tol;        // tolerance on relative change in I between iterations
+  Real implicit_dt_factor;  // timestep in units of light-crossing time of smallest cell
+  int implicit_iter;        // current iteration of implicit solve in this stage
+  int implicit_phase;       // phase of iteration: 0=sweep, 1=send, 2=receive ghost zones
+
   // Extra physics (i.e., other srcterms)
   bool beam_source;
   SourceTerms *psrc = nullptr;
@@ -111,6 +126,29 @@ class Radiation {
   bool angular_fluxes;                // flag to enable/disable angular fluxes
   Real n_0_floor;                     // floor on n_0
   GeodesicGrid *prgeo = nullptr;      // pointer to radiation angular mesh
+  void CalculateAngularFluxes();      // sets divfa (if angular_fluxes)
+
+  // Per-MeshBlock angular resolution (see radiation_angres.cpp)
+  bool angular_adapt;                     // flag to enable reduced angular resolution
+  int nlevel_reduced;                     // level of reduced angular mesh
+  int ngroups;                            // number of angles evolved on reduced MBs
+  std::string angres_criterion;           // criterion used to select reduced MBs
+  int angres_max_level;                   // MBs at/below this physical level reduced
+  Real angres_tau;                        // min optical depth per cell on reduced MBs
+  int angres_ncycle;                      // cycles between evaluation of criterion
+  GeodesicGrid *prgeo_reduced = nullptr;  // pointer to reduced angular mesh
+  DualArray1D<int> ang_reduced;           // 1 if MB evolved at reduced resolution
+  DualArray1D<int> ang_group;             // group (reduced angle) of each angle
+  DualArray1D<int> ang_is_rep;            // 1 if angle represents its group
+  DualArray1D<int> ang_rep;               // representative angle of each group
+  DualArray1D<int> grp_start;             // start of members of each group
+  DualArray1D<int> grp_member;            // angles sorted by group
+  DualArray1D<Real> grp_solid_angles;     // total solid angle of each group
+  void InitAngularResolution(ParameterInput *pin);
+  void SelectAngularResolution();
+  void RestrictAngles();
+  void ProlongateAngles();
+  void ProlongateAngleFluxes();
 
   // Tetrad arrays and functions
   DualArray2D<Real> nh_c;             // normal vector computed at face center
@@ -124,6 +162,11 @@ class Radiation {
   DvceArray6D<Real> norm_to_tet;      // used in transform b/w normal frame and tet frame
   void SetOrthonormalTetrad();
 
+  // Opacities
+  void LoadOpacityTable(const std::string &fname, bool cubic);
+  void ComputeOpacities(const DvceArray5D<Real> &w, const int il, const int iu,
+                        const int jl, const int ju, const int kl, const int ku);
+
   // intensity arrays
   DvceArray5D<Real> i0;         // intensities
   DvceArray5D<Real> coarse_i0;  // intensities on 2x coarser grid (for SMR/AMR)
@@ -136,6 +179,9 @@ class Radiation {
   DvceFaceFld5D<Real> iflx;     // spatial fluxes on zone faces
   DvceArray5D<Real> divfa;      // angular flux divergence
   DvceArray5D<bool> beam_mask;  // boolean mask used for beam source term
+  DvceArray5D<Real> sigma;      // comoving sigma_a, sigma_s, sigma_p (rad_source only)
+  DvceArray5D<Real> irhs;       // explicit terms in implicit update (implicit only)
+  DvceArray2D<Real> idmax;      // max change of I in sweep per MB/angle (implicit only)
   Real dtnew;
 
   // reconstruction method
@@ -154,6 +200,7 @@ class Radiation {
   TaskStatus SendFlux(Driver *d, int stage);
   TaskStatus RecvFlux(Driver *d, int stage);
   TaskStatus RKUpdate(Driver *d, int stage);
+  TaskStatus ImplicitUpdate(Driver *d, int stage);
   TaskStatus AddRadiationSourceTerm(Driver *d, int stage);
   TaskStatus RestrictI(Driver *d, int stage);
   TaskStatus SendI(Driver *d, int stage);
@@ -164,6 +211,7 @@ class Radiation {
   // ...in "after_stagen_tl" task list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);
+  TaskStatus UpdateAngularResolution(Driver *d, int stage);
 
  private:
   MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this Radiation
@@ -0,0 +1,391 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_angres.cpp
+//! \brief Functions to evolve selected MeshBlocks with a reduced angular resolution.
+//! Angles of the (fine) geodesic mesh are grouped by the nearest angle of a coarser
+//! geodesic mesh with level nlevel_reduced.  On reduced MeshBlocks only one angle per
+//! group (the "representative") is evolved, and holds the solid-angle weighted mean of
+//! the intensity over its group.  All other angles in the group are filled from the
+//! representative after each stage, so that the intensity array always stores the full
+//! angular resolution and boundary communication, physical BCs, SMR prolongation, and
+//! outputs are unaffected.
+
+#include <float.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "geodesic-grid/geodesic_grid.hpp"
+#include "radiation.hpp"
+
+namespace radiation {
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::InitAngularResolution(ParameterInput *pin)
+//! \brief Parses input parameters for per-MeshBlock angular resolution, and constructs
+//! the map between angles of the fine and reduced geodesic meshes.  Called from the
+//! Radiation constructor after prgeo has been constructed.
+
+void Radiation::InitAngularResolution(ParameterInput *pin) {
+  nlevel_reduced = pin->GetOrAddInteger("radiation","nlevel_reduced",-1);
+  angular_adapt = (nlevel_reduced >= 0);
+  if (!(angular_adapt)) {return;}
+
+  int nlevel = pin->GetInteger("radiation", "nlevel");
+  if (nlevel_reduced >= nlevel) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "<radiation>/nlevel_reduced=" << nlevel_reduced << " must be "
+      << "smaller than <radiation>/nlevel=" << nlevel << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // TODO(@user): extend angular fluxes to MeshBlocks with reduced angular resolution
+  if (angular_fluxes) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Reduced angular resolution (<radiation>/nlevel_reduced) "
+      << "requires <radiation>/angular_fluxes=false" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // criterion used to select MeshBlocks with reduced angular resolution
+  angres_criterion = pin->GetOrAddString("radiation","angres_criterion","level");
+  if (angres_criterion.compare("level") == 0) {
+    angres_max_level = pin->GetOrAddInteger("radiation","angres_max_level",0);
+  } else if (angres_criterion.compare("opacity") == 0) {
+    if (!(rad_source)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "<radiation>/angres_criterion=opacity requires radiation "
+        << "source terms to be enabled" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    angres_tau = pin->GetOrAddReal("radiation","angres_tau",10.0);
+  } else {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "<radiation>/angres_criterion = '" << angres_criterion
+      << "' not implemented" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  angres_ncycle = pin->GetOrAddInteger("radiation","angres_ncycle",0);
+
+  // reduced angular mesh (always constructed without angular fluxes)
+  prgeo_reduced = new GeodesicGrid(nlevel_reduced, rotate_geo, false);
+
+  // group each angle with the nearest angle of the reduced mesh
+  int nang = prgeo->nangles;
+  int nang_r = prgeo_reduced->nangles;
+  auto &pos = prgeo->cart_pos.h_view;
+  auto &pos_r = prgeo_reduced->cart_pos.h_view;
+  std::vector<int> near(nang);
+  std::vector<Real> near_dot(nang);
+  for (int n=0; n<nang; ++n) {
+    near_dot[n] = -(FLT_MAX);
+    for (int c=0; c<nang_r; ++c) {
+      Real dot = pos(n,0)*pos_r(c,0) + pos(n,1)*pos_r(c,1) + pos(n,2)*pos_r(c,2);
+      if (dot > near_dot[n]) {
+        near_dot[n] = dot;
+        near[n] = c;
+      }
+    }
+  }
+
+  // compress to non-empty groups, choosing the angle closest to the center of each
+  // group as its representative
+  std::vector<int> grp_of_coarse(nang_r, -1);
+  std::vector<int> rep;
+  for (int n=0; n<nang; ++n) {
+    int c = near[n];
+    if (grp_of_coarse[c] < 0) {
+      grp_of_coarse[c] = static_cast<int>(rep.size());
+      rep.push_back(n);
+    } else if (near_dot[n] > near_dot[rep[grp_of_coarse[c]]]) {
+      rep[grp_of_coarse[c]] = n;
+    }
+  }
+  ngroups = static_cast<int>(rep.size());
+
+  Kokkos::realloc(ang_group, nang);
+  Kokkos::realloc(ang_is_rep, nang);
+  Kokkos::realloc(ang_rep, ngroups);
+  Kokkos::realloc(grp_start, ngroups+1);
+  Kokkos::realloc(grp_member, nang);
+  Kokkos::realloc(grp_solid_angles, ngroups);
+  for (int n=0; n<nang; ++n) {
+    ang_group.h_view(n) = grp_of_coarse[near[n]];
+    ang_is_rep.h_view(n) = 0;
+  }
+  for (int g=0; g<ngroups; ++g) {
+    ang_rep.h_view(g) = rep[g];
+    ang_is_rep.h_view(rep[g]) = 1;
+    grp_solid_angles.h_view(g) = 0.0;
+  }
+
+  // CSR list of members of each group, and total solid angle of each group
+  std::vector<int> count(ngroups, 0);
+  for (int n=0; n<nang; ++n) {count[ang_group.h_view(n)] += 1;}
+  grp_start.h_view(0) = 0;
+  for (int g=0; g<ngroups; ++g) {
+    grp_start.h_view(g+1) = grp_start.h_view(g) + count[g];
+    count[g] = grp_start.h_view(g);
+  }
+  for (int n=0; n<nang; ++n) {
+    int g = ang_group.h_view(n);
+    grp_member.h_view(count[g]++) = n;
+    grp_solid_angles.h_view(g) += prgeo->solid_angles.h_view(n);
+  }
+
+  ang_group.template modify<HostMemSpace>();
+  ang_group.template sync<DevExeSpace>();
+  ang_is_rep.template modify<HostMemSpace>();
+  ang_is_rep.template sync<DevExeSpace>();
+  ang_rep.template modify<HostMemSpace>();
+  ang_rep.template sync<DevExeSpace>();
+  grp_start.template modify<HostMemSpace>();
+  grp_start.template sync<DevExeSpace>();
+  grp_member.template modify<HostMemSpace>();
+  grp_member.template sync<DevExeSpace>();
+  grp_solid_angles.template modify<HostMemSpace>();
+  grp_solid_angles.template sync<DevExeSpace>();
+
+  // all MeshBlocks start at full angular resolution until criterion is evaluated
+  int nmb = pmy_pack->nmb_thispack;
+  Kokkos::realloc(ang_reduced, nmb);
+  for (int m=0; m<nmb; ++m) {ang_reduced.h_view(m) = 0;}
+  ang_reduced.template modify<HostMemSpace>();
+  ang_reduced.template sync<DevExeSpace>();
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "Radiation: reduced angular resolution enabled with " << ngroups
+              << " of " << nang << " angles evolved on reduced MeshBlocks" << std::endl;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::SelectAngularResolution()
+//! \brief Evaluates the criterion used to select MeshBlocks evolved with a reduced
+//! angular resolution, then restricts/prolongates the intensities on reduced MeshBlocks
+//! so that the intensity is constant within each group.
+
+void Radiation::SelectAngularResolution() {
+  if (!(angular_adapt)) {return;}
+  int nmb = pmy_pack->nmb_thispack;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+
+  if (angres_criterion.compare("level") == 0) {
+    // MeshBlocks at or below physical level angres_max_level are reduced
+    Mesh *pm = pmy_pack->pmesh;
+    int mbs = pm->gids_eachrank[global_variable::my_rank];
+    for (int m=0; m<nmb; ++m) {
+      int phys_level = pm->lloc_eachmb[m+mbs].level - pm->root_level;
+      ang_reduced.h_view(m) = (phys_level <= angres_max_level)? 1 : 0;
+    }
+    ang_reduced.template modify<HostMemSpace>();
+    ang_reduced.template sync<DevExeSpace>();
+  } else if (angres_criterion.compare("opacity") == 0) {
+    // MeshBlocks in which every cell is optically thick (per cell) are reduced
+    int &is = indcs.is, nx1 = indcs.nx1;
+    int &js = indcs.js, nx2 = indcs.nx2;
+    int &ks = indcs.ks, nx3 = indcs.nx3;
+    const int nkji = nx3*nx2*nx1;
+    const int nji  = nx2*nx1;
+    bool &multi_d = pmy_pack->pmesh->multi_d;
+    bool &three_d = pmy_pack->pmesh->three_d;
+    auto &size = pmy_pack->pmb->mb_size;
+
+    // opacities are evaluated from current primitives over active zones
+    DvceArray5D<Real> w0_;
+    if (is_hydro_enabled) {
+      w0_ = pmy_pack->phydro->w0;
+    } else {
+      w0_ = pmy_pack->pmhd->w0;
+    }
+    ComputeOpacities(w0_,is,indcs.ie,js,indcs.je,ks,indcs.ke);
+    auto &sigma_ = sigma;
+    Real &angres_tau_ = angres_tau;
+    auto &ang_reduced_ = ang_reduced;
+
+    par_for_outer("rad_angres",TaskExeSpace(), 0, 0, 0, (nmb-1),
+    KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
+      Real dxmin = size.d_view(m).dx1;
+      if (multi_d) {dxmin = fmin(dxmin, size.d_view(m).dx2);}
+      if (three_d) {dxmin = fmin(dxmin, size.d_view(m).dx3);}
+      Real team_taumin = (FLT_MAX);
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
+      [=](const int idx, Real& taumin) {
+        int k = (idx)/nji;
+        int j = (idx - k*nji)/nx1;
+        int i = (idx - k*nji - j*nx1) + is;
+        j += js;
+        k += ks;
+        taumin = fmin((sigma_(m,0,k,j,i) + sigma_(m,1,k,j,i))*dxmin, taumin);
+      },Kokkos::Min<Real>(team_taumin));
+      ang_reduced_.d_view(m) = (team_taumin >= angres_tau_)? 1 : 0;
+    });
+    ang_reduced.template modify<DevExeSpace>();
+    ang_reduced.template sync<HostMemSpace>();
+  }
+
+  // ensure intensities on (newly) reduced MeshBlocks are constant within each group
+  RestrictAngles();
+  ProlongateAngles();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::RestrictAngles()
+//! \brief On MeshBlocks with reduced angular resolution, sets the intensity of the
+//! representative angle of each group to the solid-angle weighted mean over the group.
+//! Applied over all cells (including ghost zones) before fluxes are computed, so that
+//! data received from neighbors at full angular resolution is restricted.
+
+void Radiation::RestrictAngles() {
+  if (!(angular_adapt)) {return;}
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int n1 = indcs.nx1 + 2*(indcs.ng);
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int ngrp1 = ngroups - 1;
+
+  auto &i0_ = i0;
+  auto &nh_c_ = nh_c;
+  auto &tc = tetcov_c;
+  auto &solid_angles_ = prgeo->solid_angles;
+  auto &ang_reduced_ = ang_reduced;
+  auto &ang_rep_ = ang_rep;
+  auto &grp_start_ = grp_start;
+  auto &grp_member_ = grp_member;
+  auto &grp_solid_angles_ = grp_solid_angles;
+
+  par_for("r_restrict_ang",TaskExeSpace(),0,nmb1,0,ngrp1,0,(n3-1),0,(n2-1),0,(n1-1),
+  KOKKOS_LAMBDA(int m, int g, int k, int j, int i) {
+    if (ang_reduced_.d_view(m)) {
+      // sum n0*I over members of group (i0 = n0*n_0*I)
+      Real isum = 0.0;
+      for (int l=grp_start_.d_view(g); l<grp_start_.d_view(g+1); ++l) {
+        int n = grp_member_.d_view(l);
+        Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
+                 + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+        isum += solid_angles_.d_view(n)*i0_(m,n,k,j,i)/n_0;
+      }
+      int nr = ang_rep_.d_view(g);
+      Real n_0r = tc(m,0,0,k,j,i)*nh_c_.d_view(nr,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(nr,1)
+                + tc(m,2,0,k,j,i)*nh_c_.d_view(nr,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(nr,3);
+      i0_(m,nr,k,j,i) = n_0r*isum/grp_solid_angles_.d_view(g);
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::ProlongateAngles()
+//! \brief On MeshBlocks with reduced angular resolution, copies the intensity of the
+//! representative angle of each group to all other angles in the group over active
+//! cells.  Applied at the end of each stage, before ghost zones are sent to neighbors.
+
+void Radiation::ProlongateAngles() {
+  if (!(angular_adapt)) {return;}
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nang1 = prgeo->nangles - 1;
+
+  auto &i0_ = i0;
+  auto &nh_c_ = nh_c;
+  auto &tc = tetcov_c;
+  auto &ang_reduced_ = ang_reduced;
+  auto &ang_group_ = ang_group;
+  auto &ang_is_rep_ = ang_is_rep;
+  auto &ang_rep_ = ang_rep;
+
+  par_for("r_prolong_ang",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    if (ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) {
+      int nr = ang_rep_.d_view(ang_group_.d_view(n));
+      Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
+               + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+      Real n_0r = tc(m,0,0,k,j,i)*nh_c_.d_view(nr,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(nr,1)
+                + tc(m,2,0,k,j,i)*nh_c_.d_view(nr,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(nr,3);
+      i0_(m,n,k,j,i) = i0_(m,nr,k,j,i)*n_0/n_0r;
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::ProlongateAngleFluxes()
+//! \brief On MeshBlocks with reduced angular resolution, copies the flux of the
+//! representative angle of each group to all other angles in the group on every face.
+//! Fluxes of other angles are not computed on reduced MeshBlocks, but with SMR/AMR they
+//! are restricted and sent to coarser neighbors (which may be evolved at full angular
+//! resolution) for flux correction, so they must not be left stale.
+
+void Radiation::ProlongateAngleFluxes() {
+  if (!(angular_adapt) || !(pmy_pack->pmesh->multilevel)) {return;}
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nang1 = prgeo->nangles - 1;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  auto &ang_reduced_ = ang_reduced;
+  auto &ang_group_ = ang_group;
+  auto &ang_is_rep_ = ang_is_rep;
+  auto &ang_rep_ = ang_rep;
+  auto &flx1 = iflx.x1f;
+  par_for("r_prolong_flx1",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie+1,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    if (ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) {
+      flx1(m,n,k,j,i) = flx1(m,ang_rep_.d_view(ang_group_.d_view(n)),k,j,i);
+    }
+  });
+  if (multi_d) {
+    auto &flx2 = iflx.x2f;
+    par_for("r_prolong_flx2",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je+1,is,ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      if (ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) {
+        flx2(m,n,k,j,i) = flx2(m,ang_rep_.d_view(ang_group_.d_view(n)),k,j,i);
+      }
+    });
+  }
+  if (three_d) {
+    auto &flx3 = iflx.x3f;
+    par_for("r_prolong_flx3",TaskExeSpace(),0,nmb1,0,nang1,ks,ke+1,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      if (ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) {
+        flx3(m,n,k,j,i) = flx3(m,ang_rep_.d_view(ang_group_.d_view(n)),k,j,i);
+      }
+    });
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Radiation::UpdateAngularResolution
+//! \brief Task list function that re-evaluates the angular resolution criterion every
+//! angres_ncycle cycles at the end of the last stage.
+
+TaskStatus Radiation::UpdateAngularResolution(Driver *pdrive, int stage) {
+  if (!(angular_adapt) || angres_ncycle <= 0) {return TaskStatus::complete;}
+  if (stage != pdrive->nexp_stages) {return TaskStatus::complete;}
+  if ((pmy_pack->pmesh->ncycle)%(angres_ncycle) != 0) {return TaskStatus::complete;}
+  SelectAngularResolution();
+  return TaskStatus::complete;
+}
+
+} // namespace radiation
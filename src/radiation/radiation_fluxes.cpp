@@ -33,18 +33,35 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   int nmb1 = pmy_pack->nmb_thispack - 1;
 
   const auto &recon_method_ = recon_method;
+  Real &rc = reduced_c;
 
   auto &i0_ = i0;
   auto &nh_c_ = nh_c;
   auto &tet_c_ = tet_c;
 
+  // with implicit transport, spatial fluxes are computed in ImplicitUpdate()
+  if (implicit_transport) {
+    CalculateAngularFluxes();
+    return TaskStatus::complete;
+  }
+
+  // on MeshBlocks with reduced angular resolution, restrict intensities (including
+  // ghost zones received from neighbors) and compute fluxes only for representative
+  // angles (see radiation_angres.cpp)
+  RestrictAngles();
+  bool &angular_adapt_ = angular_adapt;
+  auto &ang_reduced_ = ang_reduced;
+  auto &ang_is_rep_ = ang_is_rep;
+
   //--------------------------------------------------------------------------------------
   // i-direction
 
   auto &t1d1 = tet_d1_x1f;
   auto &flx1 = iflx.x1f;
-  par_for("rflux_x1",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie+1,
+  par_for("rflux_x1",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie+1,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    if (angular_adapt_ && ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) return;
+
     // calculate n^1 (hence determining upwinding direction)
     Real n1 = t1d1(m,0,k,j,i)*nh_c_.d_view(n,0) + t1d1(m,1,k,j,i)*nh_c_.d_view(n,1)
             + t1d1(m,2,k,j,i)*nh_c_.d_view(n,2) + t1d1(m,3,k,j,i)*nh_c_.d_view(n,3);
@@ -90,7 +107,7 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
     }
 
     // compute x1flux
-    flx1(m,n,k,j,i) = n1*iiu;
+    flx1(m,n,k,j,i) = rc*n1*iiu;
   });
 
   //--------------------------------------------------------------------------------------
@@ -99,8 +116,10 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->multi_d) {
     auto &t2d2 = tet_d2_x2f;
     auto &flx2 = iflx.x2f;
-    par_for("rflux_x2",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je+1,is,ie,
+    par_for("rflux_x2",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je+1,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      if (angular_adapt_ && ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) return;
+
       // calculate n^2 (hence determining upwinding direction)
       Real n2 = t2d2(m,0,k,j,i)*nh_c_.d_view(n,0) + t2d2(m,1,k,j,i)*nh_c_.d_view(n,1)
               + t2d2(m,2,k,j,i)*nh_c_.d_view(n,2) + t2d2(m,3,k,j,i)*nh_c_.d_view(n,3);
@@ -146,7 +165,7 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
       }
 
       // compute x2flux
-      flx2(m,n,k,j,i) = n2*iiu;
+      flx2(m,n,k,j,i) = rc*n2*iiu;
     });
   }
 
@@ -156,8 +175,10 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->three_d) {
     auto &t3d3 = tet_d3_x3f;
     auto &flx3 = iflx.x3f;
-    par_for("rflux_x3",DevExeSpace(),0,nmb1,0,nang1,ks,ke+1,js,je,is,ie,
+    par_for("rflux_x3",TaskExeSpace(),0,nmb1,0,nang1,ks,ke+1,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      if (angular_adapt_ && ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) return;
+
       // calculate n^3 (hence determining upwinding direction)
       Real n3 = t3d3(m,0,k,j,i)*nh_c_.d_view(n,0) + t3d3(m,1,k,j,i)*nh_c_.d_view(n,1)
               + t3d3(m,2,k,j,i)*nh_c_.d_view(n,2) + t3d3(m,3,k,j,i)*nh_c_.d_view(n,3);
@@ -203,36 +224,59 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
       }
 
       // compute x3flux
-      flx3(m,n,k,j,i) = n3*iiu;
+      flx3(m,n,k,j,i) = rc*n3*iiu;
     });
   }
 
+  // fill fluxes of angles not evolved on reduced MeshBlocks, which are used in flux
+  // correction on coarser neighbors with SMR/AMR
+  ProlongateAngleFluxes();
+
   //--------------------------------------------------------------------------------------
   // Angular Fluxes
 
-  if (angular_fluxes) {
-    auto &numn = prgeo->num_neighbors;
-    auto &indn = prgeo->ind_neighbors;
-    auto &arcl = prgeo->arc_lengths;
-    auto &solid_angles_ = prgeo->solid_angles;
+  CalculateAngularFluxes();
 
-    auto &na_ = na;
-    auto &divfa_ = divfa;
+  return TaskStatus::complete;
+}
 
-    par_for("rflux_angular",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
-    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-      divfa_(m,n,k,j,i) = 0.0;
-      for (int nb=0; nb<numn.d_view(n); ++nb) {
-        Real flx_edge = na_(m,n,k,j,i,nb) *
-                        ((na_(m,n,k,j,i,nb) < 0.0) ?
-                         i0_(m,indn.d_view(n,nb),k,j,i)/tet_c_(m,0,0,k,j,i) :
-                         i0_(m,n,k,j,i)/tet_c_(m,0,0,k,j,i));
-        divfa_(m,n,k,j,i) += (arcl.d_view(n,nb)*flx_edge/solid_angles_.d_view(n));
-      }
-    });
-  }
+//----------------------------------------------------------------------------------------
+//! \fn  void Radiation::CalculateAngularFluxes
+//! \brief Compute divergence of radiation fluxes between neighboring angles (if enabled)
 
-  return TaskStatus::complete;
+void Radiation::CalculateAngularFluxes() {
+  if (!(angular_fluxes)) return;
+
+  RegionIndcs &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  int nang1 = prgeo->nangles - 1;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  Real &rc = reduced_c;
+
+  auto &i0_ = i0;
+  auto &tet_c_ = tet_c;
+  auto &numn = prgeo->num_neighbors;
+  auto &indn = prgeo->ind_neighbors;
+  auto &arcl = prgeo->arc_lengths;
+  auto &solid_angles_ = prgeo->solid_angles;
+
+  auto &na_ = na;
+  auto &divfa_ = divfa;
+
+  par_for("rflux_angular",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    divfa_(m,n,k,j,i) = 0.0;
+    for (int nb=0; nb<numn.d_view(n); ++nb) {
+      Real flx_edge = na_(m,n,k,j,i,nb) *
+                      ((na_(m,n,k,j,i,nb) < 0.0) ?
+                       i0_(m,indn.d_view(n,nb),k,j,i)/tet_c_(m,0,0,k,j,i) :
+                       i0_(m,n,k,j,i)/tet_c_(m,0,0,k,j,i));
+      divfa_(m,n,k,j,i) += (rc*arcl.d_view(n,nb)*flx_edge/solid_angles_.d_view(n));
+    }
+  });
+  return;
 }
 
 } // namespace radiation
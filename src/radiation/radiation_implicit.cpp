@@ -0,0 +1,254 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_implicit.cpp
+//! \brief Implicit (backward Euler) update of Radiation intensities (i0) for each stage
+//! of the time integrators, which removes the light-crossing limit on the timestep.
+//!
+//! Spatial fluxes are computed with first-order upwinding of the new intensities.  The
+//! resulting linear system is solved by Gauss-Seidel sweeps in the upwind direction of
+//! each angle, which solve it exactly within every MeshBlock given the intensities in
+//! the upwind ghost zones.  Sweeps are therefore alternated with boundary communication
+//! (block Jacobi across MeshBlocks and ranks) until the relative change of the
+//! intensities falls below implicit_tol.  Angular fluxes remain explicit.
+
+#include <algorithm>
+#include <iostream>
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "coordinates/coordinates.hpp"
+#include "bvals/bvals.hpp"
+#include "geodesic-grid/geodesic_grid.hpp"
+#include "srcterms/srcterms.hpp"
+#include "radiation.hpp"
+
+namespace radiation {
+//----------------------------------------------------------------------------------------
+//! \fn Real FaceNormal
+//  \brief component n^d of angle n at face of cell (k,j,i), given subset of tetrad t
+//  stored at faces in direction d
+
+KOKKOS_INLINE_FUNCTION
+Real FaceNormal(const DvceArray5D<Real> &t, const DualArray2D<Real> &nh,
+                const int m, const int n, const int k, const int j, const int i) {
+  return t(m,0,k,j,i)*nh.d_view(n,0) + t(m,1,k,j,i)*nh.d_view(n,1)
+       + t(m,2,k,j,i)*nh.d_view(n,2) + t(m,3,k,j,i)*nh.d_view(n,3);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Radiation::ImplicitUpdate
+//  \brief Implicit update of intensities.  Replaces RKUpdate in the task list when
+//  <radiation>/implicit_transport=true, in which case CalculateFluxes() only computes
+//  the (explicit) angular flux divergence.
+
+TaskStatus Radiation::ImplicitUpdate(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie, nx1 = indcs.nx1;
+  int js = indcs.js, je = indcs.je, nx2 = indcs.nx2;
+  int ks = indcs.ks, ke = indcs.ke, nx3 = indcs.nx3;
+  int nang = prgeo->nangles;
+  int nmb = pmy_pack->nmb_thispack;
+
+  auto &mbsize  = pmy_pack->pmb->mb_size;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  Real &gam0 = pdriver->gam0[stage-1];
+  Real &gam1 = pdriver->gam1[stage-1];
+  Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  Real rc_dt = reduced_c*beta_dt;
+
+  auto &i0_ = i0;
+  auto &i1_ = i1;
+  auto &irhs_ = irhs;
+  auto &angular_fluxes_ = angular_fluxes;
+  auto &divfa_ = divfa;
+
+  // (1) on first call in this stage, store explicit terms: weighted average of registers
+  // and angular flux divergence
+  if (implicit_iter == 0 && implicit_phase == 0) {
+    par_for("r_implicit_rhs",TaskExeSpace(),0,nmb-1,0,nang-1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      irhs_(m,n,k,j,i) = gam0*i0_(m,n,k,j,i) + gam1*i1_(m,n,k,j,i);
+      if (angular_fluxes_) { irhs_(m,n,k,j,i) -= beta_dt*divfa_(m,n,k,j,i); }
+    });
+  }
+
+  auto &nh_c_ = nh_c;
+  auto &tt = tet_c;
+  auto &tc = tetcov_c;
+  auto &t1d1 = tet_d1_x1f;
+  auto &t2d2 = tet_d2_x2f;
+  auto &t3d3 = tet_d3_x3f;
+  auto &excise = pmy_pack->pcoord->coord_data.bh_excise;
+  auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
+  Real &n_0_floor_ = n_0_floor;
+
+  // setup indices for sweeps.  Cells in wavefront s satisfy a+b+c=s, where (a,b,c) are
+  // the offsets of (i,j,k) from the upwind corner of the MeshBlock for each angle.
+  const int nfront = nx1 + nx2 + nx3 - 2;
+  const int nkj = nx3*nx2;
+  const int nmnkji = nmb*nang*nx3*nx2*nx1;
+  const int nnkji  = nang*nx3*nx2*nx1;
+  const int nkji   = nx3*nx2*nx1;
+  const int nji    = nx2*nx1;
+  auto &idmax_ = idmax;
+
+  // (2) iterate sweeps and boundary communication until converged.  While ghost zones
+  // are in flight the task returns incomplete and resumes in the same phase when called
+  // again, so other tasks can execute in the meantime.
+  while (true) {
+    if (implicit_phase == 0) {
+      // One team per MeshBlock and angle updates the wavefronts in order, with a barrier
+      // between them, so all wavefronts of a sweep are done in a single kernel.  The
+      // maximum change of I over the sweep is stored for each MeshBlock and angle.
+      par_for_outer("r_implicit_sweep",TaskExeSpace(),0,0,0,(nmb-1),0,(nang-1),
+      KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n) {
+        // sweep direction set by sign of n^i at the first face of each MeshBlock
+        bool up1 = (FaceNormal(t1d1,nh_c_,m,n,ks,js,is) > 0.0);
+        bool up2 = (multi_d && FaceNormal(t2d2,nh_c_,m,n,ks,js,is) > 0.0);
+        bool up3 = (three_d && FaceNormal(t3d3,nh_c_,m,n,ks,js,is) > 0.0);
+        Real mdi = 0.0;
+        for (int s=0; s<nfront; ++s) {
+          Real front_di = 0.0;
+          Kokkos::parallel_reduce(Kokkos::TeamVectorRange(member, nkj),
+          [&](const int idx, Real &ldi) {
+            int c = idx/nx2;
+            int b = idx - c*nx2;
+            int a = s - b - c;
+            if (a < 0 || a >= nx1) return;
+            int i = (up1)? is + a : ie - a;
+            int j = (up2)? js + b : je - b;
+            int k = (up3)? ks + c : ke - c;
+
+            // Upwind flux through each face is rc*n^i*(I/n^0) of upwind cell.  Outflow
+            // adds to the diagonal, inflow (from updated or ghost cells) to the RHS.
+            Real n0 = tt(m,0,0,k,j,i);
+            Real diag = 1.0;
+            Real inflow = 0.0;
+            Real fac = rc_dt/mbsize.d_view(m).dx1;
+            Real nl = FaceNormal(t1d1,nh_c_,m,n,k,j,i);
+            Real nr = FaceNormal(t1d1,nh_c_,m,n,k,j,i+1);
+            if (nl > 0.0) { inflow += fac*nl*i0_(m,n,k,j,i-1)/tt(m,0,0,k,j,i-1); }
+            else          { diag   -= fac*nl/n0; }
+            if (nr > 0.0) { diag   += fac*nr/n0; }
+            else          { inflow -= fac*nr*i0_(m,n,k,j,i+1)/tt(m,0,0,k,j,i+1); }
+            if (multi_d) {
+              fac = rc_dt/mbsize.d_view(m).dx2;
+              nl = FaceNormal(t2d2,nh_c_,m,n,k,j,i);
+              nr = FaceNormal(t2d2,nh_c_,m,n,k,j+1,i);
+              if (nl > 0.0) { inflow += fac*nl*i0_(m,n,k,j-1,i)/tt(m,0,0,k,j-1,i); }
+              else          { diag   -= fac*nl/n0; }
+              if (nr > 0.0) { diag   += fac*nr/n0; }
+              else          { inflow -= fac*nr*i0_(m,n,k,j+1,i)/tt(m,0,0,k,j+1,i); }
+            }
+            if (three_d) {
+              fac = rc_dt/mbsize.d_view(m).dx3;
+              nl = FaceNormal(t3d3,nh_c_,m,n,k,j,i);
+              nr = FaceNormal(t3d3,nh_c_,m,n,k+1,j,i);
+              if (nl > 0.0) { inflow += fac*nl*i0_(m,n,k-1,j,i)/tt(m,0,0,k-1,j,i); }
+              else          { diag   -= fac*nl/n0; }
+              if (nr > 0.0) { diag   += fac*nr/n0; }
+              else          { inflow -= fac*nr*i0_(m,n,k+1,j,i)/tt(m,0,0,k+1,j,i); }
+            }
+            Real inew = (irhs_(m,n,k,j,i) + inflow)/diag;
+
+            // zero intensity if negative
+            Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) +
+                       tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
+                       tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) +
+                       tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+            inew = n0*n_0*fmax((inew/(n0*n_0)), 0.0);
+
+            // handle excision (see RKUpdate)
+            if (excise) {
+              if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { inew = 0.0; }
+            }
+
+            ldi = fmax(ldi, fabs(inew - i0_(m,n,k,j,i)));
+            i0_(m,n,k,j,i) = inew;
+          }, Kokkos::Max<Real>(front_di));
+          member.team_barrier();
+          mdi = fmax(mdi, front_di);
+        }
+        Kokkos::single(Kokkos::PerTeam(member), [&]() {
+          idmax_(m,n) = mdi;
+        });
+      });
+
+      // single reduction (and host synchronization) per sweep
+      Real max_di = 0.0, max_i = 0.0;
+      Kokkos::parallel_reduce("r_implicit_conv",
+      Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmnkji),
+      KOKKOS_LAMBDA(const int &idx, Real &mdi, Real &mi) {
+        int m = (idx)/nnkji;
+        int n = (idx - m*nnkji)/nkji;
+        int k = (idx - m*nnkji - n*nkji)/nji;
+        int j = (idx - m*nnkji - n*nkji - k*nji)/nx1;
+        int i = (idx - m*nnkji - n*nkji - k*nji - j*nx1) + is;
+        k += ks;
+        j += js;
+        mdi = fmax(mdi, idmax_(m,n));
+        mi  = fmax(mi, fabs(i0_(m,n,k,j,i)));
+      }, Kokkos::Max<Real>(max_di), Kokkos::Max<Real>(max_i));
+#if MPI_PARALLEL_ENABLED
+      MPI_Allreduce(MPI_IN_PLACE, &max_di, 1, MPI_ATHENA_REAL, MPI_MAX, MPI_COMM_WORLD);
+      MPI_Allreduce(MPI_IN_PLACE, &max_i, 1, MPI_ATHENA_REAL, MPI_MAX, MPI_COMM_WORLD);
+#endif
+      // exit once intensities are unchanged by sweep, since ghost zones then also agree
+      bool converged = (max_di <= implicit_tol*max_i);
+      if (!(converged) && implicit_iter == implicit_max_iter-1) {
+        if (global_variable::my_rank == 0) {
+          std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "Implicit radiation transport not converged after "
+                    << implicit_max_iter << " iterations, relative change="
+                    << max_di/max_i << std::endl;
+        }
+      }
+      if (converged || implicit_iter == implicit_max_iter-1) {
+        implicit_iter = 0;
+        break;
+      }
+      implicit_phase = 1;
+    }
+
+    // Exchange ghost zones.  Receives for I were posted by InitRecv in before_stagen,
+    // and are re-posted after each exchange so they remain available to SendI/RecvI.
+    if (implicit_phase == 1) {
+      if (pbval_i->PackAndSendCC(i0, coarse_i0) != TaskStatus::complete) {
+        return TaskStatus::incomplete;
+      }
+      implicit_phase = 2;
+    }
+    if (pbval_i->RecvAndUnpackCC(i0, coarse_i0) != TaskStatus::complete) {
+      return TaskStatus::incomplete;
+    }
+    pbval_i->ClearSend();
+    pbval_i->ClearRecv();
+    pbval_i->InitRecv(nang);
+
+    // physical BCs on radiation.  User BCs may modify the fluid, so they are only applied
+    // once per stage by ApplyPhysicalBCs
+    if (!(pmy_pack->pmesh->strictly_periodic)) {
+      pbval_i->RadiationBCs((pmy_pack), (pbval_i->i_in), i0);
+    }
+    implicit_phase = 0;
+    implicit_iter++;
+  }
+
+  // add beam source term, if any (emitted at the reduced speed of light)
+  if (psrc->beam)  psrc->BeamSource(i0_, rc_dt);
+
+  return TaskStatus::complete;
+}
+
+} // namespace radiation
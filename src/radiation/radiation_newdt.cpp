@@ -28,7 +28,11 @@ namespace radiation {
 //----------------------------------------------------------------------------------------
 // \!fn void Radiation::NewTimeStep()
 // \brief calculate the minimum timestep within a MeshBlockPack for radiation problems.
-//        Only computed once at beginning of calculation.
+//        Only computed once at beginning of calculation.  Timestep is set by the
+//        light-crossing time at the (possibly reduced) speed of light reduced_c.  With
+//        implicit transport only angular fluxes (which remain explicit) limit the
+//        timestep, and the spatial light-crossing time is multiplied by
+//        implicit_dt_factor.
 
 TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
@@ -59,7 +63,7 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
   auto &indn = prgeo->ind_neighbors;
 
   // find smallest (dx/c) and (dangle/na) in each direction for radiation problems
-  Kokkos::parallel_reduce("RadiationNudt",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  Kokkos::parallel_reduce("RadiationNudt",Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
   KOKKOS_LAMBDA(const int &idx,Real &min_dt1,Real &min_dt2,Real &min_dt3,Real &min_dta) {
     // compute m,k,j,i indices of thread and call function
     int m = (idx)/nkji;
@@ -104,8 +108,12 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
   dtnew = dt1;
   if (pmy_pack->pmesh->multi_d) { dtnew = std::min(dtnew, dt2); }
   if (pmy_pack->pmesh->three_d) { dtnew = std::min(dtnew, dt3); }
+  if (implicit_transport) { dtnew *= implicit_dt_factor; }
   if (angular_fluxes_) { dtnew = std::min(dtnew, dta); }
 
+  // signals propagate at the reduced speed of light (if enabled)
+  dtnew /= reduced_c;
+
   return TaskStatus::complete;
 }
 } // namespace radiation
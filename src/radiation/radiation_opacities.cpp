@@ -0,0 +1,152 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_opacities.cpp
+//! \brief functions to load tabulated opacities and to evaluate opacities of all cells
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "units/units.hpp"
+#include "radiation/radiation.hpp"
+#include "radiation/radiation_opacities.hpp"
+
+namespace radiation {
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::LoadOpacityTable()
+//! \brief Reads tabulated opacities from binary file and copies them to device memory.
+//! File contains (in native byte order):
+//!   int32   nrho, ntemp
+//!   float64 log10(rho_min), log10(rho_max), log10(T_min), log10(T_max)
+//!   float64 log10(kappa)[3][ntemp][nrho]
+//! with rho in g/cm^3, T in K, and the Rosseland mean absorption, scattering, and Planck
+//! mean absorption opacities kappa in cm^2/g.  Density varies fastest.
+
+void Radiation::LoadOpacityTable(const std::string &fname, bool cubic) {
+  std::ifstream infile(fname, std::ios::binary);
+  if (!(infile.is_open())) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Opacity table file '" << fname << "' could not be opened"
+      << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::int32_t nsize[2];
+  double range[4];
+  infile.read(reinterpret_cast<char*>(nsize), sizeof(nsize));
+  infile.read(reinterpret_cast<char*>(range), sizeof(range));
+  if (!(infile) || nsize[0] < 2 || nsize[1] < 2 ||
+      range[1] <= range[0] || range[3] <= range[2]) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Header of opacity table '" << fname << "' is invalid; table "
+      << "requires at least 2 entries and increasing range in density and temperature"
+      << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  int nrho = nsize[0], ntemp = nsize[1];
+  std::vector<double> data(3*static_cast<size_t>(ntemp)*nrho);
+  infile.read(reinterpret_cast<char*>(data.data()), data.size()*sizeof(double));
+  if (!(infile)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "Opacity table '" << fname << "' is truncated, expected "
+      << data.size() << " entries" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  opacity_tab.nrho = nrho;
+  opacity_tab.ntemp = ntemp;
+  opacity_tab.logrho_min = range[0];
+  opacity_tab.dlogrho = (range[1] - range[0])/static_cast<Real>(nrho - 1);
+  opacity_tab.logt_min = range[2];
+  opacity_tab.dlogt = (range[3] - range[2])/static_cast<Real>(ntemp - 1);
+  opacity_tab.cubic = cubic;
+  Kokkos::realloc(opacity_tab.logk, 3, ntemp, nrho);
+  auto logk_h = Kokkos::create_mirror_view(opacity_tab.logk);
+  for (int n=0; n<3; ++n) {
+    for (int j=0; j<ntemp; ++j) {
+      for (int i=0; i<nrho; ++i) {
+        logk_h(n,j,i) = static_cast<Real>(data[(n*ntemp + j)*nrho + i]);
+      }
+    }
+  }
+  Kokkos::deep_copy(opacity_tab.logk, logk_h);
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "Loaded " << nrho << "x" << ntemp << " opacity table from " << fname
+              << std::endl;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Radiation::ComputeOpacities()
+//! \brief Evaluates comoving sigma_a, sigma_s, sigma_p over the given range of cells of
+//! all MeshBlocks from primitive variables w, and stores them in sigma.  Called once per
+//! stage so that all kernels coupling radiation and fluid share the same opacities.
+
+void Radiation::ComputeOpacities(const DvceArray5D<Real> &w, const int il, const int iu,
+                                 const int jl, const int ju, const int kl, const int ku) {
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+
+  Real density_scale_ = 1.0, temperature_scale_ = 1.0, length_scale_ = 1.0;
+  Real mean_mol_weight_ = 1.0;
+  Real rosseland_coef_ = 1.0, planck_minus_rosseland_coef_ = 0.0;
+  if (are_units_enabled) {
+    density_scale_ = pmy_pack->punit->density_cgs();
+    temperature_scale_ = pmy_pack->punit->temperature_cgs();
+    length_scale_ = pmy_pack->punit->length_cgs();
+    mean_mol_weight_ = pmy_pack->punit->mu();
+    rosseland_coef_ = pmy_pack->punit->rosseland_coef_cgs;
+    planck_minus_rosseland_coef_ = pmy_pack->punit->planck_minus_rosseland_coef_cgs;
+  }
+  Real gm1;
+  if (is_hydro_enabled) {
+    gm1 = pmy_pack->phydro->peos->eos_data.gamma - 1.0;
+  } else {
+    gm1 = pmy_pack->pmhd->peos->eos_data.gamma - 1.0;
+  }
+
+  Real &kappa_a_ = kappa_a;
+  Real &kappa_s_ = kappa_s;
+  Real &kappa_p_ = kappa_p;
+  bool &power_opacity_ = power_opacity;
+  bool &table_opacity_ = table_opacity;
+  auto &tab = opacity_tab;
+  auto &sigma_ = sigma;
+
+  par_for("rad_opacities",TaskExeSpace(),0,nmb1,kl,ku,jl,ju,il,iu,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real wdn = w(m,IDN,k,j,i);
+    Real tgas = gm1*w(m,IEN,k,j,i)/wdn;
+    Real sigma_a, sigma_s, sigma_p;
+    if (table_opacity_) {
+      TableOpacityFunction(tab, wdn, density_scale_, tgas, temperature_scale_,
+                           length_scale_, sigma_a, sigma_s, sigma_p);
+    } else {
+      OpacityFunction(wdn, density_scale_,
+                      tgas, temperature_scale_,
+                      length_scale_, gm1, mean_mol_weight_,
+                      power_opacity_, rosseland_coef_, planck_minus_rosseland_coef_,
+                      kappa_a_, kappa_s_, kappa_p_,
+                      sigma_a, sigma_s, sigma_p);
+    }
+    sigma_(m,0,k,j,i) = sigma_a;
+    sigma_(m,1,k,j,i) = sigma_s;
+    sigma_(m,2,k,j,i) = sigma_p;
+  });
+  return;
+}
+
+} // namespace radiation
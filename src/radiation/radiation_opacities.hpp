@@ -6,7 +6,8 @@
 // Licensed under the 3-clause BSD License (the "LICENSE")
 //========================================================================================
 //! \file radiation_opacities.hpp
-//! \brief implements functions for computing opacities
+//! \brief implements functions for computing opacities, either from constant or power
+//! law coefficients, or by interpolation in tabulated mean opacities.
 
 #include <math.h>
 
@@ -45,4 +46,95 @@ void OpacityFunction(// density and density scale
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \struct OpacityTable
+//! \brief container for tabulated opacities on a uniform grid in (log10(rho),log10(T)),
+//! with rho in g/cm^3 and T in K.  Table stores log10 of the Rosseland mean absorption,
+//! scattering, and Planck mean absorption opacities (in cm^2/g), in that order, indexed
+//! as logk(n,itemp,irho).  Loaded by Radiation::LoadOpacityTable().
+
+struct OpacityTable {
+  int nrho, ntemp;          // number of table entries in density and temperature
+  Real logrho_min, dlogrho; // minimum and spacing of log10(rho)
+  Real logt_min, dlogt;     // minimum and spacing of log10(T)
+  bool cubic;               // bicubic (Catmull-Rom) rather than bilinear interpolation
+  DvceArray3D<Real> logk;   // log10 of opacities
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn Real InterpolateOpacityTable
+//! \brief returns log10 of opacity n interpolated to (logrho,logt).  Values outside the
+//! table are clamped to its edges.
+
+KOKKOS_INLINE_FUNCTION
+Real InterpolateOpacityTable(const OpacityTable &tab, const int n,
+                             const Real logrho, const Real logt) {
+  Real x = (logrho - tab.logrho_min)/tab.dlogrho;
+  Real y = (logt - tab.logt_min)/tab.dlogt;
+  x = fmin(fmax(x, 0.0), static_cast<Real>(tab.nrho - 1));
+  y = fmin(fmax(y, 0.0), static_cast<Real>(tab.ntemp - 1));
+  int i = static_cast<int>(x);
+  int j = static_cast<int>(y);
+  i = (i < tab.nrho - 2)? i : tab.nrho - 2;
+  j = (j < tab.ntemp - 2)? j : tab.ntemp - 2;
+  Real fx = x - static_cast<Real>(i);
+  Real fy = y - static_cast<Real>(j);
+
+  if (tab.cubic) {
+    // Catmull-Rom weights of points i-1,i,i+1,i+2 (indices clamped at table edges)
+    Real wx[4], wy[4];
+    wx[0] = 0.5*fx*(-1.0 + fx*(2.0 - fx));
+    wx[1] = 0.5*(2.0 + fx*fx*(-5.0 + 3.0*fx));
+    wx[2] = 0.5*fx*(1.0 + fx*(4.0 - 3.0*fx));
+    wx[3] = 0.5*fx*fx*(-1.0 + fx);
+    wy[0] = 0.5*fy*(-1.0 + fy*(2.0 - fy));
+    wy[1] = 0.5*(2.0 + fy*fy*(-5.0 + 3.0*fy));
+    wy[2] = 0.5*fy*(1.0 + fy*(4.0 - 3.0*fy));
+    wy[3] = 0.5*fy*fy*(-1.0 + fy);
+    Real val = 0.0;
+    for (int b=0; b<4; ++b) {
+      int jj = j - 1 + b;
+      jj = (jj < 0)? 0 : ((jj > tab.ntemp - 1)? tab.ntemp - 1 : jj);
+      Real row = 0.0;
+      for (int a=0; a<4; ++a) {
+        int ii = i - 1 + a;
+        ii = (ii < 0)? 0 : ((ii > tab.nrho - 1)? tab.nrho - 1 : ii);
+        row += wx[a]*tab.logk(n,jj,ii);
+      }
+      val += wy[b]*row;
+    }
+    return val;
+  }
+
+  return ((1.0 - fy)*((1.0 - fx)*tab.logk(n,j  ,i) + fx*tab.logk(n,j  ,i+1)) +
+                 fy *((1.0 - fx)*tab.logk(n,j+1,i) + fx*tab.logk(n,j+1,i+1)));
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TableOpacityFunction
+//! \brief sets sigma_a, sigma_s, sigma_p in the comoving frame from tabulated opacities.
+//! As for power law opacities, sigma_a uses the Rosseland mean and sigma_p the difference
+//! between the Planck and Rosseland means.
+
+KOKKOS_INLINE_FUNCTION
+void TableOpacityFunction(const OpacityTable &tab,
+                          // density and density scale
+                          const Real dens, const Real density_scale,
+                          // temperature and temperature scale
+                          const Real temp, const Real temperature_scale,
+                          // length scale
+                          const Real length_scale,
+                          // output sigma
+                          Real& sigma_a, Real& sigma_s, Real& sigma_p) {
+  Real logrho = log10(dens*density_scale);
+  Real logt = log10(temp*temperature_scale);
+  Real k_a_r = pow(10.0, InterpolateOpacityTable(tab, 0, logrho, logt));
+  Real k_s   = pow(10.0, InterpolateOpacityTable(tab, 1, logrho, logt));
+  Real k_a_p = pow(10.0, InterpolateOpacityTable(tab, 2, logrho, logt));
+  sigma_a = dens*k_a_r*density_scale*length_scale;
+  sigma_p = dens*(k_a_p - k_a_r)*density_scale*length_scale;
+  sigma_s = dens*k_s*density_scale*length_scale;
+  return;
+}
+
 #endif // RADIATION_RADIATION_OPACITIES_HPP_
@@ -19,7 +19,6 @@
 #include "radiation.hpp"
 
 #include "radiation/radiation_tetrad.hpp"
-#include "radiation/radiation_opacities.hpp"
 
 namespace radiation {
 
@@ -62,18 +61,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
 
   // Extract radiation constant and units
   Real &arad_ = arad;
-  Real density_scale_ = 1.0, temperature_scale_ = 1.0, length_scale_ = 1.0;
-  Real mean_mol_weight_ = 1.0;
-  Real rosseland_coef_ = 1.0, planck_minus_rosseland_coef_ = 0.0;
   Real inv_t_electron_ = 1.0;
   if (are_units_enabled_) {
-    density_scale_ = pmy_pack->punit->density_cgs();
-    temperature_scale_ = pmy_pack->punit->temperature_cgs();
-    length_scale_ = pmy_pack->punit->length_cgs();
-    mean_mol_weight_ = pmy_pack->punit->mu();
-    rosseland_coef_ = pmy_pack->punit->rosseland_coef_cgs;
-    planck_minus_rosseland_coef_ = pmy_pack->punit->planck_minus_rosseland_coef_cgs;
-    inv_t_electron_ = temperature_scale_/pmy_pack->punit->electron_rest_mass_energy_cgs;
+    inv_t_electron_ = (pmy_pack->punit->temperature_cgs()/
+                       pmy_pack->punit->electron_rest_mass_energy_cgs);
   }
 
   // Extract adiabatic index
@@ -86,16 +77,21 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
 
   // Extract radiation, radiation frame, and radiation angular mesh data
   auto &i0_ = i0;
-  Real &kappa_a_ = kappa_a;
-  Real &kappa_s_ = kappa_s;
-  Real &kappa_p_ = kappa_p;
-  bool &power_opacity_ = power_opacity;
+  auto &sigma_ = sigma;
   auto &nh_c_ = nh_c;
   auto &tt = tet_c;
   auto &tc = tetcov_c;
   auto &norm_to_tet_ = norm_to_tet;
   auto &solid_angles_ = prgeo->solid_angles;
 
+  // on MeshBlocks with reduced angular resolution only representative angles are
+  // coupled, each weighted by the total solid angle of its group
+  bool &angular_adapt_ = angular_adapt;
+  auto &ang_reduced_ = ang_reduced;
+  auto &ang_is_rep_ = ang_is_rep;
+  auto &ang_group_ = ang_group;
+  auto &grp_solid_angles_ = grp_solid_angles;
+
   // Extract hydro/mhd quantities
   DvceArray5D<Real> u0_, w0_;
   if (is_hydro_enabled_) {
@@ -106,8 +102,12 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     w0_ = pmy_pack->pmhd->w0;
   }
 
-  // Extract timestep
+  // Extract timestep.  With the reduced speed of light approximation, the radiation field
+  // is coupled over rdt_ = reduced_c*dt_ while the fluid is coupled over dt_, and the
+  // change in radiation moments is rescaled by 1/reduced_c before feedback on the fluid.
   Real dt_ = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  Real rdt_ = reduced_c*dt_;
+  Real inv_rc_ = 1.0/reduced_c;
 
   // Call ConsToPrim over active zones prior to source term application
   if (!(fixed_fluid_)) {
@@ -120,8 +120,11 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     }
   }
 
+  // Evaluate opacities of all active cells once, before the implicit update
+  ComputeOpacities(w0_,is,ie,js,je,ks,ke);
+
   // compute implicit source term
-  par_for("radiation_source",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
+  par_for("radiation_source",TaskExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
     Real &x1min = size.d_view(m).x1min;
     Real &x1max = size.d_view(m).x1max;
@@ -156,20 +159,16 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
     Real gamma = sqrt(1.0 + q);
     Real u0 = gamma/alpha;
 
-    // set opacities
-    Real sigma_a, sigma_s, sigma_p;
-    OpacityFunction(wdn, density_scale_,
-                    tgas, temperature_scale_,
-                    length_scale_, gm1, mean_mol_weight_,
-                    power_opacity_, rosseland_coef_, planck_minus_rosseland_coef_,
-                    kappa_a_, kappa_s_, kappa_p_,
-                    sigma_a, sigma_s, sigma_p);
-    Real dtcsiga = dt_*sigma_a;
-    Real dtcsigs = dt_*sigma_s;
-    Real dtcsigp = dt_*sigma_p;
-    Real dtaucsiga = dtcsiga/u0;
-    Real dtaucsigs = dtcsigs/u0;
-    Real dtaucsigp = dtcsigp/u0;
+    // opacities
+    Real &sigma_a = sigma_(m,0,k,j,i);
+    Real &sigma_s = sigma_(m,1,k,j,i);
+    Real &sigma_p = sigma_(m,2,k,j,i);
+    Real dtcsiga = rdt_*sigma_a;
+    Real dtcsigs = rdt_*sigma_s;
+    Real dtcsigp = rdt_*sigma_p;
+    Real dtaucsiga = dt_*sigma_a/u0;
+    Real dtaucsigs = dt_*sigma_s/u0;
+    Real dtaucsigp = dt_*sigma_p/u0;
 
     // compute fluid velocity in tetrad frame
     Real u_tet[4];
@@ -184,17 +183,21 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
 
     // coordinate component n^0
     Real n0 = tt(m,0,0,k,j,i);
+    bool reduced = (angular_adapt_ && ang_reduced_.d_view(m));
 
     // Calculate polynomial coefficients
     Real wght_sum = 0.0;
     Real suma1 = 0.0;
     Real suma2 = 0.0;
     for (int n=0; n<=nang1; ++n) {
+      if (reduced && !(ang_is_rep_.d_view(n))) continue;
+      Real omega = (reduced)? grp_solid_angles_.d_view(ang_group_.d_view(n)) :
+                              solid_angles_.d_view(n);
       Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
                  tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
       Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
                     u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
-      Real omega_cm = solid_angles_.d_view(n)/SQR(n0_cm);
+      Real omega_cm = omega/SQR(n0_cm);
       Real intensity_cm = 4.0*M_PI*(i0_(m,n,k,j,i)/(n0*n_0))*SQR(SQR(n0_cm));
       Real vncsigma = 1.0/(n0 + (dtcsiga + dtcsigs)*n0_cm);
       Real vncsigma2 = n0_cm*vncsigma;
@@ -233,6 +236,9 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
       Real jr_cm = (suma1*emission + suma2)/(1.0 - suma3);
       Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
       for (int n=0; n<=nang1; ++n) {
+        if (reduced && !(ang_is_rep_.d_view(n))) continue;
+        Real omega = (reduced)? grp_solid_angles_.d_view(ang_group_.d_view(n)) :
+                                solid_angles_.d_view(n);
         // compute coordinate normal components
         Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
                  + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
@@ -244,10 +250,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                  + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
 
         // compute moments before coupling
-        m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-        m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        m_old[0] += (    i0_(m,n,k,j,i)    *omega);
+        m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*omega);
+        m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*omega);
+        m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*omega);
 
         // update intensity
         Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
@@ -262,10 +268,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                                      di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
 
         // compute moments after coupling
-        m_new[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-        m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-        m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+        m_new[0] += (    i0_(m,n,k,j,i)    *omega);
+        m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*omega);
+        m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*omega);
+        m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*omega);
 
         // handle excision
         // NOTE(@pdmullen): The below zeroes all intensities within rks <= r_excision and
@@ -280,10 +286,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
       }
       // update conserved fluid variables
       if (affect_fluid_) {
-        u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0]);
-        u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1]);
-        u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2]);
-        u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3]);
+        u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0])*inv_rc_;
+        u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1])*inv_rc_;
+        u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2])*inv_rc_;
+        u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3])*inv_rc_;
       }
     }
 
@@ -296,11 +302,14 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
       suma1 = 0.0;
       Real jr_cm = 0.0;
       for (int n=0; n<=nang1; ++n) {
+        if (reduced && !(ang_is_rep_.d_view(n))) continue;
+        Real omega = (reduced)? grp_solid_angles_.d_view(ang_group_.d_view(n)) :
+                                solid_angles_.d_view(n);
         Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
                    tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
         Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
                       u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
-        Real wght_cm = solid_angles_.d_view(n)/SQR(n0_cm)/wght_sum;
+        Real wght_cm = omega/SQR(n0_cm)/wght_sum;
         Real intensity_cm = 4.0*M_PI*(i0_(m,n,k,j,i)/(n0*n_0))*SQR(SQR(n0_cm));
         Real ir_weight = intensity_cm*wght_cm;
         jr_cm += ir_weight;
@@ -330,6 +339,9 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
         tgasnew = (arad_*SQR(SQR(tradnew)) - jr_cm)/(suma1*jr_cm) + tradnew;
         Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
         for (int n=0; n<=nang1; ++n) {
+          if (reduced && !(ang_is_rep_.d_view(n))) continue;
+          Real omega = (reduced)? grp_solid_angles_.d_view(ang_group_.d_view(n)) :
+                                  solid_angles_.d_view(n);
           // compute coordinate normal components
           Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
                    + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
@@ -341,10 +353,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                    + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
 
           // compute moments before coupling
-          m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-          m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          m_old[0] += (    i0_(m,n,k,j,i)    *omega);
+          m_old[1] += (n_1*i0_(m,n,k,j,i)/n_0*omega);
+          m_old[2] += (n_2*i0_(m,n,k,j,i)/n_0*omega);
+          m_old[3] += (n_3*i0_(m,n,k,j,i)/n_0*omega);
 
           // update intensity
           Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
@@ -354,10 +366,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
                                        di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
 
           // compute moments after coupling
-          m_new[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
-          m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
-          m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*solid_angles_.d_view(n));
+          m_new[0] += (    i0_(m,n,k,j,i)    *omega);
+          m_new[1] += (n_1*i0_(m,n,k,j,i)/n_0*omega);
+          m_new[2] += (n_2*i0_(m,n,k,j,i)/n_0*omega);
+          m_new[3] += (n_3*i0_(m,n,k,j,i)/n_0*omega);
 
           // handle excision (see notes above)
           if (excise) {
@@ -367,10 +379,10 @@ TaskStatus Radiation::AddRadiationSourceTerm(Driver *pdriver, int stage) {
 
         // feedback on fluid
         if (affect_fluid_) {
-          u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0]);
-          u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1]);
-          u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2]);
-          u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3]);
+          u0_(m,IEN,k,j,i) += (m_old[0] - m_new[0])*inv_rc_;
+          u0_(m,IM1,k,j,i) += (m_old[1] - m_new[1])*inv_rc_;
+          u0_(m,IM2,k,j,i) += (m_old[2] - m_new[2])*inv_rc_;
+          u0_(m,IM3,k,j,i) += (m_old[3] - m_new[3])*inv_rc_;
         }
       } else {
         // NOTE(@pdmullen): At this point, it is possible that excision has not been
@@ -34,6 +34,10 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
   hydro::Hydro *phyd = pmy_pack->phydro;
   mhd::MHD *pmhd = pmy_pack->pmhd;
 
+  // with implicit transport, RK update of intensities is replaced by an iterative solve
+  auto rad_update = (implicit_transport)? &Radiation::ImplicitUpdate :
+                                          &Radiation::RKUpdate;
+
   // construct task list depending on enabled physics modules and radiation parameters
   if (pmhd != nullptr && !(fixed_fluid)) {  // radiation magnetohydrodynamics
     // assemble "before_stagen" task list
@@ -45,8 +49,8 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
     id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu);
     id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux);
     id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf);
-    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf);
-    id.mhd_flux  = tl["stagen"]->AddTask(&mhd::MHD::Fluxes, pmhd, id.rad_rkupdt);
+    id.rad_rkupdt= tl["stagen"]->AddTask(rad_update, this, id.rad_recvf);
+    id.mhd_flux  = tl["stagen"]->AddTask(&mhd::MHD::Fluxes, pmhd, id.copyu);
     id.mhd_sendf = tl["stagen"]->AddTask(&mhd::MHD::SendFlux, pmhd, id.mhd_flux);
     id.mhd_recvf = tl["stagen"]->AddTask(&mhd::MHD::RecvFlux, pmhd, id.mhd_sendf);
     id.mhd_rkupdt= tl["stagen"]->AddTask(&mhd::MHD::RKUpdate, pmhd, id.mhd_recvf);
@@ -54,29 +58,45 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
     id.mhd_sende = tl["stagen"]->AddTask(&mhd::MHD::SendE, pmhd, id.mhd_efld);
     id.mhd_recve = tl["stagen"]->AddTask(&mhd::MHD::RecvE, pmhd, id.mhd_sende);
     id.mhd_ct    = tl["stagen"]->AddTask(&mhd::MHD::CT, pmhd, id.mhd_recve);
+    TaskID rad_mhd_updt = (id.rad_rkupdt | id.mhd_ct);
     id.rad_src   = tl["stagen"]->AddTask(
-                                    &Radiation::AddRadiationSourceTerm,this,id.mhd_ct);
+                                &Radiation::AddRadiationSourceTerm,this,rad_mhd_updt);
     id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src);
     id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti);
     id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi);
-    id.mhd_restu = tl["stagen"]->AddTask(&mhd::MHD::RestrictU, pmhd, id.rad_recvi);
+    id.mhd_restu = tl["stagen"]->AddTask(&mhd::MHD::RestrictU, pmhd, id.rad_src);
     id.mhd_sendu = tl["stagen"]->AddTask(&mhd::MHD::SendU, pmhd, id.mhd_restu);
     id.mhd_recvu = tl["stagen"]->AddTask(&mhd::MHD::RecvU, pmhd, id.mhd_sendu);
     id.mhd_restb = tl["stagen"]->AddTask(&mhd::MHD::RestrictB, pmhd, id.mhd_recvu);
     id.mhd_sendb = tl["stagen"]->AddTask(&mhd::MHD::SendB, pmhd, id.mhd_restb);
     id.mhd_recvb = tl["stagen"]->AddTask(&mhd::MHD::RecvB, pmhd, id.mhd_sendb);
+    TaskID rad_mhd_recv = (id.rad_recvi | id.mhd_recvb);
     id.bcs       = tl["stagen"]->AddTask(
-                                    &Radiation::ApplyPhysicalBCs, this, id.mhd_recvb);
+                               &Radiation::ApplyPhysicalBCs, this, rad_mhd_recv);
     id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs);
     id.mhd_prol  = tl["stagen"]->AddTask(&mhd::MHD::Prolongate, pmhd, id.rad_prol);
     id.mhd_c2p   = tl["stagen"]->AddTask(&mhd::MHD::ConToPrim, pmhd, id.mhd_prol);
 
+    // radiation and MHD updates are independent until the source terms are added, as are
+    // their boundary communications after it, so run them on separate execution space
+    // instances (if available)
+    TaskID rad_tasks[] = {id.rad_flux, id.rad_sendf, id.rad_recvf, id.rad_rkupdt,
+                          id.rad_resti, id.rad_sendi, id.rad_recvi};
+    TaskID mhd_tasks[] = {id.mhd_flux, id.mhd_sendf, id.mhd_recvf, id.mhd_rkupdt,
+                          id.mhd_efld, id.mhd_sende, id.mhd_recve, id.mhd_ct,
+                          id.mhd_restu, id.mhd_sendu, id.mhd_recvu,
+                          id.mhd_restb, id.mhd_sendb, id.mhd_recvb};
+    for (auto &tid : rad_tasks) {tl["stagen"]->SetInstance(tid, 0);}
+    for (auto &tid : mhd_tasks) {tl["stagen"]->SetInstance(tid, 1);}
+
     // assemble "after_stagen" task list
     id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none);
     id.mhd_csend = tl["after_stagen"]->AddTask(&mhd::MHD::ClearSend, pmhd, none);
     // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
     // task list anyways to catch potential bugs in MPI communication logic
     id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend);
+    id.rad_angres= tl["after_stagen"]->AddTask(
+                              &Radiation::UpdateAngularResolution, this, id.rad_crecv);
     id.mhd_crecv = tl["after_stagen"]->AddTask(
                                           &mhd::MHD::ClearRecv, pmhd, id.mhd_csend);
 
@@ -90,25 +110,37 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
     id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu);
     id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux);
     id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf);
-    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf);
-    id.hyd_flux  = tl["stagen"]->AddTask(&hydro::Hydro::Fluxes, phyd, id.rad_rkupdt);
+    id.rad_rkupdt= tl["stagen"]->AddTask(rad_update, this, id.rad_recvf);
+    id.hyd_flux  = tl["stagen"]->AddTask(&hydro::Hydro::Fluxes, phyd, id.copyu);
     id.hyd_sendf = tl["stagen"]->AddTask(&hydro::Hydro::SendFlux, phyd, id.hyd_flux);
     id.hyd_recvf = tl["stagen"]->AddTask(&hydro::Hydro::RecvFlux, phyd, id.hyd_sendf);
     id.hyd_rkupdt= tl["stagen"]->AddTask(&hydro::Hydro::RKUpdate,phyd,id.hyd_recvf);
+    TaskID rad_hyd_updt = (id.rad_rkupdt | id.hyd_rkupdt);
     id.rad_src   = tl["stagen"]->AddTask(
-                                   &Radiation::AddRadiationSourceTerm,this,id.hyd_rkupdt);
+                                &Radiation::AddRadiationSourceTerm,this,rad_hyd_updt);
     id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src);
     id.rad_sendi = tl["stagen"]->AddTask(&Radiation::SendI, this, id.rad_resti);
     id.rad_recvi = tl["stagen"]->AddTask(&Radiation::RecvI, this, id.rad_sendi);
-    id.hyd_restu = tl["stagen"]->AddTask(&hydro::Hydro::RestrictU, phyd, id.rad_recvi);
+    id.hyd_restu = tl["stagen"]->AddTask(&hydro::Hydro::RestrictU, phyd, id.rad_src);
     id.hyd_sendu = tl["stagen"]->AddTask(&hydro::Hydro::SendU, phyd, id.hyd_restu);
     id.hyd_recvu = tl["stagen"]->AddTask(&hydro::Hydro::RecvU, phyd, id.hyd_sendu);
+    TaskID rad_hyd_recv = (id.rad_recvi | id.hyd_recvu);
     id.bcs       = tl["stagen"]->AddTask(
-                                    &Radiation::ApplyPhysicalBCs, this, id.hyd_recvu);
+                               &Radiation::ApplyPhysicalBCs, this, rad_hyd_recv);
     id.rad_prol  = tl["stagen"]->AddTask(&Radiation::Prolongate, this, id.bcs);
     id.hyd_prol  = tl["stagen"]->AddTask(&hydro::Hydro::Prolongate, phyd, id.rad_prol);
     id.hyd_c2p   = tl["stagen"]->AddTask(&hydro::Hydro::ConToPrim, phyd, id.hyd_prol);
 
+    // radiation and hydro updates are independent until the source terms are added, as
+    // are their boundary communications after it, so run them on separate execution
+    // space instances (if available)
+    TaskID rad_tasks[] = {id.rad_flux, id.rad_sendf, id.rad_recvf, id.rad_rkupdt,
+                          id.rad_resti, id.rad_sendi, id.rad_recvi};
+    TaskID hyd_tasks[] = {id.hyd_flux, id.hyd_sendf, id.hyd_recvf, id.hyd_rkupdt,
+                          id.hyd_restu, id.hyd_sendu, id.hyd_recvu};
+    for (auto &tid : rad_tasks) {tl["stagen"]->SetInstance(tid, 0);}
+    for (auto &tid : hyd_tasks) {tl["stagen"]->SetInstance(tid, 1);}
+
     // assemble "after_stagen" task list
     // assemble end task list
     id.rad_csend = tl["after_stagen"]->AddTask(&Radiation::ClearSend, this, none);
@@ -116,6 +148,8 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
     // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
     // task list anyways to catch potential bugs in MPI communication logic
     id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend);
+    id.rad_angres= tl["after_stagen"]->AddTask(
+                              &Radiation::UpdateAngularResolution, this, id.rad_crecv);
     id.hyd_crecv = tl["after_stagen"]->AddTask(
                                        &hydro::Hydro::ClearRecv, phyd, id.hyd_csend);
 
@@ -128,7 +162,7 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
     id.rad_flux  = tl["stagen"]->AddTask(&Radiation::CalculateFluxes, this, id.copyu);
     id.rad_sendf = tl["stagen"]->AddTask(&Radiation::SendFlux, this, id.rad_flux);
     id.rad_recvf = tl["stagen"]->AddTask(&Radiation::RecvFlux, this, id.rad_sendf);
-    id.rad_rkupdt= tl["stagen"]->AddTask(&Radiation::RKUpdate, this, id.rad_recvf);
+    id.rad_rkupdt= tl["stagen"]->AddTask(rad_update, this, id.rad_recvf);
     id.rad_src   = tl["stagen"]->AddTask(
                                    &Radiation::AddRadiationSourceTerm,this,id.rad_rkupdt);
     id.rad_resti = tl["stagen"]->AddTask(&Radiation::RestrictI, this, id.rad_src);
@@ -143,6 +177,8 @@ void Radiation::AssembleRadTasks(std::map<std::string, std::shared_ptr<TaskList>
     // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
     // task list anyways to catch potential bugs in MPI communication logic
     id.rad_crecv = tl["after_stagen"]->AddTask(&Radiation::ClearRecv, this, id.rad_csend);
+    id.rad_angres= tl["after_stagen"]->AddTask(
+                              &Radiation::UpdateAngularResolution, this, id.rad_crecv);
   }
 
   return;
@@ -177,18 +213,18 @@ TaskStatus Radiation::InitRecv(Driver *pdrive, int stage) {
 TaskStatus Radiation::CopyCons(Driver *pdrive, int stage) {
   if (stage == 1) {
     // radiation
-    Kokkos::deep_copy(DevExeSpace(), i1, i0);
+    Kokkos::deep_copy(TaskExeSpace(), i1, i0);
 
     // hydro and MHD (if enabled)
     hydro::Hydro *phyd = pmy_pack->phydro;
     mhd::MHD *pmhd = pmy_pack->pmhd;
     if (pmhd != nullptr) {
-      Kokkos::deep_copy(DevExeSpace(), pmhd->u1, pmhd->u0);
-      Kokkos::deep_copy(DevExeSpace(), pmhd->b1.x1f, pmhd->b0.x1f);
-      Kokkos::deep_copy(DevExeSpace(), pmhd->b1.x2f, pmhd->b0.x2f);
-      Kokkos::deep_copy(DevExeSpace(), pmhd->b1.x3f, pmhd->b0.x3f);
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->u1, pmhd->u0);
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x1f, pmhd->b0.x1f);
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x2f, pmhd->b0.x2f);
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x3f, pmhd->b0.x3f);
     } else if (phyd != nullptr) {
-      Kokkos::deep_copy(DevExeSpace(), phyd->u1, phyd->u0);
+      Kokkos::deep_copy(TaskExeSpace(), phyd->u1, phyd->u0);
     }
   }
   return TaskStatus::complete;
@@ -227,6 +263,8 @@ TaskStatus Radiation::RecvFlux(Driver *pdrive, int stage) {
 //! \brief Wrapper task list function to restrict conserved vars
 
 TaskStatus Radiation::RestrictI(Driver *pdrive, int stage) {
+  // fill all angles on MeshBlocks with reduced angular resolution before communication
+  ProlongateAngles();
   // Only execute Mesh function with SMR/AMR
   if (pmy_pack->pmesh->multilevel) {
     pmy_pack->pmesh->pmr->RestrictCC(i0, coarse_i0);
@@ -59,8 +59,15 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
   auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
   Real &n_0_floor_ = n_0_floor;
 
-  par_for("r_update",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+  // only representative angles are updated on MeshBlocks with reduced angular resolution
+  bool &angular_adapt_ = angular_adapt;
+  auto &ang_reduced_ = ang_reduced;
+  auto &ang_is_rep_ = ang_is_rep;
+
+  par_for("r_update",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+    if (angular_adapt_ && ang_reduced_.d_view(m) && !(ang_is_rep_.d_view(n))) return;
+
     // spatial fluxes
     Real divf_s = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
     if (multi_d) {
@@ -89,8 +96,8 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
     }
   });
 
-  // add beam source term, if any
-  if (psrc->beam)  psrc->BeamSource(i0_, beta_dt);
+  // add beam source term, if any (emitted at the reduced speed of light)
+  if (psrc->beam)  psrc->BeamSource(i0_, reduced_c*beta_dt);
 
   return TaskStatus::complete;
 }
@@ -0,0 +1,169 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1.cpp
+//! \brief implementation of RadiationM1 class constructor and assorted other functions.
+//! The grey M1 scheme evolves only the energy density and flux of the radiation field,
+//! closing the moment equations with an analytic Eddington factor, so that its cost is
+//! independent of the angular resolution required by the Radiation module.
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "coordinates/coordinates.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "bvals/bvals.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+
+namespace radiation_m1 {
+//----------------------------------------------------------------------------------------
+// constructor, initializes data structures and parameters
+
+RadiationM1::RadiationM1(MeshBlockPack *ppack, ParameterInput *pin) :
+    pmy_pack(ppack),
+    u0("m1_cons",1,1,1,1,1),
+    coarse_u0("m1_ccons",1,1,1,1,1),
+    u1("m1_cons1",1,1,1,1,1),
+    uflx("m1_uflx",1,1,1,1,1) {
+  // M1 fluxes and source terms are written for flat spacetime only
+  if (pmy_pack->pcoord->is_general_relativistic) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "<radiation_m1> is only implemented in flat spacetime, use the "
+      << "<radiation> module with general relativity" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // Check for AMR and exit if enabled.
+  // TODO(@user): Extend AMR and load balancing to work with M1 radiation
+  if (pmy_pack->pmesh->adaptive) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "M1 radiation does not yet work with AMR" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // Check for hydrodynamics and mhd
+  is_hydro_enabled = pin->DoesBlockExist("hydro");
+  is_mhd_enabled = pin->DoesBlockExist("mhd");
+  if (is_hydro_enabled && is_mhd_enabled) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "M1 radiation does not support two fluid calculations, yet "
+      << "both <hydro> and <mhd> blocks exist in input file" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if (pin->DoesBlockExist("radiation")) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+      << std::endl << "<radiation> and <radiation_m1> blocks cannot both be used"
+      << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // select closure (default Minerbo)
+  {std::string cl = pin->GetOrAddString("radiation_m1","closure","minerbo");
+  if (cl.compare("minerbo") == 0) {
+    closure = M1_Closure::minerbo;
+  } else if (cl.compare("levermore") == 0) {
+    closure = M1_Closure::levermore;
+  } else {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<radiation_m1> closure = '" << cl << "' not implemented"
+              << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  }
+  e_floor = pin->GetOrAddReal("radiation_m1","e_floor",1.0e-20);
+
+  // Enable coupling to fluid by default if hydro or mhd enabled.  Opacities and the
+  // radiation constant are in code units (with the speed of light c=1).
+  if (is_hydro_enabled || is_mhd_enabled) {
+    rad_source = pin->GetOrAddBoolean("radiation_m1","rad_source",true);
+  } else {
+    rad_source = false;
+  }
+  kappa_a = 0.0;
+  kappa_s = 0.0;
+  if (rad_source) {
+    kappa_a = pin->GetReal("radiation_m1","kappa_a");
+    kappa_s = pin->GetReal("radiation_m1","kappa_s");
+    arad = pin->GetReal("radiation_m1","arad");
+    affect_fluid = pin->GetOrAddBoolean("radiation_m1","affect_fluid",true);
+    // gas temperature requires an ideal gas EOS
+    bool is_ideal = (is_hydro_enabled)? ppack->phydro->peos->eos_data.is_ideal :
+                                        ppack->pmhd->peos->eos_data.is_ideal;
+    if (!(is_ideal)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "M1 radiation source terms require an ideal gas EOS"
+        << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  fixed_fluid = pin->GetOrAddBoolean("radiation_m1","fixed_fluid",false);
+  thick_correction = pin->GetOrAddBoolean("radiation_m1","thick_correction",rad_source);
+
+  // (1) read time-evolution option [already error checked in driver constructor]
+  std::string evolution_t = pin->GetString("time","evolution");
+
+  // allocate memory for moments.  With AMR, maximum size of Views are limited by total
+  // device memory through an input parameter, which in turn limits max number of MBs.
+  int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  {
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    Kokkos::realloc(u0, nmb, NM1VAR, ncells3, ncells2, ncells1);
+  }
+
+  // allocate memory for moments on coarse mesh
+  if (ppack->pmesh->multilevel) {
+    int n_ccells1 = indcs.cnx1 + 2*(indcs.ng);
+    int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
+    int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
+    Kokkos::realloc(coarse_u0, nmb, NM1VAR, n_ccells3, n_ccells2, n_ccells1);
+  }
+
+  // allocate boundary buffers for moments (cell-centered variables)
+  pbval_u = new MeshBoundaryValuesCC(ppack, pin, false);
+  pbval_u->InitializeBuffers(NM1VAR);
+
+  // for time-evolving problems, continue to construct methods, allocate arrays
+  if (evolution_t.compare("stationary") != 0) {
+    // select reconstruction method (default PLM)
+    std::string xorder = pin->GetOrAddString("radiation_m1","reconstruct","plm");
+    if (xorder.compare("dc") == 0) {
+      recon_method = ReconstructionMethod::dc;
+    } else if (xorder.compare("plm") == 0) {
+      recon_method = ReconstructionMethod::plm;
+    } else {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<radiation_m1> reconstruct = '" << xorder
+                << "' not implemented" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+
+    // allocate second registers, fluxes
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    Kokkos::realloc(u1,       nmb, NM1VAR, ncells3, ncells2, ncells1);
+    Kokkos::realloc(uflx.x1f, nmb, NM1VAR, ncells3, ncells2, ncells1);
+    Kokkos::realloc(uflx.x2f, nmb, NM1VAR, ncells3, ncells2, ncells1);
+    Kokkos::realloc(uflx.x3f, nmb, NM1VAR, ncells3, ncells2, ncells1);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+// destructor
+
+RadiationM1::~RadiationM1() {
+  delete pbval_u;
+}
+
+} // namespace radiation_m1
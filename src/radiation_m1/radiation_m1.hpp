@@ -0,0 +1,148 @@
+#ifndef RADIATION_M1_RADIATION_M1_HPP_
+#define RADIATION_M1_RADIATION_M1_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1.hpp
+//  \brief definitions for RadiationM1 class, which evolves the grey radiation energy
+//  density and flux (the first two moments of the intensity) using the M1 closure
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "tasklist/task_list.hpp"
+#include "bvals/bvals.hpp"
+
+// forward declarations
+class Driver;
+
+// constants that enumerate M1 closure options
+enum class M1_Closure {minerbo, levermore};
+
+//----------------------------------------------------------------------------------------
+//! \struct RadiationM1TaskIDs
+//  \brief container to hold TaskIDs of all M1 radiation tasks
+
+struct RadiationM1TaskIDs {
+  TaskID rad_irecv;
+  TaskID mhd_irecv;
+  TaskID hyd_irecv;
+  TaskID copyu;
+  TaskID rad_flux;
+  TaskID mhd_flux;
+  TaskID hyd_flux;
+  TaskID rad_sendf;
+  TaskID mhd_sendf;
+  TaskID hyd_sendf;
+  TaskID rad_recvf;
+  TaskID mhd_recvf;
+  TaskID hyd_recvf;
+  TaskID rad_rkupdt;
+  TaskID mhd_rkupdt;
+  TaskID hyd_rkupdt;
+  TaskID rad_src;
+  TaskID mhd_efld;
+  TaskID mhd_sende;
+  TaskID mhd_recve;
+  TaskID mhd_ct;
+  TaskID rad_restu;
+  TaskID mhd_restu;
+  TaskID hyd_restu;
+  TaskID rad_sendu;
+  TaskID mhd_sendu;
+  TaskID hyd_sendu;
+  TaskID rad_recvu;
+  TaskID mhd_recvu;
+  TaskID hyd_recvu;
+  TaskID mhd_restb;
+  TaskID mhd_sendb;
+  TaskID mhd_recvb;
+  TaskID bcs;
+  TaskID rad_prol;
+  TaskID mhd_prol;
+  TaskID hyd_prol;
+  TaskID mhd_c2p;
+  TaskID hyd_c2p;
+  TaskID rad_csend;
+  TaskID mhd_csend;
+  TaskID hyd_csend;
+  TaskID rad_crecv;
+  TaskID mhd_crecv;
+  TaskID hyd_crecv;
+};
+
+namespace radiation_m1 {
+
+//----------------------------------------------------------------------------------------
+//! \class RadiationM1
+
+class RadiationM1 {
+ public:
+  RadiationM1(MeshBlockPack *ppack, ParameterInput *pin);
+  ~RadiationM1();
+
+  // flags to denote hydro/mhd is enabled
+  bool is_hydro_enabled;
+  bool is_mhd_enabled;
+
+  // closure and source term parameters
+  M1_Closure closure;       // closure used to compute radiation pressure tensor
+  bool rad_source;          // flag to enable/disable coupling to fluid
+  bool fixed_fluid;         // flag to enable/disable fluid integration
+  bool affect_fluid;        // flag to enable/disable feedback of rad field on fluid
+  bool thick_correction;    // flag to reduce numerical diffusion in optically thick gas
+  Real arad;                // radiation constant
+  Real kappa_a;             // constant absorption opacity (per unit mass)
+  Real kappa_s;             // constant scattering opacity (per unit mass)
+  Real e_floor;             // floor on radiation energy density
+
+  // radiation moments: energy density (IER) and flux (IFX,IFY,IFZ), in units with c=1
+  DvceArray5D<Real> u0;
+  DvceArray5D<Real> coarse_u0;  // moments on 2x coarser grid (for SMR/AMR)
+
+  // Boundary communication buffers and functions for u
+  MeshBoundaryValuesCC *pbval_u;
+
+  // following only used for time-evolving flow
+  DvceArray5D<Real> u1;         // moments at intermediate step
+  DvceFaceFld5D<Real> uflx;     // fluxes of moments on cell faces
+  Real dtnew;
+
+  // reconstruction method
+  ReconstructionMethod recon_method;
+
+  // container to hold names of TaskIDs
+  RadiationM1TaskIDs id;
+
+  // functions...
+  void AssembleRadiationM1Tasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
+  // ...in "before_stagen_tl" task list
+  TaskStatus InitRecv(Driver *d, int stage);
+  // ...in "stagen_tl" task list
+  TaskStatus CopyCons(Driver *d, int stage);
+  TaskStatus CalculateFluxes(Driver *d, int stage);
+  TaskStatus SendFlux(Driver *d, int stage);
+  TaskStatus RecvFlux(Driver *d, int stage);
+  TaskStatus RKUpdate(Driver *d, int stage);
+  TaskStatus AddRadiationSourceTerm(Driver *d, int stage);
+  TaskStatus RestrictU(Driver *d, int stage);
+  TaskStatus SendU(Driver *d, int stage);
+  TaskStatus RecvU(Driver *d, int stage);
+  TaskStatus ApplyPhysicalBCs(Driver* pdrive, int stage);
+  TaskStatus Prolongate(Driver* pdrive, int stage);
+  TaskStatus NewTimeStep(Driver *d, int stage);
+  // ...in "after_stagen_tl" task list
+  TaskStatus ClearSend(Driver *d, int stage);
+  TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
+
+ private:
+  MeshBlockPack* pmy_pack;  // ptr to MeshBlockPack containing this RadiationM1
+};
+
+} // namespace radiation_m1
+#endif // RADIATION_M1_RADIATION_M1_HPP_
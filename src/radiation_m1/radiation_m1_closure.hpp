@@ -0,0 +1,72 @@
+#ifndef RADIATION_M1_RADIATION_M1_CLOSURE_HPP_
+#define RADIATION_M1_RADIATION_M1_CLOSURE_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1_closure.hpp
+//! \brief implements the M1 closure and the fluxes of the radiation moments as inline
+//! functions.  All moments are in units with c=1.
+
+#include <math.h>
+
+#include "athena.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn Real EddingtonFactor
+//! \brief returns the Eddington factor chi for reduced flux f=|F|/E in [0,1], using
+//! either the Minerbo (maximum entropy for a classical gas) or Levermore closure.
+
+KOKKOS_INLINE_FUNCTION
+Real EddingtonFactor(const M1_Closure closure, const Real f) {
+  if (closure == M1_Closure::levermore) {
+    return (3.0 + 4.0*f*f)/(5.0 + 2.0*sqrt(4.0 - 3.0*f*f));
+  }
+  return 1.0/3.0 + f*f*(6.0 - 2.0*f + 6.0*f*f)/15.0;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void M1Flux
+//! \brief computes flux in direction ivx (IVX, IVY, or IVZ) of the radiation moments,
+//! flx[IER] = F_d and flx[IFX+i] = P_{i d}, where the pressure tensor is
+//!   P_ij = E [(1-chi)/2 delta_ij + (3 chi-1)/2 n_i n_j]
+//! with n the unit vector along F.
+
+KOKKOS_INLINE_FUNCTION
+void M1Flux(const M1_Closure closure, const int ivx, const Real e, const Real f[3],
+            Real flx[4]) {
+  Real fmag = sqrt(SQR(f[0]) + SQR(f[1]) + SQR(f[2]));
+  Real fred = fmin(fmag/e, 1.0);
+  Real chi = EddingtonFactor(closure, fred);
+  Real thin = 0.5*(3.0*chi - 1.0);
+  Real thick = 0.5*(1.0 - chi);
+  int d = ivx - IVX;
+  Real nd = (fmag > 0.0)? f[d]/fmag : 0.0;
+  flx[IER] = f[d];
+  for (int i=0; i<3; ++i) {
+    Real ni = (fmag > 0.0)? f[i]/fmag : 0.0;
+    flx[IFX+i] = e*(thin*ni*nd + ((i == d)? thick : 0.0));
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void M1Realizable
+//! \brief applies floor to energy density and limits flux so that |F| <= E.
+
+KOKKOS_INLINE_FUNCTION
+void M1Realizable(const Real e_floor, Real &e, Real f[3]) {
+  e = fmax(e, e_floor);
+  Real fmag = sqrt(SQR(f[0]) + SQR(f[1]) + SQR(f[2]));
+  if (fmag > e) {
+    Real fac = e/fmag;
+    f[0] *= fac;
+    f[1] *= fac;
+    f[2] *= fac;
+  }
+  return;
+}
+
+#endif // RADIATION_M1_RADIATION_M1_CLOSURE_HPP_
@@ -0,0 +1,221 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1_fluxes.cpp
+//! \brief Calculate 3D fluxes of the M1 radiation moments
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "reconstruct/dc.hpp"
+#include "reconstruct/plm.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+#include "radiation_m1/radiation_m1_closure.hpp"
+
+namespace radiation_m1 {
+//----------------------------------------------------------------------------------------
+//! \fn void LLF_M1
+//! \brief LLF Riemann solver for the M1 moment equations, using the speed of light as
+//! the maximum signal speed.  The numerical diffusion is reduced by eps=min(1,1/tau) in
+//! cells with optical depth tau=dx*sigma_tot>1 at the interface, so that the diffusion
+//! limit is recovered in optically thick gas (e.g. Audit et al. 2002).  Density needed
+//! for tau is only read from w0 if kappa_tot>0.
+
+KOKKOS_INLINE_FUNCTION
+void LLF_M1(TeamMember_t const &member, const M1_Closure closure, const Real e_floor,
+     const int m, const int k, const int j, const int il, const int iu, const int ivx,
+     const ScrArray2D<Real> &ql, const ScrArray2D<Real> &qr,
+     const DvceArray5D<Real> &w0, const Real kappa_tot, const Real dx,
+     DvceArray5D<Real> flx) {
+  par_for_inner(member, il, iu, [&](const int i) {
+    Real el = ql(IER,i), er = qr(IER,i);
+    Real fl[3] = {ql(IFX,i), ql(IFY,i), ql(IFZ,i)};
+    Real fr[3] = {qr(IFX,i), qr(IFY,i), qr(IFZ,i)};
+    M1Realizable(e_floor, el, fl);
+    M1Realizable(e_floor, er, fr);
+
+    Real flxl[4], flxr[4];
+    M1Flux(closure, ivx, el, fl, flxl);
+    M1Flux(closure, ivx, er, fr, flxr);
+
+    Real eps = 1.0;
+    if (kappa_tot > 0.0) {
+      // cells on either side of face i in direction ivx
+      int im1 = (ivx == IVX)? i-1 : i;
+      int jm1 = (ivx == IVY)? j-1 : j;
+      int km1 = (ivx == IVZ)? k-1 : k;
+      Real tau = 0.5*(w0(m,IDN,k,j,i) + w0(m,IDN,km1,jm1,im1))*kappa_tot*dx;
+      eps = fmin(1.0, 1.0/fmax(tau, 1.0e-20));
+    }
+
+    flx(m,IER,k,j,i) = 0.5*(flxl[IER] + flxr[IER]) - 0.5*eps*(er - el);
+    for (int n=0; n<3; ++n) {
+      flx(m,IFX+n,k,j,i) = 0.5*(flxl[IFX+n] + flxr[IFX+n]) - 0.5*eps*(fr[n] - fl[n]);
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RadiationM1::CalculateFluxes
+//! \brief Calls reconstruction and Riemann solver functions to compute fluxes of M1
+//! radiation moments
+
+TaskStatus RadiationM1::CalculateFluxes(Driver *pdriver, int stage) {
+  RegionIndcs &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto recon_method_ = recon_method;
+  auto closure_ = closure;
+  Real e_floor_ = e_floor;
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &u0_ = u0;
+
+  // opacity used to reduce numerical diffusion in optically thick gas
+  Real kappa_tot = 0.0;
+  DvceArray5D<Real> w0_;
+  if (thick_correction) {
+    kappa_tot = kappa_a + kappa_s;
+    if (is_hydro_enabled) {
+      w0_ = pmy_pack->phydro->w0;
+    } else if (is_mhd_enabled) {
+      w0_ = pmy_pack->pmhd->w0;
+    } else {
+      kappa_tot = 0.0;
+    }
+  }
+
+  //--------------------------------------------------------------------------------------
+  // i-direction
+
+  size_t scr_size = ScrArray2D<Real>::shmem_size(NM1VAR, ncells1) * 2;
+  int scr_level = 0;
+  auto &flx1_ = uflx.x1f;
+
+  par_for_outer("m1flux_x1",TaskExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke, js, je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k, const int j) {
+    ScrArray2D<Real> ql(member.team_scratch(scr_level), NM1VAR, ncells1);
+    ScrArray2D<Real> qr(member.team_scratch(scr_level), NM1VAR, ncells1);
+
+    // Reconstruct qR[i] and qL[i+1]
+    switch (recon_method_) {
+      case ReconstructionMethod::dc:
+        DonorCellX1(member, m, k, j, is-1, ie+1, u0_, ql, qr);
+        break;
+      case ReconstructionMethod::plm:
+        PiecewiseLinearX1(member, m, k, j, is-1, ie+1, u0_, ql, qr);
+        break;
+      default:
+        break;
+    }
+    // Sync all threads in the team so that scratch memory is consistent
+    member.team_barrier();
+
+    // compute fluxes over [is,ie+1]
+    LLF_M1(member, closure_, e_floor_, m, k, j, is, ie+1, IVX, ql, qr, w0_, kappa_tot,
+           size.d_view(m).dx1, flx1_);
+  });
+
+  //--------------------------------------------------------------------------------------
+  // j-direction
+
+  if (pmy_pack->pmesh->multi_d) {
+    scr_size = ScrArray2D<Real>::shmem_size(NM1VAR, ncells1) * 3;
+    auto &flx2_ = uflx.x2f;
+
+    par_for_outer("m1flux_x2",TaskExeSpace(), scr_size, scr_level, 0, nmb1, ks, ke,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int k) {
+      ScrArray2D<Real> scr1(member.team_scratch(scr_level), NM1VAR, ncells1);
+      ScrArray2D<Real> scr2(member.team_scratch(scr_level), NM1VAR, ncells1);
+      ScrArray2D<Real> scr3(member.team_scratch(scr_level), NM1VAR, ncells1);
+
+      for (int j=js-1; j<=je+1; ++j) {
+        // Permute scratch arrays.
+        auto ql     = scr1;
+        auto ql_jp1 = scr2;
+        auto qr     = scr3;
+        if ((j%2) == 0) {
+          ql     = scr2;
+          ql_jp1 = scr1;
+        }
+
+        // Reconstruct qR[j] and qL[j+1]
+        switch (recon_method_) {
+          case ReconstructionMethod::dc:
+            DonorCellX2(member, m, k, j, is, ie, u0_, ql_jp1, qr);
+            break;
+          case ReconstructionMethod::plm:
+            PiecewiseLinearX2(member, m, k, j, is, ie, u0_, ql_jp1, qr);
+            break;
+          default:
+            break;
+        }
+        member.team_barrier();
+
+        // compute fluxes over [js,je+1]
+        if (j>(js-1)) {
+          LLF_M1(member, closure_, e_floor_, m, k, j, is, ie, IVY, ql, qr, w0_,
+                 kappa_tot, size.d_view(m).dx2, flx2_);
+          member.team_barrier();
+        }
+      } // end of loop over j
+    });
+  }
+
+  //--------------------------------------------------------------------------------------
+  // k-direction. Note order of k,j loops switched
+
+  if (pmy_pack->pmesh->three_d) {
+    scr_size = ScrArray2D<Real>::shmem_size(NM1VAR, ncells1) * 3;
+    auto &flx3_ = uflx.x3f;
+
+    par_for_outer("m1flux_x3",TaskExeSpace(), scr_size, scr_level, 0, nmb1, js, je,
+    KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
+      ScrArray2D<Real> scr1(member.team_scratch(scr_level), NM1VAR, ncells1);
+      ScrArray2D<Real> scr2(member.team_scratch(scr_level), NM1VAR, ncells1);
+      ScrArray2D<Real> scr3(member.team_scratch(scr_level), NM1VAR, ncells1);
+
+      for (int k=ks-1; k<=ke+1; ++k) {
+        // Permute scratch arrays.
+        auto ql     = scr1;
+        auto ql_kp1 = scr2;
+        auto qr     = scr3;
+        if ((k%2) == 0) {
+          ql     = scr2;
+          ql_kp1 = scr1;
+        }
+
+        // Reconstruct qR[k] and qL[k+1]
+        switch (recon_method_) {
+          case ReconstructionMethod::dc:
+            DonorCellX3(member, m, k, j, is, ie, u0_, ql_kp1, qr);
+            break;
+          case ReconstructionMethod::plm:
+            PiecewiseLinearX3(member, m, k, j, is, ie, u0_, ql_kp1, qr);
+            break;
+          default:
+            break;
+        }
+        member.team_barrier();
+
+        // compute fluxes over [ks,ke+1]
+        if (k>(ks-1)) {
+          LLF_M1(member, closure_, e_floor_, m, k, j, is, ie, IVZ, ql, qr, w0_,
+                 kappa_tot, size.d_view(m).dx3, flx3_);
+          member.team_barrier();
+        }
+      } // end of loop over k
+    });
+  }
+  return TaskStatus::complete;
+}
+
+} // namespace radiation_m1
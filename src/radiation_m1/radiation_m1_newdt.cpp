@@ -0,0 +1,40 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1_newdt.cpp
+//! \brief function to compute M1 radiation timestep across all MeshBlock(s) in a
+//! MeshBlockPack
+
+#include <algorithm> // min
+#include <limits>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+
+namespace radiation_m1 {
+
+//----------------------------------------------------------------------------------------
+// \!fn void RadiationM1::NewTimeStep()
+// \brief calculate the minimum timestep within a MeshBlockPack for M1 radiation.  Since
+//        all signals propagate at (most) the speed of light c=1, the timestep is the
+//        light-crossing time of the smallest cell, which only depends on the mesh.
+
+TaskStatus RadiationM1::NewTimeStep(Driver *pdriver, int stage) {
+  if (stage != (pdriver->nexp_stages)) {
+    return TaskStatus::complete; // only execute last stage
+  }
+
+  auto &size = pmy_pack->pmb->mb_size;
+  dtnew = std::numeric_limits<float>::max();
+  for (int m=0; m<(pmy_pack->nmb_thispack); ++m) {
+    dtnew = std::min(dtnew, size.h_view(m).dx1);
+    if (pmy_pack->pmesh->multi_d) { dtnew = std::min(dtnew, size.h_view(m).dx2); }
+    if (pmy_pack->pmesh->three_d) { dtnew = std::min(dtnew, size.h_view(m).dx3); }
+  }
+  return TaskStatus::complete;
+}
+} // namespace radiation_m1
@@ -0,0 +1,122 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1_source.cpp
+//! \brief implicit coupling of M1 radiation moments to the fluid through absorption,
+//! emission, and scattering
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+#include "radiation_m1/radiation_m1_closure.hpp"
+
+namespace radiation_m1 {
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::AddRadiationSourceTerm(Driver *pdriver, int stage)
+//! \brief Add stiff radiation source terms implicitly (backward Euler) over the partial
+//! time step of each stage.  With sigma_a=rho*kappa_a and sigma_s=rho*kappa_s, the
+//! moments and gas temperature T=P/rho satisfy
+//!   E' = (E + dt sigma_a a T'^4)/(1 + dt sigma_a)
+//!   F' = F/(1 + dt (sigma_a + sigma_s))
+//! with T' fixed by conservation of total energy, which gives a quartic in T' that is
+//! solved by Newton iteration.  The changes in E and F are then removed from the total
+//! energy and momentum of the fluid.  Source terms are evaluated in the rest frame of
+//! the fluid, i.e. O(v/c) terms are neglected.
+
+TaskStatus RadiationM1::AddRadiationSourceTerm(Driver *pdriver, int stage) {
+  // Return if radiation source term disabled
+  if (!(rad_source)) {
+    return TaskStatus::complete;
+  }
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &ie = indcs.ie;
+  int &js = indcs.js, &je = indcs.je;
+  int &ks = indcs.ks, &ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+
+  // Extract fluid quantities
+  Real gm1;
+  DvceArray5D<Real> u0_, w0_;
+  if (is_hydro_enabled) {
+    gm1 = pmy_pack->phydro->peos->eos_data.gamma - 1.0;
+    u0_ = pmy_pack->phydro->u0;
+    w0_ = pmy_pack->phydro->w0;
+  } else {
+    gm1 = pmy_pack->pmhd->peos->eos_data.gamma - 1.0;
+    u0_ = pmy_pack->pmhd->u0;
+    w0_ = pmy_pack->pmhd->w0;
+  }
+
+  // Call ConsToPrim over active zones prior to source term application
+  if (!(fixed_fluid)) {
+    if (is_hydro_enabled) {
+      pmy_pack->phydro->peos->ConsToPrim(u0_,w0_,false,is,ie,js,je,ks,ke);
+    } else {
+      auto &b0_ = pmy_pack->pmhd->b0;
+      auto &bcc0_ = pmy_pack->pmhd->bcc0;
+      pmy_pack->pmhd->peos->ConsToPrim(u0_,b0_,w0_,bcc0_,false,is,ie,js,je,ks,ke);
+    }
+  }
+
+  Real dt_ = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  Real arad_ = arad;
+  Real kappa_a_ = kappa_a;
+  Real kappa_s_ = kappa_s;
+  Real e_floor_ = e_floor;
+  bool update_fluid = (affect_fluid && !(fixed_fluid));
+  auto &r0_ = u0;
+
+  par_for("m1_source",TaskExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real wdn = w0_(m,IDN,k,j,i);
+    Real tgas = gm1*w0_(m,IEN,k,j,i)/wdn;
+    Real dtsiga = dt_*wdn*kappa_a_;
+    Real dtsigt = dt_*wdn*(kappa_a_ + kappa_s_);
+
+    // solve coef4*T^4 + T = tconst for new gas temperature.  Function is convex and
+    // increasing, so Newton iteration from an upper bound converges monotonically.
+    Real e_old = r0_(m,IER,k,j,i);
+    Real coef4 = dtsiga*arad_*gm1/((1.0 + dtsiga)*wdn);
+    Real tconst = tgas + gm1*e_old*dtsiga/((1.0 + dtsiga)*wdn);
+    Real tnew = tconst;
+    if (coef4 > 0.0) {
+      tnew = fmin(tconst, sqrt(sqrt(tconst/coef4)));
+      for (int iter=0; iter<50; ++iter) {
+        Real t3 = tnew*tnew*tnew;
+        Real dt = (coef4*t3*tnew + tnew - tconst)/(4.0*coef4*t3 + 1.0);
+        tnew -= dt;
+        if (fabs(dt) <= 1.0e-12*tnew) break;
+      }
+    }
+    if (!(isfinite(tnew)) || tnew <= 0.0) {tnew = tgas;}
+
+    // update moments
+    Real e_new = (e_old + dtsiga*arad_*SQR(SQR(tnew)))/(1.0 + dtsiga);
+    Real f_old[3] = {r0_(m,IFX,k,j,i), r0_(m,IFY,k,j,i), r0_(m,IFZ,k,j,i)};
+    Real f_new[3];
+    for (int n=0; n<3; ++n) {f_new[n] = f_old[n]/(1.0 + dtsigt);}
+    M1Realizable(e_floor_, e_new, f_new);
+    r0_(m,IER,k,j,i) = e_new;
+    r0_(m,IFX,k,j,i) = f_new[0];
+    r0_(m,IFY,k,j,i) = f_new[1];
+    r0_(m,IFZ,k,j,i) = f_new[2];
+
+    // feedback on fluid: conserve total energy and momentum
+    if (update_fluid) {
+      u0_(m,IEN,k,j,i) -= (e_new - e_old);
+      u0_(m,IM1,k,j,i) -= (f_new[0] - f_old[0]);
+      u0_(m,IM2,k,j,i) -= (f_new[1] - f_old[1]);
+      u0_(m,IM3,k,j,i) -= (f_new[2] - f_old[2]);
+    }
+  });
+  return TaskStatus::complete;
+}
+
+} // namespace radiation_m1
@@ -0,0 +1,373 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1_tasks.cpp
+//! \brief functions that control M1 radiation tasks stored in tasklists in MeshBlockPack
+
+#include <map>
+#include <memory>
+#include <string>
+#include <iostream>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "tasklist/task_list.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "bvals/bvals.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+
+namespace radiation_m1 {
+//----------------------------------------------------------------------------------------
+//! \fn  void RadiationM1::AssembleRadiationM1Tasks
+//! \brief Adds M1 radiation tasks to appropriate task lists used by time integrators.
+//! Called by MeshBlockPack::AddPhysics() function directly after RadiationM1 constructor
+
+void RadiationM1::AssembleRadiationM1Tasks(
+    std::map<std::string, std::shared_ptr<TaskList>> tl) {
+  TaskID none(0);
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+
+  // construct task list depending on enabled physics modules and radiation parameters
+  if (pmhd != nullptr && !(fixed_fluid)) {  // radiation magnetohydrodynamics
+    // assemble "before_stagen" task list
+    id.rad_irecv = tl["before_stagen"]->AddTask(&RadiationM1::InitRecv, this, none);
+    id.mhd_irecv = tl["before_stagen"]->AddTask(&mhd::MHD::InitRecv, pmhd, none);
+
+    // assemble "stagen" task list
+    id.copyu     = tl["stagen"]->AddTask(&RadiationM1::CopyCons, this, none);
+    id.rad_flux  = tl["stagen"]->AddTask(
+                                      &RadiationM1::CalculateFluxes, this, id.copyu);
+    id.rad_sendf = tl["stagen"]->AddTask(&RadiationM1::SendFlux, this, id.rad_flux);
+    id.rad_recvf = tl["stagen"]->AddTask(&RadiationM1::RecvFlux, this, id.rad_sendf);
+    id.rad_rkupdt= tl["stagen"]->AddTask(&RadiationM1::RKUpdate, this, id.rad_recvf);
+    id.mhd_flux  = tl["stagen"]->AddTask(&mhd::MHD::Fluxes, pmhd, id.copyu);
+    id.mhd_sendf = tl["stagen"]->AddTask(&mhd::MHD::SendFlux, pmhd, id.mhd_flux);
+    id.mhd_recvf = tl["stagen"]->AddTask(&mhd::MHD::RecvFlux, pmhd, id.mhd_sendf);
+    id.mhd_rkupdt= tl["stagen"]->AddTask(&mhd::MHD::RKUpdate, pmhd, id.mhd_recvf);
+    id.mhd_efld  = tl["stagen"]->AddTask(&mhd::MHD::CornerE, pmhd, id.mhd_rkupdt);
+    id.mhd_sende = tl["stagen"]->AddTask(&mhd::MHD::SendE, pmhd, id.mhd_efld);
+    id.mhd_recve = tl["stagen"]->AddTask(&mhd::MHD::RecvE, pmhd, id.mhd_sende);
+    id.mhd_ct    = tl["stagen"]->AddTask(&mhd::MHD::CT, pmhd, id.mhd_recve);
+    TaskID rad_mhd_updt = (id.rad_rkupdt | id.mhd_ct);
+    id.rad_src   = tl["stagen"]->AddTask(
+                                &RadiationM1::AddRadiationSourceTerm,this,rad_mhd_updt);
+    id.rad_restu = tl["stagen"]->AddTask(&RadiationM1::RestrictU, this, id.rad_src);
+    id.rad_sendu = tl["stagen"]->AddTask(&RadiationM1::SendU, this, id.rad_restu);
+    id.rad_recvu = tl["stagen"]->AddTask(&RadiationM1::RecvU, this, id.rad_sendu);
+    id.mhd_restu = tl["stagen"]->AddTask(&mhd::MHD::RestrictU, pmhd, id.rad_src);
+    id.mhd_sendu = tl["stagen"]->AddTask(&mhd::MHD::SendU, pmhd, id.mhd_restu);
+    id.mhd_recvu = tl["stagen"]->AddTask(&mhd::MHD::RecvU, pmhd, id.mhd_sendu);
+    id.mhd_restb = tl["stagen"]->AddTask(&mhd::MHD::RestrictB, pmhd, id.mhd_recvu);
+    id.mhd_sendb = tl["stagen"]->AddTask(&mhd::MHD::SendB, pmhd, id.mhd_restb);
+    id.mhd_recvb = tl["stagen"]->AddTask(&mhd::MHD::RecvB, pmhd, id.mhd_sendb);
+    TaskID rad_mhd_recv = (id.rad_recvu | id.mhd_recvb);
+    id.bcs       = tl["stagen"]->AddTask(
+                               &RadiationM1::ApplyPhysicalBCs, this, rad_mhd_recv);
+    id.rad_prol  = tl["stagen"]->AddTask(&RadiationM1::Prolongate, this, id.bcs);
+    id.mhd_prol  = tl["stagen"]->AddTask(&mhd::MHD::Prolongate, pmhd, id.rad_prol);
+    id.mhd_c2p   = tl["stagen"]->AddTask(&mhd::MHD::ConToPrim, pmhd, id.mhd_prol);
+
+    // radiation and MHD updates are independent until the source terms are added, as are
+    // their boundary communications after it, so run them on separate execution space
+    // instances (if available)
+    TaskID rad_tasks[] = {id.rad_flux, id.rad_sendf, id.rad_recvf, id.rad_rkupdt,
+                          id.rad_restu, id.rad_sendu, id.rad_recvu};
+    TaskID mhd_tasks[] = {id.mhd_flux, id.mhd_sendf, id.mhd_recvf, id.mhd_rkupdt,
+                          id.mhd_efld, id.mhd_sende, id.mhd_recve, id.mhd_ct,
+                          id.mhd_restu, id.mhd_sendu, id.mhd_recvu,
+                          id.mhd_restb, id.mhd_sendb, id.mhd_recvb};
+    for (auto &tid : rad_tasks) {tl["stagen"]->SetInstance(tid, 0);}
+    for (auto &tid : mhd_tasks) {tl["stagen"]->SetInstance(tid, 1);}
+
+    // assemble "after_stagen" task list
+    id.rad_csend = tl["after_stagen"]->AddTask(&RadiationM1::ClearSend, this, none);
+    id.mhd_csend = tl["after_stagen"]->AddTask(&mhd::MHD::ClearSend, pmhd, none);
+    // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
+    // task list anyways to catch potential bugs in MPI communication logic
+    id.rad_crecv = tl["after_stagen"]->AddTask(
+                                        &RadiationM1::ClearRecv, this, id.rad_csend);
+    id.mhd_crecv = tl["after_stagen"]->AddTask(
+                                          &mhd::MHD::ClearRecv, pmhd, id.mhd_csend);
+
+  } else if (phyd != nullptr && !(fixed_fluid)) {  // radiation hydrodynamics
+    // assemble "before_stagen" task list
+    id.rad_irecv = tl["before_stagen"]->AddTask(&RadiationM1::InitRecv, this, none);
+    id.hyd_irecv = tl["before_stagen"]->AddTask(&hydro::Hydro::InitRecv, phyd, none);
+
+    // assemble "stagen" task list
+    id.copyu     = tl["stagen"]->AddTask(&RadiationM1::CopyCons, this, none);
+    id.rad_flux  = tl["stagen"]->AddTask(
+                                      &RadiationM1::CalculateFluxes, this, id.copyu);
+    id.rad_sendf = tl["stagen"]->AddTask(&RadiationM1::SendFlux, this, id.rad_flux);
+    id.rad_recvf = tl["stagen"]->AddTask(&RadiationM1::RecvFlux, this, id.rad_sendf);
+    id.rad_rkupdt= tl["stagen"]->AddTask(&RadiationM1::RKUpdate, this, id.rad_recvf);
+    id.hyd_flux  = tl["stagen"]->AddTask(&hydro::Hydro::Fluxes, phyd, id.copyu);
+    id.hyd_sendf = tl["stagen"]->AddTask(&hydro::Hydro::SendFlux, phyd, id.hyd_flux);
+    id.hyd_recvf = tl["stagen"]->AddTask(&hydro::Hydro::RecvFlux, phyd, id.hyd_sendf);
+    id.hyd_rkupdt= tl["stagen"]->AddTask(&hydro::Hydro::RKUpdate,phyd,id.hyd_recvf);
+    TaskID rad_hyd_updt = (id.rad_rkupdt | id.hyd_rkupdt);
+    id.rad_src   = tl["stagen"]->AddTask(
+                                &RadiationM1::AddRadiationSourceTerm,this,rad_hyd_updt);
+    id.rad_restu = tl["stagen"]->AddTask(&RadiationM1::RestrictU, this, id.rad_src);
+    id.rad_sendu = tl["stagen"]->AddTask(&RadiationM1::SendU, this, id.rad_restu);
+    id.rad_recvu = tl["stagen"]->AddTask(&RadiationM1::RecvU, this, id.rad_sendu);
+    id.hyd_restu = tl["stagen"]->AddTask(&hydro::Hydro::RestrictU, phyd, id.rad_src);
+    id.hyd_sendu = tl["stagen"]->AddTask(&hydro::Hydro::SendU, phyd, id.hyd_restu);
+    id.hyd_recvu = tl["stagen"]->AddTask(&hydro::Hydro::RecvU, phyd, id.hyd_sendu);
+    TaskID rad_hyd_recv = (id.rad_recvu | id.hyd_recvu);
+    id.bcs       = tl["stagen"]->AddTask(
+                               &RadiationM1::ApplyPhysicalBCs, this, rad_hyd_recv);
+    id.rad_prol  = tl["stagen"]->AddTask(&RadiationM1::Prolongate, this, id.bcs);
+    id.hyd_prol  = tl["stagen"]->AddTask(&hydro::Hydro::Prolongate, phyd, id.rad_prol);
+    id.hyd_c2p   = tl["stagen"]->AddTask(&hydro::Hydro::ConToPrim, phyd, id.hyd_prol);
+
+    // radiation and hydro updates are independent until the source terms are added, as
+    // are their boundary communications after it, so run them on separate execution
+    // space instances (if available)
+    TaskID rad_tasks[] = {id.rad_flux, id.rad_sendf, id.rad_recvf, id.rad_rkupdt,
+                          id.rad_restu, id.rad_sendu, id.rad_recvu};
+    TaskID hyd_tasks[] = {id.hyd_flux, id.hyd_sendf, id.hyd_recvf, id.hyd_rkupdt,
+                          id.hyd_restu, id.hyd_sendu, id.hyd_recvu};
+    for (auto &tid : rad_tasks) {tl["stagen"]->SetInstance(tid, 0);}
+    for (auto &tid : hyd_tasks) {tl["stagen"]->SetInstance(tid, 1);}
+
+    // assemble "after_stagen" task list
+    // assemble end task list
+    id.rad_csend = tl["after_stagen"]->AddTask(&RadiationM1::ClearSend, this, none);
+    id.hyd_csend = tl["after_stagen"]->AddTask(&hydro::Hydro::ClearSend, phyd, none);
+    // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
+    // task list anyways to catch potential bugs in MPI communication logic
+    id.rad_crecv = tl["after_stagen"]->AddTask(
+                                        &RadiationM1::ClearRecv, this, id.rad_csend);
+    id.hyd_crecv = tl["after_stagen"]->AddTask(
+                                       &hydro::Hydro::ClearRecv, phyd, id.hyd_csend);
+
+  } else {  // radiation transport
+    // assemble "before_stagen" task list
+    id.rad_irecv = tl["before_stagen"]->AddTask(&RadiationM1::InitRecv, this, none);
+
+    // assemble "stagen" task list
+    id.copyu     = tl["stagen"]->AddTask(&RadiationM1::CopyCons, this, none);
+    id.rad_flux  = tl["stagen"]->AddTask(
+                                      &RadiationM1::CalculateFluxes, this, id.copyu);
+    id.rad_sendf = tl["stagen"]->AddTask(&RadiationM1::SendFlux, this, id.rad_flux);
+    id.rad_recvf = tl["stagen"]->AddTask(&RadiationM1::RecvFlux, this, id.rad_sendf);
+    id.rad_rkupdt= tl["stagen"]->AddTask(&RadiationM1::RKUpdate, this, id.rad_recvf);
+    id.rad_src   = tl["stagen"]->AddTask(
+                              &RadiationM1::AddRadiationSourceTerm,this,id.rad_rkupdt);
+    id.rad_restu = tl["stagen"]->AddTask(&RadiationM1::RestrictU, this, id.rad_src);
+    id.rad_sendu = tl["stagen"]->AddTask(&RadiationM1::SendU, this, id.rad_restu);
+    id.rad_recvu = tl["stagen"]->AddTask(&RadiationM1::RecvU, this, id.rad_sendu);
+    id.bcs       = tl["stagen"]->AddTask(
+                                    &RadiationM1::ApplyPhysicalBCs, this, id.rad_recvu);
+    id.rad_prol  = tl["stagen"]->AddTask(&RadiationM1::Prolongate, this, id.bcs);
+
+    // assemble "after_stagen" task list
+    id.rad_csend = tl["after_stagen"]->AddTask(&RadiationM1::ClearSend, this, none);
+    // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
+    // task list anyways to catch potential bugs in MPI communication logic
+    id.rad_crecv = tl["after_stagen"]->AddTask(
+                                        &RadiationM1::ClearRecv, this, id.rad_csend);
+  }
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void RadiationM1::InitRecv
+//  \brief function to post non-blocking receives (with MPI), and initialize all boundary
+//  receive status flags to waiting (with or without MPI) for M1 radiation moments.
+
+TaskStatus RadiationM1::InitRecv(Driver *pdrive, int stage) {
+  // post receives for U
+  TaskStatus tstat = pbval_u->InitRecv(NM1VAR);
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // do not post receives for fluxes when stage < 0 (i.e. ICs)
+  if (stage >= 0) {
+    // with SMR/AMR, post receives for fluxes of U
+    if (pmy_pack->pmesh->multilevel) {
+      tstat = pbval_u->InitFluxRecv(NM1VAR);
+      if (tstat != TaskStatus::complete) return tstat;
+    }
+  }
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void RadiationM1::CopyCons
+//  \brief  copy u0 --> u1 in first stage
+
+TaskStatus RadiationM1::CopyCons(Driver *pdrive, int stage) {
+  if (stage == 1) {
+    // radiation moments
+    Kokkos::deep_copy(TaskExeSpace(), u1, u0);
+
+    // hydro and MHD (if enabled)
+    hydro::Hydro *phyd = pmy_pack->phydro;
+    mhd::MHD *pmhd = pmy_pack->pmhd;
+    if (pmhd != nullptr) {
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->u1, pmhd->u0);
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x1f, pmhd->b0.x1f);
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x2f, pmhd->b0.x2f);
+      Kokkos::deep_copy(TaskExeSpace(), pmhd->b1.x3f, pmhd->b0.x3f);
+    } else if (phyd != nullptr) {
+      Kokkos::deep_copy(TaskExeSpace(), phyd->u1, phyd->u0);
+    }
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::SendFlux
+//! \brief Wrapper task list function to pack/send restricted values of fluxes of
+//! conserved variables at fine/coarse boundaries
+
+TaskStatus RadiationM1::SendFlux(Driver *pdrive, int stage) {
+  TaskStatus tstat = TaskStatus::complete;
+  // Only execute BoundaryValues function with SMR/SMR
+  if (pmy_pack->pmesh->multilevel)  {
+    tstat = pbval_u->PackAndSendFluxCC(uflx);
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::RecvFlux
+//! \brief Wrapper task list function to recv/unpack restricted values of fluxes of
+//! conserved variables at fine/coarse boundaries
+
+TaskStatus RadiationM1::RecvFlux(Driver *pdrive, int stage) {
+  TaskStatus tstat = TaskStatus::complete;
+  // Only execute BoundaryValues function with SMR/SMR
+  if (pmy_pack->pmesh->multilevel) {
+    tstat = pbval_u->RecvAndUnpackFluxCC(uflx);
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::RestrictU
+//! \brief Wrapper task list function to restrict radiation moments
+
+TaskStatus RadiationM1::RestrictU(Driver *pdrive, int stage) {
+  // Only execute Mesh function with SMR/AMR
+  if (pmy_pack->pmesh->multilevel) {
+    pmy_pack->pmesh->pmr->RestrictCC(u0, coarse_u0);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::SendU
+//! \brief Wrapper task list function to pack/send radiation moments
+
+TaskStatus RadiationM1::SendU(Driver *pdrive, int stage) {
+  TaskStatus tstat = pbval_u->PackAndSendCC(u0, coarse_u0);
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::RecvU
+//! \brief Wrapper task list function to receive/unpack radiation moments
+
+TaskStatus RadiationM1::RecvU(Driver *pdrive, int stage) {
+  TaskStatus tstat = pbval_u->RecvAndUnpackCC(u0, coarse_u0);
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::ApplyPhysicalBCs
+//! \brief Wrapper task list function to call funtions that set physical and user BCs
+
+TaskStatus RadiationM1::ApplyPhysicalBCs(Driver *pdrive, int stage) {
+  // do not apply BCs if domain is strictly periodic
+  if (pmy_pack->pmesh->strictly_periodic) return TaskStatus::complete;
+
+  // physical BCs on radiation moments (flux components are reflected like velocity)
+  pbval_u->HydroBCs((pmy_pack), (pbval_u->u_in), u0);
+
+  // physical BCs on (M)HD
+  hydro::Hydro *phyd = pmy_pack->phydro;
+  mhd::MHD *pmhd = pmy_pack->pmhd;
+  if (pmhd != nullptr) {
+    pmhd->pbval_u->HydroBCs((pmy_pack), (pmhd->pbval_u->u_in), pmhd->u0);
+    pmhd->pbval_b->BFieldBCs((pmy_pack), (pmhd->pbval_b->b_in), pmhd->b0);
+  } else if (phyd != nullptr) {
+    phyd->pbval_u->HydroBCs((pmy_pack), (phyd->pbval_u->u_in), phyd->u0);
+  }
+
+  // user BCs
+  if (pmy_pack->pmesh->pgen->user_bcs) {
+    (pmy_pack->pmesh->pgen->user_bcs_func)(pmy_pack->pmesh);
+  }
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskList RadiationM1::Prolongate
+//! \brief Wrapper task list function to prolongate conserved (or primitive) variables
+//! at fine/coarse bundaries with SMR/AMR
+
+TaskStatus RadiationM1::Prolongate(Driver *pdrive, int stage) {
+  if (pmy_pack->pmesh->multilevel) {  // only prolongate with SMR/AMR
+    // prolongate radiation moments
+    pbval_u->FillCoarseInBndryCC(u0, coarse_u0);
+    pbval_u->ProlongateCC(u0, coarse_u0);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::ClearSend
+//! \brief Wrapper task list function that checks all MPI sends have completed.
+
+TaskStatus RadiationM1::ClearSend(Driver *pdrive, int stage) {
+  // check sends of U complete
+  TaskStatus tstat = pbval_u->ClearSend();
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // do not check flux send for ICs (stage < 0)
+  if (stage >= 0) {
+    // with SMR/AMR check sends of restricted fluxes of U complete
+    if (pmy_pack->pmesh->multilevel) {
+      tstat = pbval_u->ClearFluxSend();
+      if (tstat != TaskStatus::complete) return tstat;
+    }
+  }
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus RadiationM1::ClearRecv
+//! \brief Wrapper task list function that checks all MPI receives have completed.
+//! Needed in Driver::Initialize to set ghost zones in ICs.
+
+TaskStatus RadiationM1::ClearRecv(Driver *pdrive, int stage) {
+  // check receives of U complete
+  TaskStatus tstat = pbval_u->ClearRecv();
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // do not check flux receives when stage < 0 (i.e. ICs)
+  if (stage >= 0) {
+    // with SMR/AMR check receives of restricted fluxes of U complete
+    if (pmy_pack->pmesh->multilevel) {
+      tstat = pbval_u->ClearFluxRecv();
+      if (tstat != TaskStatus::complete) return tstat;
+    }
+  }
+
+  return TaskStatus::complete;
+}
+
+} // namespace radiation_m1
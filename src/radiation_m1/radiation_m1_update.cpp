@@ -0,0 +1,66 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file radiation_m1_update.cpp
+//! \brief Performs explicit update of M1 radiation moments (u0) for each stage of the
+//! SSP RK integrators, using weighted average and partial time step update of flux
+//! divergence.  Coupling to the fluid is added in AddRadiationSourceTerm().
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "radiation_m1/radiation_m1.hpp"
+#include "radiation_m1/radiation_m1_closure.hpp"
+
+namespace radiation_m1 {
+//----------------------------------------------------------------------------------------
+//! \fn  void RadiationM1::RKUpdate
+//  \brief Explicit RK update including flux divergence terms.  The updated moments are
+//  made realizable (E>=e_floor, |F|<=E) in every cell.
+
+TaskStatus RadiationM1::RKUpdate(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  Real &gam0 = pdriver->gam0[stage-1];
+  Real &gam1 = pdriver->gam1[stage-1];
+  Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  Real e_floor_ = e_floor;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+
+  par_for("m1_update",TaskExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real unew[NM1VAR];
+    for (int n=0; n<NM1VAR; ++n) {
+      // Fluxes must be summed in pairs to symmetrize round-off error in each dir
+      Real divf = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+      if (multi_d) {
+        divf += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+      }
+      if (three_d) {
+        divf += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+      }
+      unew[n] = gam0*u0_(m,n,k,j,i) + gam1*u1_(m,n,k,j,i) - beta_dt*divf;
+    }
+    Real f[3] = {unew[IFX], unew[IFY], unew[IFZ]};
+    M1Realizable(e_floor_, unew[IER], f);
+    u0_(m,IER,k,j,i) = unew[IER];
+    u0_(m,IFX,k,j,i) = f[0];
+    u0_(m,IFY,k,j,i) = f[1];
+    u0_(m,IFZ,k,j,i) = f[2];
+  });
+  return TaskStatus::complete;
+}
+} // namespace radiation_m1
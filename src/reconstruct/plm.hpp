@@ -36,6 +36,20 @@ void PLM(const Real &q_im1, const Real &q_i, const Real &q_ip1,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn PLMSlope()
+//! \brief Returns the limited slope (ql(i+1) - qr(i)) in cell i computed by PLM(). Used
+//! by the half-step predictor of the VL2 (MUSCL-Hancock) integrator.
+
+KOKKOS_INLINE_FUNCTION
+Real PLMSlope(const Real &q_im1, const Real &q_i, const Real &q_ip1) {
+  Real dql = (q_i - q_im1);
+  Real dqr = (q_ip1 - q_i);
+  Real dq2 = dql*dqr;
+  if (dq2 <= 0.0) return 0.0;
+  return 2.0*dq2/(dql + dqr);
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn PiecewiseLinearX1()
 //! \brief Wrapper function for PLM reconstruction in x1-direction.
@@ -69,7 +69,7 @@ TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
 
   // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
   int nmnv = nmb*2*nvar;  // only consider 2 neighbors (x2-faces)
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("oa-pack", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int m = (tmember.league_rank())/(2*nvar);
     const int n = (tmember.league_rank() - m*(2*nvar))/nvar;
@@ -231,7 +231,7 @@ TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
 
   int scr_lvl=0;
   size_t scr_size = ScrArray1D<Real>::shmem_size(nfx) * 3;
-  par_for_outer("oa-unpk",DevExeSpace(),scr_size,scr_lvl,0,(nmb-1),0,(nvar-1),ks,ke,is,ie,
+  par_for_outer("oa-unpk",TaskExeSpace(),scr_size,scr_lvl,0,nmb-1,0,(nvar-1),ks,ke,is,ie,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int i) {
     ScrArray1D<Real> a_(member.team_scratch(scr_lvl), nfx); // 1D slice of data
     ScrArray1D<Real> flx(member.team_scratch(scr_lvl), nfx); // "flux" at faces
@@ -65,7 +65,7 @@ TaskStatus OrbitalAdvectionFC::PackAndSendFC(DvceFaceFld4D<Real> &b) {
 
   // Outer loop over (# of MeshBlocks)*(# of buffers)*(# of variables)
   int nmnv = nmb*2;  // only consider 2 neighbors (x2-faces) and only 2 vars
-  Kokkos::TeamPolicy<> policy(DevExeSpace(), nmnv, Kokkos::AUTO);
+  Kokkos::TeamPolicy<> policy(TaskExeSpace(), nmnv, Kokkos::AUTO);
   Kokkos::parallel_for("oa-packB", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
     const int m = tmember.league_rank()/2;
     const int n = tmember.league_rank()%2;
@@ -233,7 +233,7 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
     int ncells3 = indcs.nx3 + 2*(indcs.ng);
     Kokkos::realloc(emfx,nmb,ncells3,ncells2,ncells1);
     Kokkos::realloc(emfz,nmb,ncells3,ncells2,ncells1);
-  par_for_outer("oa-unB",DevExeSpace(),scr_size,scr_lvl,0,(nmb-1),0,1,ks,ke+1,is,ie+1,
+  par_for_outer("oa-unB",TaskExeSpace(),scr_size,scr_lvl,0,(nmb-1),0,1,ks,ke+1,is,ie+1,
   KOKKOS_LAMBDA(TeamMember_t member, const int m, const int v, const int k, const int i) {
     ScrArray1D<Real> b0_(member.team_scratch(scr_lvl), nfx); // 1D slice of data
     ScrArray1D<Real> flx(member.team_scratch(scr_lvl), nfx); // "flux" at faces
@@ -325,7 +325,7 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
   // Update face-centered fields using CT
   //---- update B1 (only for 2D/3D problems)
   if (pmy_pack->pmesh->multi_d) {
-    par_for("oaCT-b1", DevExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie+1,
+    par_for("oaCT-b1", TaskExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie+1,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       b0.x1f(m,k,j,i) -= (emfz(m,k,j+1,i) - emfz(m,k,j,i));
     });
@@ -333,7 +333,7 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
 
   //---- update B2 (curl terms in 1D and 3D problems)
   const bool &three_d_ = pmy_pack->pmesh->three_d;
-  par_for("oaCT-b2", DevExeSpace(), 0, nmb-1, ks, ke, js, je+1, is, ie,
+  par_for("oaCT-b2", TaskExeSpace(), 0, nmb-1, ks, ke, js, je+1, is, ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
     Real dydx = mbsize.d_view(m).dx2/mbsize.d_view(m).dx1;
     b0.x2f(m,k,j,i) += dydx*(emfz(m,k,j,i+1) - emfz(m,k,j,i));
@@ -345,7 +345,7 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
 
   //---- update B3 (curl terms in 1D and 2D/3D problems)
   if (pmy_pack->pmesh->multi_d) {
-    par_for("oaCT-b3", DevExeSpace(), 0, nmb-1, ks, ke+1, js, je, is, ie,
+    par_for("oaCT-b3", TaskExeSpace(), 0, nmb-1, ks, ke+1, js, je, is, ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       b0.x3f(m,k,j,i) += (emfx(m,k,j+1,i) - emfx(m,k,j,i));
     });
@@ -67,7 +67,7 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
   size_t scr_size = ScrArray1D<Real>::shmem_size(nj) * 3;
   for (int n=0; n<2; ++n) {
     int nmb1 = nmb_x1bndry(n) - 1;
-    par_for_outer("shrcc",DevExeSpace(),scr_size,scr_lvl,0,nmb1,0,2,kl,ku,0,(ng-1),
+    par_for_outer("shrcc",TaskExeSpace(),scr_size,scr_lvl,0,nmb1,0,2,kl,ku,0,(ng-1),
     KOKKOS_LAMBDA(TeamMember_t member,const int m,const int v,const int k,const int i) {
       ScrArray1D<Real> a_(member.team_scratch(scr_lvl), nj); // 1D slice of data
       ScrArray1D<Real> flx(member.team_scratch(scr_lvl), nj); // "flux" at faces
@@ -188,7 +188,7 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
             using Kokkos::ALL;
             auto src = subview(sendbuf[n].vars,m, jsrc[l],ALL,ALL,ALL);
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
-            deep_copy(DevExeSpace(), dst, src);
+            deep_copy(TaskExeSpace(), dst, src);
 #if MPI_PARALLEL_ENABLED
           } else {
             using Kokkos::ALL;
@@ -227,7 +227,7 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
             using Kokkos::ALL;
             auto src = subview(sendbuf[n].vars,m, jsrc[l],ALL,ALL,ALL);
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
-            deep_copy(DevExeSpace(), dst, src);
+            deep_copy(TaskExeSpace(), dst, src);
 #if MPI_PARALLEL_ENABLED
           } else {
             using Kokkos::ALL;
@@ -270,7 +270,7 @@ TaskStatus ShearingBoxBoundaryFC::PackAndSendFC(DvceFaceFld4D<Real> &b,
             using Kokkos::ALL;
             auto src = subview(sendbuf[n].vars,m, jsrc[l],ALL,ALL,ALL);
             auto dst = subview(recvbuf[n].vars,tm,jdst[l],ALL,ALL,ALL);
-            deep_copy(DevExeSpace(), dst, src);
+            deep_copy(TaskExeSpace(), dst, src);
 #if MPI_PARALLEL_ENABLED
           } else {
             using Kokkos::ALL;
@@ -391,7 +391,7 @@ TaskStatus ShearingBoxBoundaryFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b) {
   size_t scr_size = ScrArray1D<Real>::shmem_size(nj) * 3;
   for (int n=0; n<2; ++n) {
     int nmb1 = nmb_x1bndry(n) - 1;
-    par_for_outer("shrcc",DevExeSpace(),scr_size,scr_lvl,0,nmb1,0,2,kl,ku,0,(ng-1),
+    par_for_outer("shrcc",TaskExeSpace(),scr_size,scr_lvl,0,nmb1,0,2,kl,ku,0,(ng-1),
     KOKKOS_LAMBDA(TeamMember_t member,const int m,const int v,const int k,const int i) {
       int mm = x1bndry_mbgid_.d_view(n,m) - gids_;
       if (n==0) {
@@ -37,7 +37,7 @@ void SourceTerms::ShearingBox(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
     Real coef1 = 2.0*bdt*omega0;
     Real coef2 = (2.0-qshear)*bdt*omega0;
     Real qo = qshear*omega0;
-    par_for("sbox", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+    par_for("sbox", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       Real &den = w0(m,IDN,k,j,i);
       Real mom1 = den*w0(m,IVX,k,j,i);
@@ -53,7 +53,7 @@ void SourceTerms::ShearingBox(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
     Real coef1 = 2.0*bdt*omega0;
     Real coef3 = (2.0-qshear)*bdt*omega0;
     Real qo = qshear*omega0;
-    par_for("sbox", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+    par_for("sbox", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       Real &den = w0(m,IDN,k,j,i);
       Real mom1 = den*w0(m,IVX,k,j,i);
@@ -89,7 +89,7 @@ void SourceTerms::ShearingBox(const DvceArray5D<Real> &w0, const DvceArray5D<Rea
     Real coef1 = 2.0*bdt*omega0;
     Real coef2 = (2.0-qshear)*bdt*omega0;
     Real qo = qshear*omega0;
-    par_for("sbox", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+    par_for("sbox", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       Real &den = w0(m,IDN,k,j,i);
       Real mom1 = den*w0(m,IVX,k,j,i);
@@ -105,7 +105,7 @@ void SourceTerms::ShearingBox(const DvceArray5D<Real> &w0, const DvceArray5D<Rea
     Real coef1 = 2.0*bdt*omega0;
     Real coef3 = (2.0-qshear)*bdt*omega0;
     Real qo = qshear*omega0;
-    par_for("sbox", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+    par_for("sbox", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
     KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
       Real &den = w0(m,IDN,k,j,i);
       Real mom1 = den*w0(m,IVX,k,j,i);
@@ -149,7 +149,7 @@ void SourceTerms::SBoxEField(const DvceFaceFld4D<Real> &b0, DvceEdgeFld4D<Real>
     auto e2 = efld.x2e;
     auto b1 = b0.x1f;
     auto b2 = b0.x2f;
-    par_for_outer("acc0", DevExeSpace(), scr_size, scr_level, 0, nmb1, js, je+1,
+    par_for_outer("acc0", TaskExeSpace(), scr_size, scr_level, 0, nmb1, js, je+1,
     KOKKOS_LAMBDA(TeamMember_t member, const int m, const int j) {
       par_for_inner(member, is, ie+1, [&](const int i) {
         Real &x1min = size.d_view(m).x1min;
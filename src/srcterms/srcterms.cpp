@@ -193,7 +193,7 @@ void SourceTerms::ConstantAccel(const DvceArray5D<Real> &w0, const EOS_Data &eos
   Real &g = const_accel_val;
   int &dir = const_accel_dir;
 
-  par_for("const_acc", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  par_for("const_acc", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real src = bdt*g*w0(m,IDN,k,j,i);
     u0(m,dir,k,j,i) += src;
@@ -226,7 +226,7 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
                       /n_unit/n_unit;
   Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()/n_unit;
 
-  par_for("cooling", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  par_for("cooling", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // temperature in cgs unit
     Real temp = 1.0;
@@ -264,7 +264,7 @@ void SourceTerms::RelCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
   Real cooling_rate = crate_rel;
   Real cooling_power = cpower_rel;
 
-  par_for("cooling", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  par_for("cooling", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // temperature in cgs unit
     Real temp = 1.0;
@@ -405,7 +405,7 @@ void SourceTerms::SupernovaDriving(const DvceArray5D<Real> &w0, const EOS_Data &
     Real zsn = event_xyz[3*n + 2];
 
     Real vol_local = 0.0;
-    Kokkos::parallel_reduce("sn_volume", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    Kokkos::parallel_reduce("sn_volume", Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &sum_vol) {
       int m = (idx)/nkji;
       int k = (idx - m*nkji)/nji;
@@ -462,7 +462,7 @@ void SourceTerms::SupernovaDriving(const DvceArray5D<Real> &w0, const EOS_Data &
     if ((sn_subgrid || sn_pinj > 0.0) && vol_global > 0.0) {
       Real rho_vol_local = 0.0;
       Kokkos::parallel_reduce("sn_density",
-      Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+      Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
       KOKKOS_LAMBDA(const int &idx, Real &sum_rho) {
         int m = (idx)/nkji;
         int k = (idx - m*nkji)/nji;
@@ -593,7 +593,7 @@ void SourceTerms::SupernovaDriving(const DvceArray5D<Real> &w0, const EOS_Data &
       Real de = event_einj/vol_global;
       Real rho_avg_k = rho_avg;
       Real vri_k = vri;
-      par_for("sn_inject", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+      par_for("sn_inject", TaskExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
       KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
         Real &x1mbmin = size.d_view(m).x1min;
         Real &x1mbmax = size.d_view(m).x1max;
@@ -690,7 +690,7 @@ void SourceTerms::BeamSource(DvceArray5D<Real> &i0, const Real bdt) {
 
   auto &beam_mask_ = pmy_pack->prad->beam_mask;
   Real &dii_dt_ = dii_dt;
-  par_for("beam_source",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
+  par_for("beam_source",TaskExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
     if (beam_mask_(m,n,k,j,i)) {
       Real n0 = tt(m,0,0,k,j,i);
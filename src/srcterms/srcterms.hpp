@@ -44,6 +44,11 @@ class SourceTerms {
   bool sn_driving;
   bool beam;
   bool shearing_box, shearing_box_r_phi;
+  // true if any of the above source terms are enabled
+  bool AnyEnabled() const {
+    return (const_accel || ism_cooling || rel_cooling || sn_driving || beam ||
+            shearing_box);
+  }
 
   // new timestep
   Real dtnew;
@@ -47,7 +47,7 @@ void SourceTerms::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
 
     // find smallest (e/cooling_rate) in each cell
     Kokkos::parallel_reduce("srcterms_cooling_newdt",
-                            Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+                            Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &min_dt) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
@@ -88,7 +88,7 @@ void SourceTerms::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_d
 
     // find smallest (e/cooling_rate) in each cell
     Kokkos::parallel_reduce("srcterms_cooling_newdt",
-                            Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+                            Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &min_dt) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
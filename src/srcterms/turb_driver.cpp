@@ -484,14 +484,14 @@ void TurbulenceDriver::Initialize() {
   auto force_ = force;
   auto force_component_ = force_component;
   auto force_norm_component_ = force_norm_component;
-  par_for("force_init_pgen",DevExeSpace(),
+  par_for("force_init_pgen",TaskExeSpace(),
           0,nmb-1,0,2,0,ncells3-1,0,ncells2-1,0,ncells1-1,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
     force_(m,n,k,j,i) = 0.0;
   });
   const int init_total = num_components*nmb*3*ncells3*ncells2*ncells1;
   Kokkos::parallel_for("force_component_init_pgen",
-      Kokkos::RangePolicy<>(DevExeSpace(),0,init_total),
+      Kokkos::RangePolicy<>(TaskExeSpace(),0,init_total),
   KOKKOS_LAMBDA(const int &idx) {
     int q = idx;
     int i = q%ncells1;
@@ -572,7 +572,7 @@ void TurbulenceDriver::Initialize() {
 
   auto &size = pmy_pack->pmb->mb_size;
 
-  par_for("xsin/xcos", DevExeSpace(),0,num_components-1,0,nmb-1,0,max_mode_count-1,is,ie,
+  par_for("xsin/xcos", TaskExeSpace(),0,num_components-1,0,nmb-1,0,max_mode_count-1,is,ie,
   KOKKOS_LAMBDA(int c, int m, int n, int i) {
     Real &x1min = size.d_view(m).x1min;
     Real &x1max = size.d_view(m).x1max;
@@ -582,7 +582,7 @@ void TurbulenceDriver::Initialize() {
     xcos_(c,m,n,i) = cos(k1v*x1v);
   });
 
-  par_for("ysin/ycos", DevExeSpace(),0,num_components-1,0,nmb-1,0,max_mode_count-1,js,je,
+  par_for("ysin/ycos", TaskExeSpace(),0,num_components-1,0,nmb-1,0,max_mode_count-1,js,je,
   KOKKOS_LAMBDA(int c, int m, int n, int j) {
     Real &x2min = size.d_view(m).x2min;
     Real &x2max = size.d_view(m).x2max;
@@ -596,7 +596,7 @@ void TurbulenceDriver::Initialize() {
     }
   });
 
-  par_for("zsin/zcos", DevExeSpace(),0,num_components-1,0,nmb-1,0,max_mode_count-1,ks,ke,
+  par_for("zsin/zcos", TaskExeSpace(),0,num_components-1,0,nmb-1,0,max_mode_count-1,ks,ke,
   KOKKOS_LAMBDA(int c, int m, int n, int k) {
     Real &x3min = size.d_view(m).x3min;
     Real &x3max = size.d_view(m).x3max;
@@ -673,7 +673,7 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
   auto force_tmp_ = force_tmp_component;
   int &nmb = pmy_pack->nmb_thispack;
   const int init_total = num_components*nmb*3*nx3*nx2*nx1;
-  Kokkos::parallel_for("force_init", Kokkos::RangePolicy<>(DevExeSpace(),0,init_total),
+  Kokkos::parallel_for("force_init", Kokkos::RangePolicy<>(TaskExeSpace(),0,init_total),
   KOKKOS_LAMBDA(const int &idx) {
     int q = idx;
     int i = q%nx1 + is;
@@ -986,7 +986,7 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
 
   for (int c = 0; c < num_components; ++c) {
     for (int n=0; n<mode_count[c]; n++) {
-      par_for("force_compute", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+      par_for("force_compute", TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         force_tmp_(c,m,0,k,j,i) +=
             xccc_.d_view(c,n)*xcos_(c,m,n,i)*ycos_(c,m,n,j)*zcos_(c,m,n,k);
@@ -1047,7 +1047,7 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
     int transverse_window_ = transverse_window[c];
     Real transverse_window_radius_ = transverse_window_radius[c];
     Real transverse_window_transition_ = transverse_window_transition[c];
-    par_for("force_tmp_spatial_window", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+    par_for("force_tmp_spatial_window", TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real &x1min = size.d_view(m).x1min;
       Real &x1max = size.d_view(m).x1max;
@@ -1125,7 +1125,7 @@ TaskStatus TurbulenceDriver::UpdateForcing(Driver *pdrive, int stage) {
       gcorr = std::sqrt(1.0 - fcorr*fcorr);
     }
 
-    par_for("force_OU_process",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+    par_for("force_OU_process",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       force_(c,m,0,k,j,i) =
           fcorr*force_(c,m,0,k,j,i) + gcorr*force_tmp_(c,m,0,k,j,i);
@@ -1146,7 +1146,7 @@ TaskStatus TurbulenceDriver::UpdateForcing(Driver *pdrive, int stage) {
     Real transverse_window_radius_ = transverse_window_radius[c];
     Real transverse_window_transition_ = transverse_window_transition[c];
 
-    Kokkos::parallel_reduce("force_net_mom", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
+    Kokkos::parallel_reduce("force_net_mom",Kokkos::RangePolicy<>(TaskExeSpace(),0,nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &sum_t0, Real &sum_t1,
                                   Real &sum_t2, Real &sum_t3) {
       int m = (idx)/nkji;
@@ -1188,7 +1188,7 @@ TaskStatus TurbulenceDriver::UpdateForcing(Driver *pdrive, int stage) {
 #endif
     t0 = std::max(t0, 1.0e-20);
 
-    par_for("force_remove_net_mom", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+    par_for("force_remove_net_mom", TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real &x1min = size.d_view(m).x1min;
       Real &x1max = size.d_view(m).x1max;
@@ -1211,7 +1211,7 @@ TaskStatus TurbulenceDriver::UpdateForcing(Driver *pdrive, int stage) {
 
     t0 = 0.0;
     t1 = 0.0;
-    Kokkos::parallel_reduce("force_dedt_norm", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
+    Kokkos::parallel_reduce("force_dedt_norm", Kokkos::RangePolicy<>(TaskExeSpace(),0,nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &sum_t0, Real &sum_t1) {
       int m = (idx)/nkji;
       int k = (idx - m*nkji)/nji;
@@ -1257,7 +1257,7 @@ TaskStatus TurbulenceDriver::UpdateForcing(Driver *pdrive, int stage) {
     }
     if (dedt[c] == 0.0 || m0 == 0.0) s = 0.0;
 
-    par_for("force_norm", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+    par_for("force_norm", TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       force_norm_(c,m,0,k,j,i) *= s;
       force_norm_(c,m,1,k,j,i) *= s;
@@ -1265,12 +1265,12 @@ TaskStatus TurbulenceDriver::UpdateForcing(Driver *pdrive, int stage) {
     });
   }
 
-  par_for("force_total_zero", DevExeSpace(),0,nmb-1,0,2,ks,ke,js,je,is,ie,
+  par_for("force_total_zero", TaskExeSpace(),0,nmb-1,0,2,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
     force_total_(m,n,k,j,i) = 0.0;
   });
   for (int c = 0; c < num_components; ++c) {
-    par_for("force_total_sum", DevExeSpace(),0,nmb-1,0,2,ks,ke,js,je,is,ie,
+    par_for("force_total_sum", TaskExeSpace(),0,nmb-1,0,2,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
       force_total_(m,n,k,j,i) += force_norm_(c,m,n,k,j,i);
     });
@@ -1338,7 +1338,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
 
   Real forcing_power = 0.0;
   Kokkos::parallel_reduce("turb_forcing_power",
-      Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+      Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
   KOKKOS_LAMBDA(const int &idx, Real &sum) {
     int m = idx/nkji;
     int k = (idx - m*nkji)/nji;
@@ -1388,7 +1388,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
 #endif
   last_power = forcing_power;
 
-  par_for("push",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  par_for("push",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
     Real a1 = force_(m,0,k,j,i);
     Real a2 = force_(m,1,k,j,i);
@@ -1440,7 +1440,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
       auto &b = *bcc0;
       auto &eos = peos->eos_data;
 
-      par_for("net_mom_4",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+      par_for("net_mom_4",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         // load single state conserved variables
         MHDCons1D u;
@@ -1488,7 +1488,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
     } else {
       auto &eos = peos->eos_data;
 
-      par_for("net_mom_4",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+      par_for("net_mom_4",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         // load single state conserved variables
         HydCons1D u;
@@ -1530,7 +1530,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
 
     // remove net momentum
     Real t0 = 0.0, t1 = 0.0, t2 = 0.0, t3 = 0.0;
-    Kokkos::parallel_reduce("net_mom_3", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    Kokkos::parallel_reduce("net_mom_3", Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &sum_t0, Real &sum_t1, Real &sum_t2,
                   Real &sum_t3) {
       // compute n,k,j,i indices of thread
@@ -1582,7 +1582,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
       auto &b = *bcc0;
       auto &eos = peos->eos_data;
 
-      par_for("net_mom_4",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+      par_for("net_mom_4",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         u0(m,IEN,k,j,i) = fmin(u0(m,IEN,k,j,i), 40.*u0(m,IDN,k,j,i));
 
@@ -1630,7 +1630,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
     } else {
       auto &eos = peos->eos_data;
 
-      par_for("net_mom_4",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+      par_for("net_mom_4",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         u0(m,IEN,k,j,i) = fmin(u0(m,IEN,k,j,i), 40.*u0(m,IDN,k,j,i));
 
@@ -1674,7 +1674,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
   } else {
     // remove net momentum
     Real t0 = 0.0, t1 = 0.0, t2 = 0.0, t3 = 0.0;
-    Kokkos::parallel_reduce("net_mom_3", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    Kokkos::parallel_reduce("net_mom_3", Kokkos::RangePolicy<>(TaskExeSpace(), 0, nmkji),
     KOKKOS_LAMBDA(const int &idx, Real &sum_t0, Real &sum_t1, Real &sum_t2,
                   Real &sum_t3) {
       // compute n,k,j,i indices of thread
@@ -1710,7 +1710,7 @@ TaskStatus TurbulenceDriver::AddForcing(Driver *pdrive, int stage) {
     t0 = gm[0]; t1 = gm[1]; t2 = gm[2]; t3 = gm[3];
 #endif
 
-    par_for("net_mom_4",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+    par_for("net_mom_4",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
       Real den = u0(m,IDN,k,j,i);
 
@@ -0,0 +1,84 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file exec_instances.cpp
+//  \brief functions to create, fence, and destroy the pool of execution space instances
+//  used to run independent tasks concurrently.  Each instance is a separate stream, so
+//  instances are only created with asynchronous (GPU) backends.
+
+#include <iostream>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+
+namespace exec_instances {
+int current = -1;
+
+std::vector<DevExeSpace> &Pool() {
+  static std::vector<DevExeSpace> pool;
+  return pool;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Initialize()
+//  \brief partition default execution space into n instances with equal weights.  Nothing
+//  is done for n < 2, or if the default execution space runs on the host (OpenMP, Serial),
+//  in which case all tasks run on the default instance.  Partitioning a host space splits
+//  the thread pool, so that each kernel would run on a fraction of the cores.
+
+void Initialize(int n) {
+  Pool().clear();
+  current = -1;
+  if (n < 2) return;
+  if (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 DevExeSpace::memory_space>::accessible) {
+    if (global_variable::my_rank == 0) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "<job>/exec_instances = " << n << " ignored, execution space "
+                << "instances are only used with GPU backends" << std::endl;
+    }
+    return;
+  }
+  std::vector<int> weights(n, 1);
+  Pool() = Kokkos::Experimental::partition_space(DevExeSpace(), weights);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Fence()
+//  \brief wait for all work queued on instance n (or on default instance for n < 0)
+
+void Fence(int n) {
+  if (n >= 0 && n < Size()) {
+    Pool()[n].fence("exec_instances::Fence");
+  } else {
+    DevExeSpace().fence("exec_instances::Fence");
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void FenceAll()
+//  \brief wait for all work queued on every instance, including the default
+
+void FenceAll() {
+  for (auto &inst : Pool()) {inst.fence("exec_instances::FenceAll");}
+  DevExeSpace().fence("exec_instances::FenceAll");
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Finalize()
+//  \brief destroy instances.  Must be called before Kokkos::finalize()
+
+void Finalize() {
+  FenceAll();
+  Pool().clear();
+  current = -1;
+  return;
+}
+
+} // namespace exec_instances
@@ -0,0 +1,176 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file launch_tuning.cpp
+//  \brief functions to select, cache, and save the launch configuration (team size,
+//  vector length, and scratch level) of par_for_outer kernels.  Each kernel is tuned
+//  independently by timing every candidate configuration ntrial times during the first
+//  launches, after which the fastest is always used.  With a tuning file, winners from
+//  previous runs are loaded at startup so that no further tuning is needed for them.
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+
+namespace launch_tuning {
+bool enabled = false;
+
+namespace {
+int ntrial_ = 3;
+std::string file_;
+std::map<std::string, KernelTuning> &Cache() {
+  static std::map<std::string, KernelTuning> cache;
+  return cache;
+}
+
+// (team size, vector length) pairs tried for every kernel; 0 denotes Kokkos::AUTO.
+// Pairs not supported by the backend or kernel are skipped when first launched.
+const int ncand_tv = 7;
+const int cand_tv[ncand_tv][2] = {{0,0}, {0,1}, {32,1}, {64,1}, {128,1}, {256,1},
+                                  {32,4}};
+
+std::string Key(const std::string &name, int nleague, size_t scr_size) {
+  std::stringstream key;
+  key << nleague << " " << scr_size << " " << name;
+  return key.str();
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn KernelTuning &Lookup()
+//  \brief returns tuning data for kernel with given name, league size, and scratch size,
+//  creating list of candidate configurations the first time kernel is launched.  Both
+//  scratch levels are tried when scratch memory is used.
+
+KernelTuning &Lookup(const std::string &name, int nleague, size_t scr_size, int scr_lev) {
+  auto &cache = Cache();
+  std::string key = Key(name, nleague, scr_size);
+  auto it = cache.find(key);
+  if (it != cache.end()) return it->second;
+
+  KernelTuning &kt = cache[key];
+  for (int l=0; l<2; ++l) {
+    int lev = (l == 0) ? scr_lev : 1 - scr_lev;
+    if (l == 1 && scr_size == 0) break;
+    for (int c=0; c<ncand_tv; ++c) {
+      kt.cand.push_back({cand_tv[c][0], cand_tv[c][1], lev});
+    }
+  }
+  kt.best_time.assign(kt.cand.size(), std::numeric_limits<double>::max());
+  return kt;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Record()
+//  \brief records time taken by candidate c (negative if candidate is invalid), and
+//  selects winner once all candidates have been tried ntrial times
+
+void Record(KernelTuning &kt, int c, double time) {
+  int ncand = static_cast<int>(kt.cand.size());
+  if (time >= 0.0 && time < kt.best_time[c]) {kt.best_time[c] = time;}
+  kt.ntried++;
+  if (kt.ntried >= ntrial_*ncand) {
+    kt.winner = 0;  // AUTO/AUTO at call-site scratch level is always valid
+    for (int n=1; n<ncand; ++n) {
+      if (kt.best_time[n] < kt.best_time[kt.winner]) {kt.winner = n;}
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Kokkos::TeamPolicy<> MakePolicy()
+//  \brief constructs TeamPolicy for given configuration (without scratch size set)
+
+Kokkos::TeamPolicy<> MakePolicy(DevExeSpace exec_space, int nleague,
+                                const LaunchConfig &cfg) {
+  if (cfg.team_size > 0 && cfg.vector_length > 0) {
+    return Kokkos::TeamPolicy<>(exec_space, nleague, cfg.team_size, cfg.vector_length);
+  } else if (cfg.team_size > 0) {
+    return Kokkos::TeamPolicy<>(exec_space, nleague, cfg.team_size, Kokkos::AUTO);
+  } else if (cfg.vector_length > 0) {
+    return Kokkos::TeamPolicy<>(exec_space, nleague, Kokkos::AUTO, cfg.vector_length);
+  }
+  return Kokkos::TeamPolicy<>(exec_space, nleague, Kokkos::AUTO);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Initialize()
+//  \brief enables tuning, and loads winners from tuning file (if it exists).  Each line
+//  of file contains: nleague scr_size team_size vector_length scr_level name
+
+void Initialize(bool enable, int ntrial, const std::string &file) {
+  Cache().clear();
+  enabled = enable;
+  ntrial_ = (ntrial > 0) ? ntrial : 1;
+  file_ = file;
+  if (!(enabled) || file_.empty()) return;
+
+  std::ifstream infile(file_);
+  if (!(infile.is_open())) return;
+  std::string line;
+  int nloaded = 0;
+  while (std::getline(infile, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::stringstream ss(line);
+    int nleague, ts, vl, lev;
+    size_t scr_size;
+    std::string name;
+    if (!(ss >> nleague >> scr_size >> ts >> vl >> lev)) continue;
+    std::getline(ss >> std::ws, name);
+    KernelTuning &kt = Cache()[Key(name, nleague, scr_size)];
+    kt.cand.assign(1, {ts, vl, lev});
+    kt.best_time.assign(1, 0.0);
+    kt.winner = 0;
+    nloaded++;
+  }
+  if (global_variable::my_rank == 0) {
+    std::cout << "Loaded launch configuration of " << nloaded << " kernels from "
+              << file_ << std::endl;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Finalize()
+//  \brief writes winners to tuning file (on rank 0 only), and disables tuning
+
+void Finalize() {
+  if (enabled && !(file_.empty()) && global_variable::my_rank == 0) {
+    std::ofstream outfile(file_);
+    if (outfile.is_open()) {
+      outfile << "# nleague scr_size team_size vector_length scr_level name" << std::endl;
+      for (auto &it : Cache()) {
+        const KernelTuning &kt = it.second;
+        if (kt.winner < 0) continue;
+        const LaunchConfig &cfg = kt.cand[kt.winner];
+        std::stringstream key(it.first);
+        int nleague;
+        size_t scr_size;
+        std::string name;
+        key >> nleague >> scr_size;
+        std::getline(key >> std::ws, name);
+        outfile << nleague << " " << scr_size << " " << cfg.team_size << " "
+                << cfg.vector_length << " " << cfg.scr_level << " " << name << std::endl;
+      }
+    } else {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "Could not open tuning file '" << file_ << "' for writing"
+                << std::endl;
+    }
+  }
+  Cache().clear();
+  enabled = false;
+  return;
+}
+
+} // namespace launch_tuning
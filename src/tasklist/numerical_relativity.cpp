@@ -178,6 +178,21 @@ void NumericalRelativity::AssembleNumericalRelativityTasks(
     abort();
   }
 
+  // When both matter and spacetime are evolved, MHD and Z4c tasks (including the matter
+  // source terms and boundary communication of each) only interact through the explicit
+  // dependencies in the queues, so run them on separate execution space instances (if
+  // available).  Instances are fenced by the TaskList wherever a dependency crosses them.
+  if (pmy_pack->pdyngr != nullptr && pmy_pack->pz4c != nullptr) {
+    for (auto &task : run_queue) {
+      PhysicsDependency phys = NeedsPhysics(task.name);
+      if (phys == Phys_Z4c) {
+        tl["stagen"]->SetInstance(task.id, 0);
+      } else if (phys == Phys_MHD) {
+        tl["stagen"]->SetInstance(task.id, 1);
+      }
+    }
+  }
+
   success = AssembleNumericalRelativityTasks(tl["after_stagen"], end_queue);
   if (!success) {
     std::cout << "NumericalRelativity: Failed to construct end TaskList!\n"
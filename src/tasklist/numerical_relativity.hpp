@@ -82,6 +82,7 @@ enum TaskName {
   Z4c_ClearRW,
   Z4c_Wave,
   Z4c_PT,
+  Z4c_MRStep,
   Z4c_NTASKS
 };
 
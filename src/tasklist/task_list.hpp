@@ -20,6 +20,8 @@
 #include <list>
 #include <iterator>
 
+#include "athena.hpp"
+
 class Driver;
 
 // Maximum size of TL
@@ -92,6 +94,8 @@ class Task {
   TaskStatus operator()(Driver *d, int s) {return func_(d,s);}
   TaskID GetID() {return myid_;}
   TaskID GetDependency() {return dep_;}
+  int GetInstance() {return instance_;}
+  void SetInstance(int n) {instance_ = n;}
   void SetComplete() {complete_ = true;}
   void SetIncomplete() {complete_ = false;}
   bool IsComplete() {return complete_;}
@@ -105,6 +109,7 @@ class Task {
   TaskID dep_;     // encodes dependencies to other tasks in bitfld_
   // bool lb_time_;   // flag to include this task in timing for automatic load balancing
   bool complete_ = false;
+  int instance_ = -1;  // execution space instance used by Task (<0 for default)
   std::function<TaskStatus(Driver*, int)> func_;  // ptr to Task function
 };
 
@@ -139,17 +144,41 @@ class TaskList {
   void Reset() {
     tasks_completed_.Clear();  // TaskID Clear() fn
     for (auto &it : task_list_) { it.SetIncomplete(); }
+    for (auto &it : unfenced_) { it.Clear(); }
+  }
+
+  // Assign the Task with ID 'id' to execution space instance 'n'.  Tasks assigned to
+  // different instances may run concurrently on the device; instance n is fenced before
+  // any Task on another instance that depends on a Task in n is started.  Request is
+  // ignored (Task runs on default instance) if the pool has fewer than n+1 instances.
+  void SetInstance(TaskID id, int n) {
+    if (n >= exec_instances::Size()) return;
+    for (auto &it : task_list_) {
+      if (it.GetID() == id) {it.SetInstance(n);}
+    }
   }
 
   // cycle through task list once, do any tasks whose dependencies are clear
   TaskListStatus DoAvailable(Driver *d, int s) {
+    unfenced_.resize(exec_instances::Size() + 1);
     for (auto &task : task_list_) {
       auto dep = task.GetDependency();
       if ( tasks_completed_.CheckDependencies(dep) && !(task.IsComplete()) ) {
+        // wait for work on other instances this task depends on (index 0 = default)
+        int inst = task.GetInstance();
+        for (int n=0; n<static_cast<int>(unfenced_.size()); ++n) {
+          if ((n != inst+1) && ((unfenced_[n] & dep) != TaskID(0))) {
+            exec_instances::Fence(n-1);
+            unfenced_[n].Clear();
+          }
+        }
+        exec_instances::current = inst;
         TaskStatus status = task(d,s);  // calls Task function using overloaded operator()
+        exec_instances::current = -1;
         if (status == TaskStatus::complete) {
           task.SetComplete();              // set bool flag in task
           MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
+          unfenced_[inst+1].SetComplete(task.GetID());
         }
       }
     }
@@ -223,6 +252,7 @@ class TaskList {
  protected:
   std::list<Task> task_list_;
   TaskID tasks_completed_;
+  std::vector<TaskID> unfenced_;  // completed Tasks per instance, not yet fenced
 };
 
 #endif  // TASKLIST_TASK_LIST_HPP_
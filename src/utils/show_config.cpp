@@ -32,6 +32,11 @@ void ShowConfig() {
 #else
   std::cout<<"  OpenMP parallelism:         OFF" << std::endl;
 #endif
+#if ARRAY_LAYOUT_LEFT
+  std::cout<<"  Layout of 4D-6D arrays:     left" << std::endl;
+#else
+  std::cout<<"  Layout of 4D-6D arrays:     right" << std::endl;
+#endif
 
   // std::cout<<"  Compiler:                   " << COMPILED_WITH << std::endl;
   // std::cout<<"  Compilation command:        " << COMPILER_COMMAND
@@ -0,0 +1,93 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file thread_binding.cpp
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+
+#if OPENMP_PARALLEL_ENABLED
+#include <omp.h>
+#endif
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sched.h>
+#endif
+
+namespace {
+#if OPENMP_PARALLEL_ENABLED && defined(__linux__)
+//----------------------------------------------------------------------------------------
+// NUMA node containing cpu, found from the nodeN entry in its sysfs directory.  Returns
+// -1 if it cannot be determined.
+
+int NumaNodeOfCPU(int cpu) {
+  if (cpu < 0) return -1;
+  std::string dirname = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+  DIR *dir = opendir(dirname.c_str());
+  if (dir == nullptr) return -1;
+  int node = -1;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string name(entry->d_name);
+    if (name.size() > 4 && name.compare(0, 4, "node") == 0) {
+      node = std::atoi(name.c_str() + 4);
+      break;
+    }
+  }
+  closedir(dir);
+  return node;
+}
+#endif
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void ReportThreadBinding()
+//  \brief prints the number of OpenMP threads, their binding policy, and the NUMA nodes
+//  spanned by the threads of rank 0.  Since arrays are first touched by the threads that
+//  update them (see realloc_first_touch), threads that are not bound to cores may migrate
+//  away from their data.  With verbose=true (set by <job>/report_binding), the core and
+//  NUMA node of every thread is listed.  Only produces output for OpenMP builds on Linux.
+
+void ReportThreadBinding(bool verbose) {
+#if OPENMP_PARALLEL_ENABLED && defined(__linux__)
+  if (global_variable::my_rank != 0) return;
+
+  int nthreads = omp_get_max_threads();
+  std::vector<int> cpu(nthreads, -1), node(nthreads, -1);
+#pragma omp parallel num_threads(nthreads)
+  {
+    int t = omp_get_thread_num();
+    cpu[t] = sched_getcpu();
+    node[t] = NumaNodeOfCPU(cpu[t]);
+  }
+  std::set<int> nodes(node.begin(), node.end());
+
+  const char *bind = std::getenv("OMP_PROC_BIND");
+  const char *places = std::getenv("OMP_PLACES");
+  std::cout << "OpenMP threads: " << nthreads
+            << ", OMP_PROC_BIND=" << ((bind != nullptr)? bind : "(unset)")
+            << ", OMP_PLACES=" << ((places != nullptr)? places : "(unset)")
+            << ", NUMA nodes spanned by rank 0: " << nodes.size() << std::endl;
+  if (bind == nullptr) {
+    std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "OMP_PROC_BIND is not set, threads may migrate away from the NUMA "
+              << "node of their data" << std::endl;
+  }
+  if (verbose) {
+    for (int t=0; t<nthreads; ++t) {
+      std::cout << "  thread " << t << ": cpu " << cpu[t] << ", NUMA node " << node[t]
+                << std::endl;
+    }
+  }
+#endif
+  return;
+}
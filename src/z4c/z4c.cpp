@@ -65,6 +65,9 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   u_rhs("u_rhs z4c",1,1,1,1,1),
   u_weyl("u_weyl",1,1,1,1,1),
   coarse_u_weyl("coarse_u_weyl",1,1,1,1,1),
+  mr_adm_old("mr_adm_old",1,1,1,1,1),
+  mr_adm_new("mr_adm_new",1,1,1,1,1),
+  mr_gauge("mr_gauge",1,1,1,1,1),
   pamr(new Z4c_AMR(pin)) {
   // (1) read time-evolution option [already error checked in driver constructor]
   // Then initialize memory and algorithms for reconstruction and Riemann solvers
@@ -78,13 +81,13 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
   int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
   Kokkos::Profiling::pushRegion("Tensor fields");
-  Kokkos::realloc(u_con, nmb, (ncon), ncells3, ncells2, ncells1);
+  realloc_first_touch(u_con, nmb, (ncon), ncells3, ncells2, ncells1);
   // Matter commented out
   // kokkos::realloc(u_mat, nmb, (N_MAT), ncells3, ncells2, ncells1);
-  Kokkos::realloc(u0,    nmb, (nz4c), ncells3, ncells2, ncells1);
-  Kokkos::realloc(u1,    nmb, (nz4c), ncells3, ncells2, ncells1);
-  Kokkos::realloc(u_rhs, nmb, (nz4c), ncells3, ncells2, ncells1);
-  Kokkos::realloc(u_weyl,    nmb, (2), ncells3, ncells2, ncells1);
+  realloc_first_touch(u0,    nmb, (nz4c), ncells3, ncells2, ncells1);
+  realloc_first_touch(u1,    nmb, (nz4c), ncells3, ncells2, ncells1);
+  realloc_first_touch(u_rhs, nmb, (nz4c), ncells3, ncells2, ncells1);
+  realloc_first_touch(u_weyl,    nmb, (2), ncells3, ncells2, ncells1);
 
   con.C.InitWithShallowSlice(u_con, I_CON_C);
   con.H.InitWithShallowSlice(u_con, I_CON_H);
@@ -153,8 +156,8 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
     int nccells1 = indcs.cnx1 + 2*(indcs.ng);
     int nccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int nccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
-    Kokkos::realloc(coarse_u0, nmb, (nz4c), nccells3, nccells2, nccells1);
-    Kokkos::realloc(coarse_u_weyl, nmb, (2), nccells3, nccells2, nccells1);
+    realloc_first_touch(coarse_u0, nmb, (nz4c), nccells3, nccells2, nccells1);
+    realloc_first_touch(coarse_u_weyl, nmb, (2), nccells3, nccells2, nccells1);
   }
   Kokkos::Profiling::popRegion();
 
@@ -166,6 +169,35 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   pbval_weyl->InitializeBuffers((2));
   Kokkos::Profiling::popRegion();
 
+  // multirate coupling to matter.  Spacetime is evolved with a timestep mr_nsub times
+  // larger than that of the matter, which sees ADM variables interpolated in time.
+  mr_nsub = pin->GetOrAddInteger("z4c", "multirate_nsub", 1);
+  if (mr_nsub < 1) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<z4c>/multirate_nsub must be >= 1" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // TODO(@user): extend multirate coupling to AMR (time levels must be remapped)
+  if (mr_nsub > 1 && ppack->pmesh->adaptive) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<z4c>/multirate_nsub > 1 does not yet work with AMR" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  mr_step = true;
+  mr_init = false;
+  mr_dt = 0.0;
+  mr_dtsub = 0.0;
+  mr_told = 0.0;
+  mr_tnew = 0.0;
+  if (mr_nsub > 1) {
+    int ncells1 = indcs.nx1 + 2*(indcs.ng);
+    int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+    int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+    realloc_first_touch(mr_adm_old, nmb, (adm::ADM::nadm), ncells3, ncells2, ncells1);
+    realloc_first_touch(mr_adm_new, nmb, (adm::ADM::nadm), ncells3, ncells2, ncells1);
+    realloc_first_touch(mr_gauge,   nmb, 4, ncells3, ncells2, ncells1);
+  }
+
   // wave extraction spheres
   // TODO(@hzhu): Read radii from input file
   auto &grids = spherical_grids;
@@ -213,7 +245,7 @@ void Z4c::AlgConstr(MeshBlockPack *pmbp) {
   int nmb = pmbp->nmb_thispack;
 
   auto &z4c = pmbp->pz4c->z4c;
-  par_for("Alg constr loop",DevExeSpace(),
+  par_for("Alg constr loop",TaskExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     Real detg = adm::SpatialDet(z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
@@ -58,6 +58,7 @@ struct Z4cTaskIDs {
   TaskID weyl_recv;
   TaskID csendweyl;
   TaskID crecvweyl;
+  TaskID mrstep;
 };
 
 namespace z4c {
@@ -207,6 +208,18 @@ class Z4c {
 
   // following only used for time-evolving flow
   Real dtnew;
+
+  // multirate coupling to matter: spacetime is advanced once every mr_nsub matter steps,
+  // and matter sees ADM variables interpolated in time between the last two spacetime
+  // steps (stored in mr_adm_old, mr_adm_new at times mr_told, mr_tnew)
+  int mr_nsub;            // number of matter steps per spacetime step (1 = lock-step)
+  bool mr_step;           // true if spacetime is advanced in current cycle
+  bool mr_init;           // true once time levels have been initialized
+  Real mr_dt;             // spacetime timestep
+  Real mr_dtsub;          // matter timestep before clipping to spacetime time levels
+  Real mr_told, mr_tnew;  // times of the stored spacetime levels
+  DvceArray5D<Real> mr_adm_old, mr_adm_new;  // ADM variables (including gauge)
+  DvceArray5D<Real> mr_gauge;                // evolved lapse and shift of Z4c
   // container to hold names of TaskIDs
   Z4cTaskIDs id;
 
@@ -247,6 +260,7 @@ class Z4c {
   TaskStatus TrackCompactObjects(Driver *d, int stage);
   TaskStatus CalcWeylScalar(Driver *d, int stage);
   TaskStatus CalcWaveForm(Driver *d, int stage);
+  TaskStatus MultirateSelectStep(Driver *d, int stage);
 
   template <int NGHOST>
   TaskStatus CalcRHS(Driver *d, int stage);
@@ -260,6 +274,8 @@ class Z4c {
   void Z4cWeyl(MeshBlockPack *pmbp);
   void WaveExtr(MeshBlockPack *pmbp);
   void AlgConstr(MeshBlockPack *pmbp);
+  void MultirateInterpolateADM(Driver *d, int stage);
+  void MultirateLimitDt(Real &dt, const Real time);
 
   Z4c_AMR *pamr;
   std::list<CompactObjectTracker> ptracker;
@@ -149,7 +149,7 @@ TaskStatus Z4c::Z4cBoundaryRHS(Driver *pdriver, int stage) {
       || pm->mesh_bcs[BoundaryFace::outer_x1] == BoundaryFlag::outflow
       || pm->mesh_bcs[BoundaryFace::outer_x1] == BoundaryFlag::diode
       || pm->mesh_bcs[BoundaryFace::outer_x1] == BoundaryFlag::user) {
-    par_for("z4crhs_bc_x1", DevExeSpace(), 0, (nmb-1), ks, ke, js, je,
+    par_for("z4crhs_bc_x1", TaskExeSpace(), 0, (nmb-1), ks, ke, js, je,
     KOKKOS_LAMBDA(int m, int k, int j) {
       // Inner boundary
       switch(mb_bcs.d_view(m,BoundaryFace::inner_x1)) {
@@ -187,7 +187,7 @@ TaskStatus Z4c::Z4cBoundaryRHS(Driver *pdriver, int stage) {
       || pm->mesh_bcs[BoundaryFace::outer_x2] == BoundaryFlag::outflow
       || pm->mesh_bcs[BoundaryFace::outer_x2] == BoundaryFlag::diode
       || pm->mesh_bcs[BoundaryFace::outer_x2] == BoundaryFlag::user) {
-    par_for("z4crhs_bc_x2", DevExeSpace(), 0, (nmb-1), ks, ke, is, ie,
+    par_for("z4crhs_bc_x2", TaskExeSpace(), 0, (nmb-1), ks, ke, is, ie,
     KOKKOS_LAMBDA(int m, int k, int i) {
       // Inner boundary
       switch(mb_bcs.d_view(m,BoundaryFace::inner_x2)) {
@@ -225,7 +225,7 @@ TaskStatus Z4c::Z4cBoundaryRHS(Driver *pdriver, int stage) {
       || pm->mesh_bcs[BoundaryFace::outer_x3] == BoundaryFlag::outflow
       || pm->mesh_bcs[BoundaryFace::outer_x3] == BoundaryFlag::diode
       || pm->mesh_bcs[BoundaryFace::outer_x3] == BoundaryFlag::user) {
-    par_for("z4crhs_bc_x3", DevExeSpace(), 0, (nmb-1), js, je, is, ie,
+    par_for("z4crhs_bc_x3", TaskExeSpace(), 0, (nmb-1), js, je, is, ie,
     KOKKOS_LAMBDA(int m, int j, int i) {
       // Inner boundary
       switch(mb_bcs.d_view(m,BoundaryFace::inner_x3)) {
@@ -214,7 +214,7 @@ void Z4c::Z4cToADM(MeshBlockPack *pmbp) {
   auto &z4c = pmbp->pz4c->z4c;
   auto &adm = pmbp->padm->adm;
   auto &opt = pmbp->pz4c->opt;
-  par_for("initialize z4c fields",DevExeSpace(),
+  par_for("initialize z4c fields",TaskExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     adm.psi4(m,k,j,i) = pow(z4c.chi(m,k,j,i), 4./opt.chi_psi_power);
@@ -270,7 +270,7 @@ void Z4c::ADMConstraints(MeshBlockPack *pmbp) {
 
   Kokkos::deep_copy(u_con, 0.);
   auto &con = pmbp->pz4c->con;
-  par_for("ADM constraints loop",DevExeSpace(),
+  par_for("ADM constraints loop",TaskExeSpace(),
   0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> Gamma_u;
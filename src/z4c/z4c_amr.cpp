@@ -146,7 +146,7 @@ void Z4c_AMR::RefineChiMin(MeshBlockPack *pmbp) {
   auto chi_thresh = this->chi_thresh;
 
   par_for_outer(
-    "Z4c_AMR::ChiMin", DevExeSpace(), 0, 0, 0, (nmb - 1),
+    "Z4c_AMR::ChiMin", TaskExeSpace(), 0, 0, 0, (nmb - 1),
     KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
       Real team_dmin;
       Kokkos::parallel_reduce(
@@ -192,7 +192,7 @@ void Z4c_AMR::RefineDchiMax(MeshBlockPack *pmbp) {
   auto dchi_thresh = this->dchi_thresh;
 
   par_for_outer(
-    "Z4c_AMR::ChiMin", DevExeSpace(), 0, 0, 0, (nmb - 1),
+    "Z4c_AMR::ChiMin", TaskExeSpace(), 0, 0, 0, (nmb - 1),
     KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
       Real team_dmax;
       Kokkos::parallel_reduce(
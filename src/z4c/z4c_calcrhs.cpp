@@ -45,7 +45,7 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
   // ===================================================================================
   // Main RHS calculation
   //
-  par_for("z4c rhs loop",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  par_for("z4c rhs loop",TaskExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
     // Define scratch arrays to be used in the following calculations
 
@@ -571,7 +571,7 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
   auto &u0 = pmy_pack->pz4c->u0;
   auto &u_rhs = pmy_pack->pz4c->u_rhs;
   par_for("K-O Dissipation",
-  DevExeSpace(),0,nmb-1,0,nz4c-1,ks,ke,js,je,is,ie,
+  TaskExeSpace(),0,nmb-1,0,nz4c-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
     Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
     for(int a = 0; a < 3; ++a) {
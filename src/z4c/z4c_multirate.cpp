@@ -0,0 +1,186 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file z4c_multirate.cpp
+//! \brief functions implementing multirate coupling between the Z4c spacetime and the
+//! matter evolution, enabled with <z4c>/multirate_nsub > 1.
+//!
+//! The spacetime is advanced with a timestep mr_dt = multirate_nsub*dt at the first
+//! matter step of each interval, using the stress-energy tensor of the matter at the
+//! beginning of the interval.  The ADM variables (including lapse and shift) at the two
+//! most recent spacetime levels are stored, and at the end of every matter stage the
+//! metric seen by the matter is linearly interpolated in time between them.  During the
+//! matter step in which the spacetime is advanced, the new level is not yet available
+//! for intermediate stages, so the metric is extrapolated from the previous two levels.
+//! Matter steps are shortened so that they end exactly on the spacetime levels.
+//!
+//! Since the lapse and shift seen by the matter are stored in Z4c::u0, the evolved gauge
+//! variables are saved in mr_gauge and restored before each spacetime stage.
+//!
+//! Restart files store both spacetime levels, the evolved gauge and the times mr_told
+//! and mr_tnew, so runs can be restarted in the middle of an interval.  The interpolated
+//! metric is then recomputed by ConvertZ4cToADM() at stage 0.  Waveforms and constraints
+//! computed in between use the spacetime at time mr_tnew.
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "coordinates/adm.hpp"
+#include "z4c/z4c.hpp"
+
+namespace z4c {
+
+// tolerance (relative to dt) used to decide whether matter is at a spacetime level
+static constexpr Real mr_eps = 1.0e-6;
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Z4c::MultirateSelectStep
+//! \brief Called at start of each cycle.  Decides whether the spacetime is advanced in
+//! this cycle, and if so sets its timestep.  Initializes the stored time levels on the
+//! first call.
+
+TaskStatus Z4c::MultirateSelectStep(Driver *pdrive, int stage) {
+  if (mr_nsub == 1 || stage != 1) {
+    return TaskStatus::complete;
+  }
+  Real &time = pmy_pack->pmesh->time;
+  Real &dt = pmy_pack->pmesh->dt;
+
+  // initialize both time levels with current spacetime
+  if (!(mr_init)) {
+    int nmb1 = pmy_pack->nmb_thispack - 1;
+    int n3 = mr_adm_old.extent_int(2) - 1;
+    int n2 = mr_adm_old.extent_int(3) - 1;
+    int n1 = mr_adm_old.extent_int(4) - 1;
+    int nmetric = adm::ADM::nadm - 4;
+    auto &u_adm = pmy_pack->padm->u_adm;
+    auto &u0_ = u0;
+    auto &adm_old = mr_adm_old;
+    auto &adm_new = mr_adm_new;
+    auto &gauge = mr_gauge;
+    par_for("z4c_mr_init",TaskExeSpace(),0,nmb1,0,n3,0,n2,0,n1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      for (int n=0; n<nmetric; ++n) {
+        adm_old(m,n,k,j,i) = u_adm(m,n,k,j,i);
+        adm_new(m,n,k,j,i) = u_adm(m,n,k,j,i);
+      }
+      for (int n=0; n<4; ++n) {
+        Real g = u0_(m,I_Z4C_ALPHA+n,k,j,i);
+        adm_old(m,nmetric+n,k,j,i) = g;
+        adm_new(m,nmetric+n,k,j,i) = g;
+        gauge(m,n,k,j,i) = g;
+      }
+    });
+    mr_told = time;
+    mr_tnew = time;
+    mr_init = true;
+  }
+
+  // advance spacetime once matter has reached the latest spacetime level
+  mr_step = (time + mr_eps*dt >= mr_tnew);
+  if (mr_step) {
+    mr_dt = mr_nsub*mr_dtsub;
+    if (time < pdrive->tlim) {
+      mr_dt = std::min(mr_dt, pdrive->tlim - time);
+    }
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4c::MultirateInterpolateADM
+//! \brief Sets ADM variables (including lapse and shift) at the time reached by the
+//! matter at the end of this stage.  After the last stage of a spacetime step, the new
+//! level is computed from the Z4c variables and the time levels are shifted.  Called
+//! with stage=0 on restarts to set the ADM variables at the current time.
+
+void Z4c::MultirateInterpolateADM(Driver *pdrive, int stage) {
+  Real &time = pmy_pack->pmesh->time;
+  Real &dt = pmy_pack->pmesh->dt;
+
+  // fraction of the matter timestep reached at the end of this stage, computed by
+  // applying the integrator to du/dt=1 with u(0)=0
+  Real tau0 = 0.0, tau1 = 0.0;
+  for (int s=1; s<=stage; ++s) {
+    if (pdrive->integrator == "rk4" && s > 1) {
+      tau1 += pdrive->delta[s-1]*tau0;
+    }
+    tau0 = pdrive->gam0[s-1]*tau0 + pdrive->gam1[s-1]*tau1 + pdrive->beta[s-1];
+  }
+  Real tstage = time + tau0*dt;
+
+  bool shift_levels = (mr_step && stage == pdrive->nexp_stages);
+  if (shift_levels) {
+    Z4cToADM(pmy_pack);
+    mr_told = mr_tnew;
+    mr_tnew += mr_dt;
+  }
+  Real w = (mr_tnew > mr_told)? (tstage - mr_told)/(mr_tnew - mr_told) : 1.0;
+
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int n3 = mr_adm_old.extent_int(2) - 1;
+  int n2 = mr_adm_old.extent_int(3) - 1;
+  int n1 = mr_adm_old.extent_int(4) - 1;
+  int nmetric = adm::ADM::nadm - 4;
+  bool save_gauge = (mr_step && stage > 0);
+  auto &u_adm = pmy_pack->padm->u_adm;
+  auto &u0_ = u0;
+  auto &adm_old = mr_adm_old;
+  auto &adm_new = mr_adm_new;
+  auto &gauge = mr_gauge;
+  par_for("z4c_mr_interp",TaskExeSpace(),0,nmb1,0,n3,0,n2,0,n1,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    // save evolved lapse and shift before they are overwritten
+    if (save_gauge) {
+      for (int n=0; n<4; ++n) {
+        gauge(m,n,k,j,i) = u0_(m,I_Z4C_ALPHA+n,k,j,i);
+      }
+    }
+    if (shift_levels) {
+      for (int n=0; n<nmetric; ++n) {
+        adm_old(m,n,k,j,i) = adm_new(m,n,k,j,i);
+        adm_new(m,n,k,j,i) = u_adm(m,n,k,j,i);
+      }
+      for (int n=0; n<4; ++n) {
+        adm_old(m,nmetric+n,k,j,i) = adm_new(m,nmetric+n,k,j,i);
+        adm_new(m,nmetric+n,k,j,i) = gauge(m,n,k,j,i);
+      }
+    }
+    for (int n=0; n<nmetric; ++n) {
+      u_adm(m,n,k,j,i) = (1.0 - w)*adm_old(m,n,k,j,i) + w*adm_new(m,n,k,j,i);
+    }
+    for (int n=0; n<4; ++n) {
+      u0_(m,I_Z4C_ALPHA+n,k,j,i) = (1.0 - w)*adm_old(m,nmetric+n,k,j,i) +
+                                   w*adm_new(m,nmetric+n,k,j,i);
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4c::MultirateLimitDt
+//! \brief Called by Mesh::NewTimeStep() with the new matter timestep.  Stores it for use
+//! in setting the next spacetime timestep, and shortens it so that the remaining matter
+//! steps in the current interval are of equal length and end on the latest spacetime
+//! level.
+
+void Z4c::MultirateLimitDt(Real &dt, const Real time) {
+  if (mr_nsub == 1) {
+    return;
+  }
+  mr_dtsub = dt;
+  Real trem = mr_tnew - time;
+  if (mr_init && trem > mr_eps*dt) {
+    Real nsteps = std::ceil(trem/dt - mr_eps);
+    dt = trem/nsteps;
+  }
+  return;
+}
+
+} // namespace z4c
@@ -34,36 +34,46 @@ void Z4c::QueueZ4cTasks() {
   NumericalRelativity *pnr = pmy_pack->pnr;
   auto &indcs = pmy_pack->pmesh->mb_indcs;
 
+  // With multirate coupling, tasks that advance the spacetime are skipped in cycles in
+  // which only the matter is evolved (see MultirateSelectStep).
+  auto mr = [this](TaskStatus (Z4c::*func)(Driver *, int)) {
+    return [this, func](Driver *d, int s) -> TaskStatus {
+      return (mr_step)? (this->*func)(d,s) : TaskStatus::complete;
+    };
+  };
+
   // Start task list
-  pnr->QueueTask(&Z4c::InitRecv, this, Z4c_Recv, "Z4c_Recv", Task_Start);
-  pnr->QueueTask(&Z4c::InitRecvWeyl, this, Z4c_IRecvW, "Z4c_IRecvW", Task_Start);
+  pnr->QueueTask(&Z4c::MultirateSelectStep, this, Z4c_MRStep, "Z4c_MRStep", Task_Start);
+  pnr->QueueTask(mr(&Z4c::InitRecv), Z4c_Recv, "Z4c_Recv", Task_Start, {Z4c_MRStep});
+  pnr->QueueTask(mr(&Z4c::InitRecvWeyl), Z4c_IRecvW, "Z4c_IRecvW", Task_Start,
+                 {Z4c_MRStep});
 
   // Run task list
-  pnr->QueueTask(&Z4c::CopyU, this, Z4c_CopyU, "Z4c_CopyU", Task_Run);
+  pnr->QueueTask(mr(&Z4c::CopyU), Z4c_CopyU, "Z4c_CopyU", Task_Run);
   switch (indcs.ng) {
     case 2:
-      pnr->QueueTask(&Z4c::CalcRHS<2>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
+      pnr->QueueTask(mr(&Z4c::CalcRHS<2>), Z4c_CalcRHS, "Z4c_CalcRHS",
                      Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
       break;
     case 3:
-      pnr->QueueTask(&Z4c::CalcRHS<3>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
+      pnr->QueueTask(mr(&Z4c::CalcRHS<3>), Z4c_CalcRHS, "Z4c_CalcRHS",
                      Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
       break;
     case 4:
-      pnr->QueueTask(&Z4c::CalcRHS<4>, this, Z4c_CalcRHS, "Z4c_CalcRHS",
+      pnr->QueueTask(mr(&Z4c::CalcRHS<4>), Z4c_CalcRHS, "Z4c_CalcRHS",
                      Task_Run, {Z4c_CopyU}, {MHD_SetTmunu});
       break;
   }
-  pnr->QueueTask(&Z4c::Z4cBoundaryRHS, this, Z4c_SomBC, "Z4c_SomBC", Task_Run,
+  pnr->QueueTask(mr(&Z4c::Z4cBoundaryRHS), Z4c_SomBC, "Z4c_SomBC", Task_Run,
                  {Z4c_CalcRHS});
-  pnr->QueueTask(&Z4c::ExpRKUpdate, this, Z4c_ExplRK, "Z4c_ExplRK", Task_Run,
+  pnr->QueueTask(mr(&Z4c::ExpRKUpdate), Z4c_ExplRK, "Z4c_ExplRK", Task_Run,
                  {Z4c_SomBC},{MHD_EField});
-  pnr->QueueTask(&Z4c::RestrictU, this, Z4c_RestU, "Z4c_RestU", Task_Run, {Z4c_ExplRK});
-  pnr->QueueTask(&Z4c::SendU, this, Z4c_SendU, "Z4c_SendU", Task_Run, {Z4c_RestU});
-  pnr->QueueTask(&Z4c::RecvU, this, Z4c_RecvU, "Z4c_RecvU", Task_Run, {Z4c_SendU});
-  pnr->QueueTask(&Z4c::ApplyPhysicalBCs, this, Z4c_BCS, "Z4c_BCS", Task_Run, {Z4c_RecvU});
-  pnr->QueueTask(&Z4c::Prolongate, this, Z4c_Prolong, "Z4c_Prolong", Task_Run, {Z4c_BCS});
-  pnr->QueueTask(&Z4c::EnforceAlgConstr, this, Z4c_AlgC, "Z4c_AlgC", Task_Run,
+  pnr->QueueTask(mr(&Z4c::RestrictU), Z4c_RestU, "Z4c_RestU", Task_Run, {Z4c_ExplRK});
+  pnr->QueueTask(mr(&Z4c::SendU), Z4c_SendU, "Z4c_SendU", Task_Run, {Z4c_RestU});
+  pnr->QueueTask(mr(&Z4c::RecvU), Z4c_RecvU, "Z4c_RecvU", Task_Run, {Z4c_SendU});
+  pnr->QueueTask(mr(&Z4c::ApplyPhysicalBCs), Z4c_BCS, "Z4c_BCS", Task_Run, {Z4c_RecvU});
+  pnr->QueueTask(mr(&Z4c::Prolongate), Z4c_Prolong, "Z4c_Prolong", Task_Run, {Z4c_BCS});
+  pnr->QueueTask(mr(&Z4c::EnforceAlgConstr), Z4c_AlgC, "Z4c_AlgC", Task_Run,
                  {Z4c_Prolong});
   pnr->QueueTask(&Z4c::ConvertZ4cToADM, this, Z4c_Z4c2ADM, "Z4c_Z4c2ADM",
                  Task_Run, {Z4c_AlgC});
@@ -75,24 +85,24 @@ void Z4c::QueueZ4cTasks() {
                  {Z4c_Z4c2ADM});
 
   // End task list
-  pnr->QueueTask(&Z4c::ClearSend, this, Z4c_ClearS, "Z4c_ClearS", Task_End);
-  pnr->QueueTask(&Z4c::ClearRecv, this, Z4c_ClearR, "Z4c_ClearR", Task_End, {Z4c_ClearS});
+  pnr->QueueTask(mr(&Z4c::ClearSend), Z4c_ClearS, "Z4c_ClearS", Task_End);
+  pnr->QueueTask(mr(&Z4c::ClearRecv), Z4c_ClearR, "Z4c_ClearR", Task_End, {Z4c_ClearS});
   /*pnr->QueueTask(&Z4c::Z4cToADM, this, Z4c_Z4c2ADM, "Z4c_Z4c2ADM", Task_End,
                  {Z4c_ClearR});*/
   pnr->QueueTask(&Z4c::ADMConstraints_, this, Z4c_ADMC, "Z4c_ADMC", Task_End,
   //               {Z4c_Z4c2ADM});
                  {Z4c_ClearR});
-  pnr->QueueTask(&Z4c::CalcWeylScalar, this, Z4c_Weyl, "Z4c_Weyl", Task_End, {Z4c_ADMC});
-  pnr->QueueTask(&Z4c::RestrictWeyl, this, Z4c_RestW, "Z4c_RestW", Task_End, {Z4c_Weyl});
-  pnr->QueueTask(&Z4c::SendWeyl, this, Z4c_SendW, "Z4c_SendW", Task_End, {Z4c_RestW});
-  pnr->QueueTask(&Z4c::RecvWeyl, this, Z4c_RecvW, "Z4c_RecvW", Task_End, {Z4c_SendW});
-  pnr->QueueTask(&Z4c::ProlongateWeyl, this, Z4c_ProlW, "Z4c_ProlW", Task_End,
+  pnr->QueueTask(mr(&Z4c::CalcWeylScalar), Z4c_Weyl, "Z4c_Weyl", Task_End, {Z4c_ADMC});
+  pnr->QueueTask(mr(&Z4c::RestrictWeyl), Z4c_RestW, "Z4c_RestW", Task_End, {Z4c_Weyl});
+  pnr->QueueTask(mr(&Z4c::SendWeyl), Z4c_SendW, "Z4c_SendW", Task_End, {Z4c_RestW});
+  pnr->QueueTask(mr(&Z4c::RecvWeyl), Z4c_RecvW, "Z4c_RecvW", Task_End, {Z4c_SendW});
+  pnr->QueueTask(mr(&Z4c::ProlongateWeyl), Z4c_ProlW, "Z4c_ProlW", Task_End,
                  {Z4c_RecvW});
-  pnr->QueueTask(&Z4c::ClearSendWeyl, this, Z4c_ClearSW, "Z4c_ClearS2", Task_End,
+  pnr->QueueTask(mr(&Z4c::ClearSendWeyl), Z4c_ClearSW, "Z4c_ClearS2", Task_End,
                  {Z4c_ProlW});
-  pnr->QueueTask(&Z4c::ClearRecvWeyl, this, Z4c_ClearRW, "Z4c_ClearR2", Task_End,
+  pnr->QueueTask(mr(&Z4c::ClearRecvWeyl), Z4c_ClearRW, "Z4c_ClearR2", Task_End,
                  {Z4c_ClearSW});
-  pnr->QueueTask(&Z4c::CalcWaveForm, this, Z4c_Wave, "Z4c_Wave", Task_End,
+  pnr->QueueTask(mr(&Z4c::CalcWaveForm), Z4c_Wave, "Z4c_Wave", Task_End,
                  {Z4c_ClearRW});
   pnr->QueueTask(&Z4c::TrackCompactObjects, this, Z4c_PT, "Z4c_PT", Task_End, {Z4c_Wave});
 }
@@ -144,22 +154,31 @@ TaskStatus Z4c::CopyU(Driver *pdrive, int stage) {
   auto &u0 = pmy_pack->pz4c->u0;
   auto &u1 = pmy_pack->pz4c->u1;
 
+  // with multirate coupling, restore evolved lapse and shift (overwritten by the values
+  // interpolated in time for the matter, see MultirateInterpolateADM)
+  if (mr_nsub > 1) {
+    auto gauge = Kokkos::subview(u0, Kokkos::ALL,
+                   std::make_pair(static_cast<int>(I_Z4C_ALPHA), I_Z4C_BETAZ+1),
+                   Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
+    Kokkos::deep_copy(TaskExeSpace(), gauge, mr_gauge);
+  }
+
   // hierarchical parallel loop that updates conserved variables to intermediate step
   // using weights and fractional time step appropriate to stages of time-integrator.
   // Important to use vector inner loop for good performance on cpus
   if (integrator == "rk4") {
     Real &delta = pdrive->delta[stage-1];
     if (stage == 1) {
-      Kokkos::deep_copy(DevExeSpace(), u1, u0);
+      Kokkos::deep_copy(TaskExeSpace(), u1, u0);
     } else {
-      par_for("CopyCons", DevExeSpace(),0, nmb1, 0, nvar-1, ks, ke, js, je, is, ie,
+      par_for("CopyCons", TaskExeSpace(),0, nmb1, 0, nvar-1, ks, ke, js, je, is, ie,
       KOKKOS_LAMBDA(int m, int n, int k, int j, int i){
         u1(m,n,k,j,i) += delta*u0(m,n,k,j,i);
       });
     }
   } else {
     if (stage == 1) {
-      Kokkos::deep_copy(DevExeSpace(), u1, u0);
+      Kokkos::deep_copy(TaskExeSpace(), u1, u0);
     }
   }
   return TaskStatus::complete;
@@ -199,7 +218,11 @@ TaskStatus Z4c::EnforceAlgConstr(Driver *pdrive, int stage) {
 //! \brief
 
 TaskStatus Z4c::ConvertZ4cToADM(Driver *pdrive, int stage) {
-  if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
+  // with multirate coupling the metric is interpolated between the stored levels, also
+  // at stage 0 after a restart written in the middle of an interval
+  if (mr_nsub > 1 && (stage > 0 || mr_init)) {
+    MultirateInterpolateADM(pdrive, stage);
+  } else if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
     Z4cToADM(pmy_pack);
   }
   return TaskStatus::complete;
@@ -27,14 +27,16 @@ TaskStatus Z4c::ExpRKUpdate(Driver *pdriver, int stage) {
 
   Real &gam0 = pdriver->gam0[stage-1];
   Real &gam1 = pdriver->gam1[stage-1];
-  Real beta_dt = (pdriver->beta[stage-1])*(pmy_pack->pmesh->dt);
+  // with multirate coupling, spacetime is advanced with its own (larger) timestep
+  Real dt = (mr_nsub > 1)? mr_dt : pmy_pack->pmesh->dt;
+  Real beta_dt = (pdriver->beta[stage-1])*dt;
   auto &u0 = pmy_pack->pz4c->u0;
   auto &u1 = pmy_pack->pz4c->u1;
   auto &u_rhs = pmy_pack->pz4c->u_rhs;
   int nmb1 = pmy_pack->nmb_thispack - 1;
   int nvar = nz4c;
 
-  par_for("z4c RK update",DevExeSpace(),
+  par_for("z4c RK update",TaskExeSpace(),
       0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
     u0(m,n,k,j,i) = gam0*u0(m,n,k,j,i) + gam1*u1(m,n,k,j,i) + beta_dt*u_rhs(m,n,k,j,i);
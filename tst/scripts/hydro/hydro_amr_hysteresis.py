@@ -0,0 +1,72 @@
+# Regression test for refinement buffers and derefinement hysteresis in AMR
+#
+# Runs the 2D hydro blast wave with AMR checked every cycle using the instantaneous
+# pressure-gradient criterion, and again checking only every 4 cycles with a buffer of
+# refined MeshBlocks, a lower derefinement threshold, and deferred derefinement.  Checks
+# that the second run creates and deletes fewer MeshBlocks, while the kinetic energy of
+# the blast (sensitive to resolution of the shock) agrees between the two runs.
+#
+# The blast problem generator is a user pgen, so this test only runs when built with
+# -D PROBLEM=blast.  With any other build the test does nothing and passes.
+
+# Modules
+import logging
+import re
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_skip = False
+_amr_counts = {}
+_cases = {'instant': ['mesh_refinement/ncycle_check=1',
+                      'mesh_refinement/refinement_interval=1'],
+          'hysteresis': ['mesh_refinement/ncycle_check=4',
+                         'mesh_refinement/refinement_interval=1',
+                         'mesh_refinement/refine_buffer=1',
+                         'mesh_refinement/dpres_deref=0.02',
+                         'mesh_refinement/derefine_count=3']}
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    global _skip
+    problem = athena.cmake_cache('PROBLEM')
+    if problem != 'blast':
+        logger.info('Skipping test ' + __name__ + ', built with PROBLEM=' +
+                    str(problem))
+        _skip = True
+        return
+    for name, args in _cases.items():
+        arguments = ['job/basename=amr_' + name,
+                     'time/tlim=0.2',
+                     'output1/dt=0.2',
+                     'output2/dt=-1.0'] + args
+        output = athena.run_output('hydro/blast_hydro_amr.athinput', arguments)
+        match = re.search(r'(\d+) MeshBlocks created, (\d+) deleted', output)
+        _amr_counts[name] = int(match.group(1)) + int(match.group(2))
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    if _skip:
+        return analyze_status
+    ke = {}
+    for name in _cases:
+        data = athena_read.hst('build/src/amr_' + name + '.hydro.hst')
+        ke[name] = data['1-KE'][-1] + data['2-KE'][-1]
+    if _amr_counts['hysteresis'] >= _amr_counts['instant']:
+        logger.warning("hysteresis did not reduce number of MeshBlocks created/deleted: "
+                       "{0:d} vs {1:d}".format(_amr_counts['hysteresis'],
+                                               _amr_counts['instant']))
+        analyze_status = False
+    rel_diff = abs(ke['hysteresis'] - ke['instant'])/ke['instant']
+    if rel_diff > 0.01:
+        logger.warning("kinetic energy differs by {0:g} with hysteresis".format(rel_diff))
+        analyze_status = False
+
+    return analyze_status
@@ -0,0 +1,66 @@
+# Regression test for deep-halo integration of hydrodynamics
+#
+# Runs the 3D hydro linear wave test with <time>/deep_halo off and on, for each explicit
+# integrator that supports it.  With deep_halo, ghost zones are exchanged only once per
+# step and earlier stages update a halo of ghost cells redundantly, which must give the
+# same result as exchanging ghost zones every stage.  Checks that the errors (which are
+# computed by the executable and stored in hydro_deep_halo-errs.dat) are identical.
+
+# Modules
+import logging
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_int = ['rk2', 'vl2', 'rk3']
+_halo = ['false', 'true']
+_wave = [('L-sound', 0, 0.0), ('entropy', 3, 1.0)]
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for iv in _int:
+        for wave in _wave:
+            for hv in _halo:
+                arguments = ['job/basename=hydro_deep_halo',
+                             'time/tlim=1.0',
+                             'time/integrator=' + iv,
+                             'time/deep_halo=' + hv,
+                             'mesh/nghost=6',
+                             'mesh/nx1=32',
+                             'mesh/nx2=16',
+                             'mesh/nx3=16',
+                             'meshblock/nx1=8',
+                             'meshblock/nx2=8',
+                             'meshblock/nx3=8',
+                             'hydro/reconstruct=plm',
+                             'hydro/rsolver=hllc',
+                             'problem/amp=1.0e-6',
+                             'problem/wave_flag=' + repr(wave[1]),
+                             'problem/vflow=' + repr(wave[2]),
+                             'output1/dt=-1.0',
+                             'output2/dt=-1.0',
+                             'output3/dt=-1.0']
+                athena.run('tests/linear_wave_hydro.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    data = athena_read.error_dat('build/src/hydro_deep_halo-errs.dat')
+    data = data.reshape([len(_int), len(_wave), len(_halo), data.shape[-1]])
+    for ii, iv in enumerate(_int):
+        for wi, wave in enumerate(_wave):
+            off = data[ii, wi, 0]
+            on = data[ii, wi, 1]
+            if not (off == on).all():
+                logger.warning("{0} wave with {1} differs with deep_halo, cycles: "
+                               "{2:g} {3:g} RMS-L1 errors: {4:g} {5:g}".format(
+                                   wave[0], iv, off[3], on[3], off[4], on[4]))
+                analyze_status = False
+
+    return analyze_status
@@ -13,7 +13,7 @@ sys.path.insert(0, '../vis/python')
 import athena_read  # noqa
 athena_read.check_nan_flag = True
 logger = logging.getLogger('athena' + __name__[7:])  # set logger name
-_int = ['rk2', 'rk3']
+_int = ['rk2', 'vl2', 'rk3']
 _recon = ['plm', 'ppmx', 'wenoz']
 _flux = ['llf', 'hlle', 'hllc', 'roe']
 _wave = ['L-sound', 'R-sound', 'entropy']
@@ -0,0 +1,75 @@
+# Regression test for boundary communication of many cell-centered variables
+#
+# Advects a sine wave in density and in 32 passive scalars in 1D, 2D and 3D, with the
+# flow along the last dimension in each case.  Each problem is run on a single MeshBlock,
+# where all ghost zones are filled from the periodic image of the same MeshBlock, and on
+# a grid of MeshBlocks, where they are filled from neighbors by the same kernels that
+# unpack boundary buffers.  If AthenaK is built with MPI, the grid of MeshBlocks is also
+# run on 4 ranks, so ghost zones are exchanged through buffers holding every variable.
+# Checks that the profiles of density and of every scalar are identical in all runs, and
+# that all scalars remain identical to each other.
+
+# Modules
+import logging
+import numpy as np
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_nscalars = 32
+_dims = {1: (64, 1, 1), 2: (32, 32, 1), 3: (16, 16, 16)}
+_meshblock = {'one': (64, 32, 16), 'many': (8, 8, 8), 'mpi': (8, 8, 8)}
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    if athena.cmake_cache('Athena_ENABLE_MPI') != 'ON':
+        del _meshblock['mpi']
+    for dim, nx in _dims.items():
+        for mb in _meshblock:
+            arguments = ['job/basename=scalars_' + repr(dim) + 'd_' + mb,
+                         'hydro/nscalars=' + repr(_nscalars),
+                         'hydro/reconstruct=plm',
+                         'problem/advect_dens=true',
+                         'problem/flow_dir=' + repr(dim),
+                         'time/tlim=0.25',
+                         'output1/dt=0.25',
+                         'output1/slice_x2=0.01',
+                         'output1/slice_x3=0.01',
+                         'output2/dt=-1.0',
+                         'output3/dt=-1.0']
+            for d in range(3):
+                arguments.append('mesh/nx' + repr(d+1) + '=' + repr(nx[d]))
+                nmb = _meshblock[mb][dim-1] if nx[d] > 1 else 1
+                arguments.append('meshblock/nx' + repr(d+1) + '=' + repr(nmb))
+            if mb == 'mpi':
+                athena.mpirun(4, 'tests/advect_hyd.athinput', arguments)
+            else:
+                athena.run('tests/advect_hyd.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    for dim in _dims:
+        data = {}
+        for mb in _meshblock:
+            data[mb] = athena_read.tab('build/src/tab/scalars_' + repr(dim) + 'd_' + mb
+                                       + '.hydro_w.00001.tab')
+        names = ['dens'] + ['s_{0:02d}'.format(n) for n in range(_nscalars)]
+        for mb in list(_meshblock)[1:]:
+            for name in names:
+                if not np.array_equal(data['one'][name], data[mb][name]):
+                    logger.warning("{0} in {1}D differs between runs on one MeshBlock "
+                                   "and {2}".format(name, dim, mb))
+                    analyze_status = False
+        for name in names[2:]:
+            if not np.array_equal(data['many'][name], data['many']['s_00']):
+                logger.warning("scalar {0} in {1}D differs from s_00".format(name, dim))
+                analyze_status = False
+
+    return analyze_status
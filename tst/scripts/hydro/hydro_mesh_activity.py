@@ -0,0 +1,90 @@
+# Regression test for freezing of MeshBlocks with <mesh_activity>
+#
+# Runs the 2D hydro blast wave on 8x8 MeshBlocks with MeshBlocks frozen when their
+# relative change per cycle is below change_threshold, and again with change_threshold=0
+# (all MeshBlocks active).  Checks that MeshBlocks were frozen, that cells ahead of the
+# blast stay bit-identical to the initial state until the front arrives, and that the
+# solution agrees with the run without freezing.
+#
+# The blast problem generator is a user pgen, so this test only runs when built with
+#   python3 run_tests.py hydro/hydro_mesh_activity --cmake=-DPROBLEM=blast
+# With any other build the test does nothing and passes.
+
+# Modules
+import logging
+import numpy as np
+import re
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_threshold = {'off': '0.0', 'on': '1.0e-12'}
+_nout = 6
+_frozen = {}
+_skip = False
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    global _skip
+    problem = athena.cmake_cache('PROBLEM')
+    if problem != 'blast':
+        logger.info('Skipping test ' + __name__ + ', built with PROBLEM=' +
+                    str(problem))
+        _skip = True
+        return
+    for name, threshold in _threshold.items():
+        arguments = ['job/basename=activity_' + name,
+                     'mesh_activity/change_threshold=' + threshold]
+        output = athena.run_output('hydro/blast_hydro_activity.athinput', arguments)
+        _frozen[name] = int(re.search(r'(\d+) MeshBlock-cycles frozen', output).group(1))
+
+
+# Read variable from tab output number n of a run
+def _read(name, fid, var, n):
+    data = athena_read.tab('build/src/tab/activity_' + name + '.' + fid +
+                           '.{0:05d}.tab'.format(n))
+    return np.asarray(data[var])
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    if _skip:
+        return analyze_status
+
+    logger.info('MeshBlock-cycles frozen: {0:d}'.format(_frozen['on']))
+    if _frozen['off'] != 0 or _frozen['on'] == 0:
+        logger.warning('MeshBlocks frozen in run without freezing, or not frozen '
+                       'in run with freezing')
+        analyze_status = False
+
+    for fid, var in (('hydro_w_d', 'dens'), ('hydro_w_e', 'eint')):
+        init = _read('on', fid, var, 0)
+        for n in range(1, _nout):
+            on = _read('on', fid, var, n)
+            off = _read('off', fid, var, n)
+            # cells not yet reached by the blast in the run without freezing
+            ahead = (off == init)
+            if n == 1 and not np.any(ahead):
+                logger.warning('blast reached every cell before first output')
+                analyze_status = False
+            if np.any(on[ahead] != init[ahead]):
+                logger.warning('{0} ahead of blast changed in frozen run, output {1:d}'.
+                               format(var, n))
+                analyze_status = False
+
+        # final solution
+        diff = np.sum(np.abs(on - off))/np.sum(np.abs(off))
+        logger.info('{0} L1 difference with and without freezing: {1:g}'.
+                    format(var, diff))
+        if diff > 1.0e-6:
+            logger.warning('{0} with freezing differs from run without by {1:g}'.
+                           format(var, diff))
+            analyze_status = False
+
+    return analyze_status
@@ -0,0 +1,94 @@
+# Regression test for the single-stage VL2 (MUSCL-Hancock) integrator
+#
+# Runs the 2D hydro blast wave with the RK2 and VL2 integrators at the same CFL number.
+# Checks that VL2 conserves mass and total energy to round-off, that the kinetic energy
+# of the blast and the density along a cut through its center agree with the RK2 run,
+# and that the runs take a similar number of cycles.  The speedup of VL2 (one flux
+# calculation and one ghost-zone exchange per cycle) over two-stage RK2 is only printed,
+# since timings are not reproducible on shared test machines.
+#
+# The blast problem generator is a user pgen, so this test only runs when built with
+# -D PROBLEM=blast.  With any other build the test does nothing and passes.
+
+# Modules
+import logging
+import numpy as np
+import re
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_skip = False
+_int = ['rk2', 'vl2']
+_cycles = {}
+_cpu_time = {}
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    global _skip
+    problem = athena.cmake_cache('PROBLEM')
+    if problem != 'blast':
+        logger.info('Skipping test ' + __name__ + ', built with PROBLEM=' +
+                    str(problem))
+        _skip = True
+        return
+    for iv in _int:
+        arguments = ['job/basename=blast_' + iv,
+                     'time/integrator=' + iv,
+                     'time/tlim=0.2',
+                     'output1/dt=0.01',
+                     'output2/file_type=tab',
+                     'output2/variable=hydro_w_d',
+                     'output2/slice_x2=0.0',
+                     'output2/slice_x3=0.0',
+                     'output2/dt=0.2']
+        output = athena.run_output('hydro/blast_hydro.athinput', arguments)
+        _cycles[iv] = int(re.search(r'time=\S+ cycle=(\d+)', output).group(1))
+        _cpu_time[iv] = float(re.search(r'cpu time used\s+=\s+(\S+)', output).group(1))
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    if _skip:
+        return analyze_status
+    ke = {}
+    for iv in _int:
+        data = athena_read.hst('build/src/blast_' + iv + '.hydro.hst')
+        ke[iv] = data['1-KE'][-1] + data['2-KE'][-1]
+        for var in ['mass', 'tot-E']:
+            err = abs(data[var][-1] - data[var][0])/abs(data[var][0])
+            if err > 1.0e-11:
+                logger.warning("{0} not conserved with {1}, relative change {2:g}".
+                               format(var, iv, err))
+                analyze_status = False
+    rel_diff = abs(ke['vl2'] - ke['rk2'])/ke['rk2']
+    if rel_diff > 0.03:
+        logger.warning("kinetic energy with vl2 differs from rk2 by {0:g}".
+                       format(rel_diff))
+        analyze_status = False
+
+    # L1 difference of density along x2=0 relative to the rk2 run
+    dens = {}
+    for iv in _int:
+        data = athena_read.tab('build/src/tab/blast_' + iv + '.hydro_w_d.00001.tab')
+        dens[iv] = np.asarray(data['dens'])
+    l1 = np.mean(np.abs(dens['vl2'] - dens['rk2']))/np.mean(dens['rk2'])
+    logger.info("L1 density difference of vl2 from rk2: {0:g}".format(l1))
+    if l1 > 0.05:
+        logger.warning("density with vl2 differs from rk2, L1 difference {0:g}".
+                       format(l1))
+        analyze_status = False
+
+    if abs(_cycles['vl2'] - _cycles['rk2']) > 0.05*_cycles['rk2']:
+        logger.warning("number of cycles differs: vl2 {0:d} rk2 {1:d}".
+                       format(_cycles['vl2'], _cycles['rk2']))
+        analyze_status = False
+    logger.info("vl2 speedup over rk2: {0:g}".format(_cpu_time['rk2']/_cpu_time['vl2']))
+
+    return analyze_status
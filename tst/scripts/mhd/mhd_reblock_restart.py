@@ -0,0 +1,74 @@
+# Regression test for changing the MeshBlock size on restart
+#
+# Runs the 2D MHD blast wave on 16x16 MeshBlocks, writing a restart file halfway through.
+# Restarts from this file once with MeshBlocks split into 8x8, and once with MeshBlocks
+# merged into 32x32.  On a uniform grid the decomposition does not change the solution,
+# so checks that the final profiles of both restarted runs, which test re-blocking of
+# cell-centered variables and face-centered fields, are identical to the continuous run.
+#
+# The blast problem generator is a user pgen, so this test only runs when built with
+# -D PROBLEM=blast.  With any other build the test does nothing and passes.
+
+# Modules
+import logging
+import numpy as np
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_skip = False
+_reblock = [('split', 8), ('merge', 32)]
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    global _skip
+    problem = athena.cmake_cache('PROBLEM')
+    if problem != 'blast':
+        logger.info('Skipping test ' + __name__ + ', built with PROBLEM=' +
+                    str(problem))
+        _skip = True
+        return
+    arguments = ['job/basename=reblock',
+                 'mesh/nx1=64',
+                 'mesh/nx2=64',
+                 'meshblock/nx1=16',
+                 'meshblock/nx2=16',
+                 'time/tlim=0.1',
+                 'output1/dt=-1.0',
+                 'output2/file_type=tab',
+                 'output2/slice_x2=0.01',
+                 'output2/dt=0.1',
+                 'output3/file_type=rst',
+                 'output3/dt=0.05']
+    athena.run('mhd/blast_mhd.athinput', arguments)
+    for name, nx in _reblock:
+        arguments = ['job/basename=reblock_' + name,
+                     'meshblock/nx1=' + repr(nx),
+                     'meshblock/nx2=' + repr(nx)]
+        athena.restart('rst/reblock.00001.rst', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    if _skip:
+        return analyze_status
+    ref = athena_read.tab('build/src/tab/reblock.mhd_w_bcc.00001.tab')
+    for name, nx in _reblock:
+        data = athena_read.tab('build/src/tab/reblock_' + name + '.mhd_w_bcc.00001.tab')
+        if data['cycle'] != ref['cycle']:
+            logger.warning("restart with {0} MeshBlocks took {1:d} cycles, continuous "
+                           "run took {2:d}".format(name, data['cycle'], ref['cycle']))
+            analyze_status = False
+        for key in ref:
+            if not np.array_equal(ref[key], data[key]):
+                logger.warning("{0} differs from continuous run after restart with {1} "
+                               "MeshBlocks".format(key, name))
+                analyze_status = False
+
+    return analyze_status
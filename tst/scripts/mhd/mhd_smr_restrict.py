@@ -0,0 +1,67 @@
+# Regression test for restricting only the MeshBlocks that need coarse data with SMR
+#
+# Runs the 3D hydro and MHD linear wave tests with SMR, restricting only MeshBlocks with
+# a coarser neighbor (default) and restricting every MeshBlock
+# (<mesh_refinement>/restrict_all=true).  The coarse data of the other MeshBlocks is
+# never used, so the history and the final profile must be identical in both runs.
+
+# Modules
+import logging
+import numpy as np
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_restrict = ['false', 'true']
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for rv in _restrict:
+        arguments = ['job/basename=smr_hydro_' + rv,
+                     'mesh_refinement/restrict_all=' + rv,
+                     'time/tlim=1.0',
+                     'output1/dt=1.0',
+                     'output2/dt=-1.0',
+                     'output3/dt=0.1']
+        athena.run('tests/linear_wave_hydro_smr.athinput', arguments)
+        arguments = ['job/basename=smr_mhd_' + rv,
+                     'mesh_refinement/restrict_all=' + rv,
+                     'time/tlim=1.0',
+                     'output1/dt=1.0',
+                     'output2/dt=1.0',
+                     'output3/dt=-1.0',
+                     'output4/dt=-1.0',
+                     'output5/dt=0.1']
+        athena.run('tests/linear_wave_mhd_smr.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    files = {'hydro': ['hydro_w'], 'mhd': ['mhd_w', 'mhd_bcc']}
+    for phys in files:
+        data = {}
+        for rv in _restrict:
+            data[rv] = athena_read.hst('build/src/smr_' + phys + '_' + rv + '.'
+                                       + phys + '.hst')
+        for key in data['false']:
+            if not np.array_equal(data['false'][key], data['true'][key]):
+                logger.warning("{0} history variable {1} differs with restrict_all".
+                               format(phys, key))
+                analyze_status = False
+        for var in files[phys]:
+            for rv in _restrict:
+                data[rv] = athena_read.tab('build/src/tab/smr_' + phys + '_' + rv + '.'
+                                           + var + '.00001.tab')
+            for key in data['false']:
+                if not np.array_equal(data['false'][key], data['true'][key]):
+                    logger.warning("{0} variable {1} differs with restrict_all".
+                                   format(var, key))
+                    analyze_status = False
+
+    return analyze_status
@@ -0,0 +1,70 @@
+# Regression test for restarting from a buddy checkpoint flushed to disk
+#
+# Runs the 3D hydro linear wave on 8 MeshBlocks and 4 MPI ranks, once writing standard
+# restart files and once writing buddy checkpoints (file_type=brst) that are flushed to
+# a restart file every second checkpoint.  Both runs checkpoint every 0.1, so the second
+# flushed checkpoint (rst file 00001) is taken at t=0.3, as is standard restart file
+# 00003.  Restarts from both files on 4 ranks, and checks that the two restarted runs
+# are bit-identical to each other and to the end of the uninterrupted run.  Requires
+# AthenaK to be built with -D Athena_ENABLE_MPI=ON.
+
+# Modules
+import logging
+import numpy as np
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_restart = {'rst': '00003', 'brst': '00001'}
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for ftype, number in _restart.items():
+        basename = 'buddy_' + ftype
+        arguments = ['job/basename=' + basename,
+                     'mesh/nx1=32', 'mesh/nx2=16', 'mesh/nx3=16',
+                     'meshblock/nx1=16', 'meshblock/nx2=8', 'meshblock/nx3=8',
+                     'time/tlim=0.5',
+                     'output1/data_format=%24.16e',
+                     'output1/dt=0.5',
+                     'output2/file_type=' + ftype,
+                     'output2/dt=0.1',
+                     'output3/data_format=%24.16e']
+        if ftype == 'brst':
+            arguments.append('output2/flush_interval=2')
+        athena.mpirun(4, 'tests/linear_wave_hydro.athinput', arguments)
+        athena.mpirestart(4, 'rst/' + basename + '.' + number + '.rst',
+                          ['job/basename=' + basename + '_restart'])
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+
+    # history of the restarted runs, which starts at the time of the checkpoint
+    hst = {}
+    for ftype in _restart:
+        hst[ftype] = athena_read.hst('build/src/buddy_' + ftype + '_restart.hydro.hst')
+    for var in hst['rst']:
+        if not np.array_equal(hst['rst'][var], hst['brst'][var]):
+            logger.warning('restart from buddy checkpoint differs from standard '
+                           'restart in history variable ' + var)
+            analyze_status = False
+
+    # final solution of uninterrupted and restarted runs
+    data = {}
+    for run in ('buddy_rst', 'buddy_rst_restart', 'buddy_brst', 'buddy_brst_restart'):
+        data[run] = athena_read.tab('build/src/tab/' + run + '.hydro_w.00001.tab')
+    for run in data:
+        for var in data['buddy_rst']:
+            if not np.array_equal(data[run][var], data['buddy_rst'][var]):
+                logger.warning('final {0} of {1} differs from uninterrupted run '
+                               'with standard restart files'.format(var, run))
+                analyze_status = False
+
+    return analyze_status
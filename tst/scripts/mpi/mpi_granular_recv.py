@@ -0,0 +1,76 @@
+# Regression test for unpacking ghost zones of each MeshBlock as its messages arrive
+#
+# Runs the 2D hydro and MHD blast waves with AMR on 4 MPI ranks, with and without
+# <mesh>/granular_recv.  Checks that the results are identical with both methods, and
+# that with granular_recv some MeshBlocks were unpacked while receives for other
+# MeshBlocks on the same rank were still pending.  Requires AthenaK to be built with
+# -D Athena_ENABLE_MPI=ON.
+#
+# The blast problem generator is a user pgen, so this test only runs when built with
+# -D PROBLEM=blast.  With any other build the test does nothing and passes.
+
+# Modules
+import logging
+import numpy as np
+import re
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_skip = False
+_problems = [('hydro', 'hydro/blast_hydro_amr.athinput'),
+             ('mhd', 'mhd/blast_mhd_amr.athinput')]
+_granular = ['false', 'true']
+_nmb_early = {}
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    global _skip
+    problem = athena.cmake_cache('PROBLEM')
+    if problem != 'blast':
+        logger.info('Skipping test ' + __name__ + ', built with PROBLEM=' +
+                    str(problem))
+        _skip = True
+        return
+    for phys, infile in _problems:
+        for gv in _granular:
+            arguments = ['job/basename=granular_' + phys + '_' + gv,
+                         'mesh/granular_recv=' + gv,
+                         'time/tlim=0.1',
+                         'output1/dt=0.01',
+                         'output2/dt=-1.0']
+            output = athena.mpirun_output(4, infile, arguments)
+            if gv == 'true':
+                match = re.search(r'(\d+) MeshBlocks unpacked while receives', output)
+                _nmb_early[phys] = int(match.group(1)) if match else 0
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    if _skip:
+        return analyze_status
+    for phys, infile in _problems:
+        data = {}
+        for gv in _granular:
+            data[gv] = athena_read.hst('build/src/granular_' + phys + '_' + gv + '.'
+                                       + phys + '.hst')
+        for key in data['false']:
+            if not np.array_equal(data['false'][key], data['true'][key]):
+                logger.warning("{0} history variable {1} differs with granular_recv".
+                               format(phys, key))
+                analyze_status = False
+
+        logger.info("{0}: {1:d} MeshBlocks unpacked while receives were pending".
+                    format(phys, _nmb_early[phys]))
+        if _nmb_early[phys] == 0:
+            logger.warning("{0}: no MeshBlocks unpacked before all receives completed".
+                           format(phys))
+            analyze_status = False
+
+    return analyze_status
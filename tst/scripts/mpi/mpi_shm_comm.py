@@ -0,0 +1,57 @@
+# Regression test for exchange of boundary buffers through shared memory
+#
+# Runs the 2D hydro blast wave with AMR on 4 MPI ranks (all on the same node), with and
+# without <mesh>/shm_comm.  Ghost zones are exchanged at startup, in every stage, and
+# again after each change of the mesh by AMR, so the test checks both that the run
+# completes (without deadlock) and that the results are identical with both methods.
+# Requires AthenaK to be built with -D Athena_ENABLE_MPI=ON and -D PROBLEM=blast, since
+# the blast problem generator is a user pgen.  With any other problem generator the
+# test does nothing and passes.
+
+# Modules
+import logging
+import numpy as np
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_skip = False
+_shm = ['false', 'true']
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    global _skip
+    problem = athena.cmake_cache('PROBLEM')
+    if problem != 'blast':
+        logger.info('Skipping test ' + __name__ + ', built with PROBLEM=' +
+                    str(problem))
+        _skip = True
+        return
+    for sv in _shm:
+        arguments = ['job/basename=shm_' + sv,
+                     'mesh/shm_comm=' + sv,
+                     'time/tlim=0.1',
+                     'output1/dt=0.01',
+                     'output2/dt=-1.0']
+        athena.mpirun(4, 'hydro/blast_hydro_amr.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    if _skip:
+        return analyze_status
+    data = {}
+    for sv in _shm:
+        data[sv] = athena_read.hst('build/src/shm_' + sv + '.hydro.hst')
+    for key in data['false']:
+        if not np.array_equal(data['false'][key], data['true'][key]):
+            logger.warning("history variable {0} differs with shm_comm".format(key))
+            analyze_status = False
+
+    return analyze_status
@@ -0,0 +1,89 @@
+# Unit test for tabulated radiation opacities
+#
+# Writes a small opacity table (the fixture) in which log10 of each opacity is a bilinear
+# function of log10(rho) and log10(T), so that interpolation between entries is exact.
+# The opacity_table test problem loads it with Radiation::LoadOpacityTable() and prints
+# values from InterpolateOpacityTable() at every entry, halfway between entries, and
+# beyond the edges of the table.  Checks that both bilinear and bicubic interpolation
+# return the tabulated values at entries and the edge values outside the table, and that
+# interpolation between entries reproduces the bilinear function (bicubic only away
+# from the edges, where the Catmull-Rom stencil is clamped).
+
+# Modules
+import logging
+import numpy as np
+import re
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_nrho, _ntemp = 6, 5
+_logrho = (-12.0, -7.0)
+_logt = (3.0, 5.0)
+# coefficients (a,b,c,d) of log10(kappa) = a + b*log10(rho) + c*log10(T) + d*both, for
+# Rosseland absorption, scattering, and Planck absorption
+_coef = [(1.0, 0.5, -2.0, 0.1), (-0.5, 0.0, 0.0, 0.0), (2.0, 0.7, -3.0, 0.05)]
+_output = {}
+
+
+# Bilinear log10(kappa) of fixture
+def _logk(n, logrho, logt):
+    a, b, c, d = _coef[n]
+    return a + b*logrho + c*logt + d*logrho*logt
+
+
+# Write fixture in format read by Radiation::LoadOpacityTable()
+def _write_table(filename):
+    logrho = np.linspace(_logrho[0], _logrho[1], _nrho)
+    logt = np.linspace(_logt[0], _logt[1], _ntemp)
+    with open(filename, 'wb') as f:
+        np.array([_nrho, _ntemp], dtype=np.int32).tofile(f)
+        np.array(_logrho + _logt, dtype=np.float64).tofile(f)
+        for n in range(3):
+            for lt in logt:
+                np.array(_logk(n, logrho, lt), dtype=np.float64).tofile(f)
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    _write_table('build/src/opacity_table.bin')
+    for cubic in ('false', 'true'):
+        arguments = ['radiation/opacity_table_cubic=' + cubic]
+        _output[cubic] = athena.run_output('tests/opacity_table.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    dlogrho = (_logrho[1] - _logrho[0])/(_nrho - 1)
+    dlogt = (_logt[1] - _logt[0])/(_ntemp - 1)
+    for cubic, output in _output.items():
+        lines = re.findall(r'^opacity_check (\d) (\S+) (\S+) (\S+)$', output,
+                           re.MULTILINE)
+        if len(lines) != 3*(2*_nrho + 3)*(2*_ntemp + 3):
+            logger.warning('wrong number of interpolated opacities: {0:d}'.
+                           format(len(lines)))
+            analyze_status = False
+        errmax = 0.0
+        for line in lines:
+            n = int(line[0])
+            logrho, logt, logk = [float(v) for v in line[1:]]
+            # table coordinates, clamped to edges of table
+            x = min(max((logrho - _logrho[0])/dlogrho, 0.0), _nrho - 1.0)
+            y = min(max((logt - _logt[0])/dlogt, 0.0), _ntemp - 1.0)
+            at_entry = (abs(x - round(x)) < 1.0e-6 and abs(y - round(y)) < 1.0e-6)
+            interior = (1.0 <= x <= _nrho - 3.0 and 1.0 <= y <= _ntemp - 3.0)
+            if cubic == 'false' or at_entry or interior:
+                expected = _logk(n, _logrho[0] + x*dlogrho, _logt[0] + y*dlogt)
+                errmax = max(errmax, abs(logk - expected))
+        logger.info('opacity_table_cubic={0}: max error {1:g}'.format(cubic, errmax))
+        if errmax > 1.0e-10:
+            logger.warning('interpolated opacities differ from table by {0:g}, with '
+                           'opacity_table_cubic={1}'.format(errmax, cubic))
+            analyze_status = False
+
+    return analyze_status
@@ -0,0 +1,78 @@
+# Regression test for reduced angular resolution on selected MeshBlocks
+#
+# Runs the 1D Hohlraum test with SMR using (1) the full angular mesh everywhere, (2) a
+# reduced angular mesh on the root-level MeshBlocks only, and (3) the coarser angular
+# mesh everywhere.  Radiation crosses coarse/fine boundaries between MeshBlocks evolved
+# at different angular resolutions, so fluxes of all angles are used in flux correction.
+# Checks that the L1 error of the mixed run lies between those of the other two runs.
+
+# Modules
+import logging
+import numpy as np
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_runs = {'full': ['radiation/nlevel=3'],
+         'mixed': ['radiation/nlevel=3', 'radiation/nlevel_reduced=1'],
+         'coarse': ['radiation/nlevel=1']}
+_tf = 0.75
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for name in _runs:
+        arguments = ['job/basename=rad_angres_' + name,
+                     'time/tlim=' + repr(_tf)] + _runs[name]
+        athena.run('tests/hohlraum_1d_smr.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+
+    def rtt_analytic(x, t):
+        rtt = 0.5 * (1.0 - x / t)
+        rtt[x > t] = 0.0
+        return rtt
+
+    def rtx_analytic(x, t):
+        rtx = 0.25 * (1.0 - x**2 / t**2)
+        rtx[x > t] = 0.0
+        return rtx
+
+    def rxx_analytic(x, t):
+        rxx = (1.0/6.0) * (1.0 - x**3 / t**3)
+        rxx[x > t] = 0.0
+        return rxx
+
+    l1_errs = {}
+    for name in _runs:
+        x, rtt, rtx, rxx = np.loadtxt('build/src/tab/rad_angres_' + name +
+                                      '.rad_coord.00001.tab', dtype=float,
+                                      unpack=True, usecols=[2, 3, 4, 7])
+        # cells in refined MeshBlocks (0.25 < x < 0.5) are half the size
+        dx = np.where((x > 0.25) & (x < 0.5), 1.0/256.0, 1.0/128.0)
+        rtt_l1 = np.sum(np.abs(rtt - rtt_analytic(x, _tf))*dx)
+        rtx_l1 = np.sum(np.abs(rtx - rtx_analytic(x, _tf))*dx)
+        rxx_l1 = np.sum(np.abs(rxx - rxx_analytic(x, _tf))*dx)
+        l1_errs[name] = (1.0/np.sqrt(3.0))*np.sqrt(rtt_l1**2 + rtx_l1**2 + rxx_l1**2)
+        logger.info("{0} angular resolution L1 error: {1:g}".format(name,
+                                                                   l1_errs[name]))
+
+    if l1_errs['mixed'] > 1.05*l1_errs['coarse']:
+        logger.warning("mixed angular resolution error {0:g} larger than coarse "
+                       "angular resolution error {1:g}".
+                       format(l1_errs['mixed'], l1_errs['coarse']))
+        analyze_status = False
+    if l1_errs['mixed'] < 0.95*l1_errs['full']:
+        logger.warning("mixed angular resolution error {0:g} smaller than full "
+                       "angular resolution error {1:g}".
+                       format(l1_errs['mixed'], l1_errs['full']))
+        analyze_status = False
+
+    return analyze_status
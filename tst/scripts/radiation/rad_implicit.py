@@ -0,0 +1,91 @@
+# Regression test for implicit radiation transport
+#
+# Runs the radiation diffusion and thermal relaxation problems with explicit transport,
+# and with implicit transport at a timestep well above the light-crossing time of a
+# cell (implicit_dt_factor >> 1).  Checks that the implicit runs agree with the explicit
+# runs, and that they take substantially fewer cycles when the fluid is held fixed.
+
+# Modules
+import logging
+import numpy as np
+import re
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_dt_factor = 20.0
+_cycles = {}
+_problems = {'rad_diffusion': ('diffusion', 'radiation/rad_diffusion.athinput'),
+             'rad_relax': ('relax', 'radiation/relax.athinput')}
+_prob = None
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    global _prob
+    problem = athena.cmake_cache('PROBLEM')
+    if problem not in _problems:
+        logger.info('Skipping test ' + __name__ + ', built with PROBLEM=' +
+                    str(problem))
+        return
+    _prob, inp = _problems[problem]
+    for mode in ('explicit', 'implicit'):
+        arguments = ['job/basename=rad_implicit_' + _prob + '_' + mode,
+                     'output1/dt=100.0']
+        if mode == 'implicit':
+            arguments += ['radiation/implicit_transport=true',
+                          'radiation/implicit_dt_factor=' + repr(_dt_factor)]
+        output = athena.run_output(inp, arguments)
+        _cycles[mode] = int(re.search(r'time=\S+ cycle=(\d+)', output).group(1))
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+    if _prob is None:
+        return analyze_status
+
+    def final(mode, fid, var):
+        data = athena_read.tab('build/src/tab/rad_implicit_' + _prob + '_' + mode +
+                               '.' + fid + '.00001.tab')
+        return np.asarray(data[var])
+
+    if _prob == 'diffusion':
+        # radiation energy density in fluid frame of diffusing Gaussian pulse
+        e_exp = final('explicit', 'rad_fluid', 'r00_ff')
+        e_imp = final('implicit', 'rad_fluid', 'r00_ff')
+        # implicit fluxes are first-order upwind, so allow for extra numerical diffusion
+        diff = np.sum(np.abs(e_imp - e_exp))/np.sum(np.abs(e_exp))
+        logger.info("implicit diffusion L1 difference from explicit run: {0:g}".
+                    format(diff))
+        if diff > 0.2:
+            logger.warning("implicit diffusion differs from explicit run by {0:g}".
+                           format(diff))
+            analyze_status = False
+
+        # with fixed fluid, the diffusion timestep is set by the radiation alone
+        ratio = _cycles['explicit']/_cycles['implicit']
+        logger.info("implicit diffusion cycles: {0:d} explicit: {1:d}".
+                    format(_cycles['implicit'], _cycles['explicit']))
+        if ratio < 0.5*_dt_factor:
+            logger.warning("implicit diffusion not taking larger timesteps, cycle "
+                           "ratio {0:g}".format(ratio))
+            analyze_status = False
+    else:
+        # fluid internal energy after thermal relaxation
+        e_exp = final('explicit', 'rad_hydro_w_e', 'eint')
+        e_imp = final('implicit', 'rad_hydro_w_e', 'eint')
+        diff = np.max(np.abs(e_imp - e_exp)/np.abs(e_exp))
+        if diff > 1.0e-3:
+            logger.warning("implicit relaxation differs from explicit run by {0:g}".
+                           format(diff))
+            analyze_status = False
+        if _cycles['implicit'] > _cycles['explicit']:
+            logger.warning("implicit relaxation took more cycles than explicit run")
+            analyze_status = False
+
+    return analyze_status
@@ -0,0 +1,88 @@
+# Regression test for the grey M1 radiation module
+#
+# Runs a Gaussian pulse of radiation in the free-streaming limit (F=E) for one crossing
+# of a periodic domain at two resolutions, and checks the L1 errors against the analytic
+# solution and their convergence.  Runs a Gaussian pulse diffusing through a purely
+# scattering medium and checks the L1 errors against the analytic diffusion solution.
+# Finally, restarts the streaming problem halfway through and checks the result is
+# identical to the uninterrupted run, which tests that the M1 moments are stored in and
+# read from restart files.  The same check is made for a restart from a buddy
+# checkpoint flushed to disk (file_type=brst with flush_interval=1).
+
+# Modules
+import logging
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_res_survey = [128, 256]
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for res in _res_survey:
+        arguments = ['job/basename=rad_m1_stream',
+                     'mesh/nx1=' + repr(res),
+                     'output1/dt=-1.0']
+        athena.run('tests/rad_m1_stream.athinput', arguments)
+    arguments = ['job/basename=rad_m1_diffusion',
+                 'mesh/nx1=256',
+                 'output1/dt=-1.0']
+    athena.run('tests/rad_m1_diffusion.athinput', arguments)
+
+    # uninterrupted run, and restart from dump at t=1
+    arguments = ['job/basename=rad_m1_rst',
+                 'output1/dt=-1.0',
+                 'output2/file_type=rst',
+                 'output2/dt=1.0']
+    athena.run('tests/rad_m1_stream.athinput', arguments)
+    athena.restart('rst/rad_m1_rst.00001.rst', [])
+
+    # same with buddy checkpoints, flushing every checkpoint to a restart file
+    arguments = ['job/basename=rad_m1_brst',
+                 'output1/dt=-1.0',
+                 'output2/file_type=brst',
+                 'output2/flush_interval=1',
+                 'output2/dt=1.0']
+    athena.run('tests/rad_m1_stream.athinput', arguments)
+    athena.restart('rst/rad_m1_brst.00001.rst', [])
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+
+    data = athena_read.error_dat('build/src/rad_m1_stream-errs.dat')
+    l1_rms = [data[i][4] for i in range(len(_res_survey))]
+    error_threshold = 1.0e-2
+    conv_threshold = 0.5
+    if l1_rms[-1] > error_threshold:
+        logger.warning("M1 streaming error too large, error: {0:g} threshold: {1:g}".
+                       format(l1_rms[-1], error_threshold))
+        analyze_status = False
+    if l1_rms[-1]/l1_rms[0] > conv_threshold:
+        logger.warning("M1 streaming not converging, conv: {0:g} threshold: {1:g}".
+                       format(l1_rms[-1]/l1_rms[0], conv_threshold))
+        analyze_status = False
+
+    data = athena_read.error_dat('build/src/rad_m1_diffusion-errs.dat')
+    error_threshold = 5.0e-3
+    if data[0][4] > error_threshold:
+        logger.warning("M1 diffusion error too large, error: {0:g} threshold: {1:g}".
+                       format(data[0][4], error_threshold))
+        analyze_status = False
+
+    for basename in ['rad_m1_rst', 'rad_m1_brst']:
+        data = athena_read.error_dat('build/src/' + basename + '-errs.dat')
+        if data[0][3] != data[1][3] or data[0][4] != data[1][4]:
+            logger.warning("M1 restart {0} differs from uninterrupted run, cycles: "
+                           "{1:g} {2:g} errors: {3:g} {4:g}".format(
+                               basename, data[0][3], data[1][3], data[0][4],
+                               data[1][4]))
+            analyze_status = False
+
+    return analyze_status
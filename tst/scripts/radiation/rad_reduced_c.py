@@ -0,0 +1,51 @@
+# Regression test for the reduced speed of light approximation
+#
+# Runs the radiation-modified linear wave problem in 1D for a sequence of reduced speeds
+# of light and checks that the L1 errors (measured against the solution computed with
+# the full speed of light) decrease monotonically as reduced_c approaches unity.
+
+# Modules
+import logging
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_rc_survey = [0.25, 0.5, 1.0]
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for rc in _rc_survey:
+        arguments = ['job/basename=rad_reduced_c',
+                     'time/tlim=1.0',
+                     'mesh/nx1=128',
+                     'mesh/nx2=1',
+                     'mesh/nx3=1',
+                     'radiation/reduced_c=' + repr(rc),
+                     'output1/dt=-1.0',
+                     'output2/dt=-1.0']
+        athena.run('tests/rad_linwave.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    data = athena_read.error_dat('build/src/rad_reduced_c-errs.dat')
+    analyze_status = True
+    error_threshold = 1.0e-8
+    l1_rms = [data[i][4] for i in range(len(_rc_survey))]
+    for i in range(1, len(_rc_survey)):
+        if l1_rms[i] > l1_rms[i-1]:
+            logger.warning("error not decreasing with reduced_c, reduced_c={0:g} "
+                           "error: {1:g} previous error: {2:g}".
+                           format(_rc_survey[i], l1_rms[i], l1_rms[i-1]))
+            analyze_status = False
+    if l1_rms[-1] > error_threshold:
+        logger.warning("wave error too large for reduced_c=1, error: {0:g} "
+                       "threshold: {1:g}".format(l1_rms[-1], error_threshold))
+        analyze_status = False
+
+    return analyze_status
@@ -60,6 +60,47 @@ def run(input_filename, arguments):
         os.chdir(current_dir)
 
 
+# Function for restarting AthenaK from a restart file
+def restart(restart_filename, arguments):
+    out_log = LogPipe('athena.run', logging.INFO)
+    current_dir = os.getcwd()
+    exe_dir = current_dir + '/build/src/'
+    os.chdir(exe_dir)
+    try:
+        run_command = ['./athena', '-r', restart_filename]
+        try:
+            cmd = run_command + arguments
+            logging.getLogger('athena.run').debug('Executing: '+' '.join(cmd))
+            subprocess.check_call(cmd, stdout=out_log)
+        except subprocess.CalledProcessError as err:
+            raise AthenaError('Return code {0} from command \'{1}\''
+                              .format(err.returncode, ' '.join(err.cmd)))
+    finally:
+        out_log.close()
+        os.chdir(current_dir)
+
+
+# Function for running AthenaK and returning its standard output
+def run_output(input_filename, arguments):
+    current_dir = os.getcwd()
+    exe_dir = current_dir + '/build/src/'
+    os.chdir(exe_dir)
+    try:
+        input_filename_full = '../../' + athena_rel_path + \
+                              'inputs/' + input_filename
+        run_command = ['./athena', '-i', input_filename_full]
+        try:
+            cmd = run_command + arguments
+            logging.getLogger('athena.run').debug('Executing: '+' '.join(cmd))
+            output = subprocess.check_output(cmd).decode('utf-8')
+        except subprocess.CalledProcessError as err:
+            raise AthenaError('Return code {0} from command \'{1}\''
+                              .format(err.returncode, ' '.join(err.cmd)))
+    finally:
+        os.chdir(current_dir)
+    return output
+
+
 # Function for running AthenaK with MPI
 def mpirun(nproc, input_filename, arguments):
     out_log = LogPipe('athena.run', logging.INFO)
@@ -69,7 +110,7 @@ def mpirun(nproc, input_filename, arguments):
     try:
         input_filename_full = '../../' + athena_rel_path + \
                               'inputs/' + input_filename
-        run_command = ['mpiexec -n', str(nproc), './athena', '-i',
+        run_command = ['mpiexec', '-n', str(nproc), './athena', '-i',
                        input_filename_full]
         try:
             cmd = run_command + arguments
@@ -84,6 +125,60 @@ def mpirun(nproc, input_filename, arguments):
         os.chdir(current_dir)
 
 
+# Function for restarting AthenaK with MPI
+def mpirestart(nproc, restart_filename, arguments):
+    out_log = LogPipe('athena.run', logging.INFO)
+    current_dir = os.getcwd()
+    exe_dir = current_dir + '/build/src/'
+    os.chdir(exe_dir)
+    try:
+        run_command = ['mpiexec', '-n', str(nproc), './athena', '-r', restart_filename]
+        try:
+            cmd = run_command + arguments
+            logging.getLogger('athena.run').debug('Executing: '+' '.join(cmd))
+            subprocess.check_call(cmd, stdout=out_log)
+        except subprocess.CalledProcessError as err:
+            raise AthenaError('Return code {0} from command \'{1}\''
+                              .format(err.returncode, ' '.join(err.cmd)))
+    finally:
+        out_log.close()
+        os.chdir(current_dir)
+
+
+# Function for running AthenaK with MPI and returning its standard output
+def mpirun_output(nproc, input_filename, arguments):
+    current_dir = os.getcwd()
+    exe_dir = current_dir + '/build/src/'
+    os.chdir(exe_dir)
+    try:
+        input_filename_full = '../../' + athena_rel_path + \
+                              'inputs/' + input_filename
+        run_command = ['mpiexec', '-n', str(nproc), './athena', '-i',
+                       input_filename_full]
+        try:
+            cmd = run_command + arguments
+            logging.getLogger('athena.run').debug('Executing: '+' '.join(cmd))
+            output = subprocess.check_output(cmd).decode('utf-8')
+        except subprocess.CalledProcessError as err:
+            raise AthenaError('Return code {0} from command \'{1}\''
+                              .format(err.returncode, ' '.join(err.cmd)))
+    finally:
+        os.chdir(current_dir)
+    return output
+
+
+# Function returning value of a variable in the CMake cache of the build, or None
+def cmake_cache(variable):
+    try:
+        with open('build/CMakeCache.txt', 'r') as cache_file:
+            for line in cache_file:
+                if line.startswith(variable + ':'):
+                    return line.split('=', 1)[1].strip()
+    except IOError:
+        pass
+    return None
+
+
 # General exception class for these functions
 class AthenaError(RuntimeError):
     pass
@@ -0,0 +1,83 @@
+# Regression test for multirate coupling between the Z4c spacetime and the matter
+#
+# Runs Oppenheimer-Snyder dust collapse with z4c/multirate_nsub = 1, 2 and 4.  The
+# spacetime timestep is the same in all runs, so the L1 differences in the density and
+# lapse relative to the lock-step run (nsub=1) measure the coupling error introduced by
+# interpolating the metric seen by the matter in time.  Also restarts the nsub=2 run
+# from a dump written in the middle of a spacetime interval, and checks the result is
+# the same as the uninterrupted run, which tests that the multirate state is stored in
+# and read from restart files.  The same check is made for a restart from a buddy
+# checkpoint flushed to disk (file_type=brst with flush_interval=1).
+
+# Modules
+import logging
+import numpy as np
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_nsub = [1, 2, 4]
+_vars = [('mhd_w_d', 'dens'), ('adm_alpha', 'adm_alpha')]
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for nsub in _nsub:
+        arguments = ['job/basename=collapse_mr' + repr(nsub),
+                     'z4c/multirate_nsub=' + repr(nsub)]
+        if nsub != 2:
+            arguments.append('output3/dcycle=0')
+        athena.run('tests/z4c_collapse_multirate.athinput', arguments)
+
+    # restart nsub=2 run from dump at cycle 5, in the middle of a spacetime interval
+    athena.restart('rst/collapse_mr2.00001.rst', ['job/basename=collapse_mr2_rst'])
+
+    # repeat with buddy checkpoints, flushing every checkpoint to a restart file
+    arguments = ['job/basename=collapse_mr2_brst', 'z4c/multirate_nsub=2',
+                 'output3/file_type=brst', 'output3/flush_interval=1']
+    athena.run('tests/z4c_collapse_multirate.athinput', arguments)
+    athena.restart('rst/collapse_mr2_brst.00001.rst',
+                   ['job/basename=collapse_mr2_brst_rst'])
+
+
+# Read final profile of variable from run with given basename
+def read_profile(basename, var):
+    fid, col = var
+    data = athena_read.tab('build/src/tab/' + basename + '.' + fid + '.00001.tab')
+    return np.asarray(data[col])
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    analyze_status = True
+
+    error_threshold = 1.0e-2
+    for var in _vars:
+        ref = read_profile('collapse_mr1', var)
+        norm = np.mean(np.abs(ref))
+        for nsub in _nsub[1:]:
+            prof = read_profile('collapse_mr' + repr(nsub), var)
+            err = np.mean(np.abs(prof - ref))/norm
+            logger.info("multirate coupling error in {0} for nsub={1:d}: {2:g}".
+                        format(var[1], nsub, err))
+            if err > error_threshold:
+                logger.warning("multirate coupling error in {0} too large for "
+                               "nsub={1:d}, error: {2:g} threshold: {3:g}".
+                               format(var[1], nsub, err, error_threshold))
+                analyze_status = False
+
+        # restarted runs must reproduce the uninterrupted run
+        prof = read_profile('collapse_mr2', var)
+        for rst in ['collapse_mr2_rst', 'collapse_mr2_brst_rst']:
+            prof_rst = read_profile(rst, var)
+            diff = np.max(np.abs(prof_rst - prof))/norm
+            if diff > 1.0e-10:
+                logger.warning("multirate restart {0} differs from uninterrupted run "
+                               "in {1}, difference: {2:g}".format(rst, var[1], diff))
+                analyze_status = False
+
+    return analyze_status
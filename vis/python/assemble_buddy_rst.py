@@ -0,0 +1,82 @@
+# A simple script for assembling a restart (.rst) file from the in-memory checkpoints
+# written to node-local storage by outputs with file_type=brst and buddy_dir set.  Each
+# rank stores its own checkpoint and a copy of the checkpoint of its partner, so the
+# most recent checkpoint can be recovered as long as one of the two copies of every rank
+# survives.  Pass the buddy_dir of every node used by the job.
+
+# Python modules
+import argparse
+import glob
+import os
+import struct
+
+# size of record at start of each checkpoint piece: ncycle, rank, nranks, header_size,
+# data_offset, data_size
+info_size = 6*8
+
+
+# Read record at start of a checkpoint piece
+def read_info(fname):
+    with open(fname, 'rb') as f:
+        ncycle, rank, nranks, header_size, data_offset, data_size = \
+            struct.unpack('<6Q', f.read(info_size))
+    return {'file': fname, 'ncycle': ncycle, 'rank': rank, 'nranks': nranks,
+            'header_size': header_size, 'data_offset': data_offset,
+            'data_size': data_size}
+
+
+# Main function
+def main(**kwargs):
+    # Collect all pieces, keyed by (ncycle, rank).  Own pieces are preferred over copies.
+    pieces = {}
+    for d in kwargs['buddy_dirs']:
+        for fname in glob.glob(os.path.join(d, kwargs['basename'] + '.*.brst')):
+            info = read_info(fname)
+            key = (info['ncycle'], info['rank'])
+            if key not in pieces or not fname.endswith('.copy.brst'):
+                pieces[key] = info
+    if len(pieces) < 1:
+        print(f"No checkpoint pieces found for basename {kwargs['basename']}")
+        quit()
+
+    # Find most recent cycle for which pieces of all ranks exist
+    nranks = max(p['nranks'] for p in pieces.values())
+    cycles = sorted(set(key[0] for key in pieces), reverse=True)
+    ncycle = None
+    for c in cycles:
+        if all((c, r) in pieces for r in range(nranks)):
+            ncycle = c
+            break
+    if ncycle is None:
+        print('No complete checkpoint found, ranks are missing for every cycle')
+        quit()
+
+    # Write header stored by rank 0 followed by data of each rank at its offset
+    outname = kwargs['output']
+    with open(outname, 'wb') as out:
+        for r in range(nranks):
+            info = pieces[(ncycle, r)]
+            with open(info['file'], 'rb') as f:
+                f.seek(info_size)
+                if r == 0:
+                    out.write(f.read(info['header_size']))
+                else:
+                    f.seek(info['header_size'], os.SEEK_CUR)
+                out.seek(info['data_offset'])
+                out.write(f.read())
+            if kwargs['verbose']:
+                print(f"Rank {r}: {info['file']}")
+    print(f'Wrote checkpoint of cycle {ncycle} to {outname}')
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('basename', help='basename of job, from <job>/basename')
+    parser.add_argument('buddy_dirs', nargs='+',
+                        help='directories containing checkpoint pieces (.brst)')
+    parser.add_argument('-o', '--output', default='recovered.rst',
+                        help='name of restart file to write')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='print which piece is used for each rank')
+    args = parser.parse_args()
+    main(**vars(args))